@@ -0,0 +1,266 @@
+// Copyright (C) 2025 ...
+
+#include "columnar_file.hpp"
+#include "columnar_format.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+
+using namespace form::detail::experimental;
+
+/* The directory lists every column:
+ *
+ *   uint64 number of columns
+ *   per column:  uint64 name length, name, uint8 type code, uint64 number of pages,
+ *                per page: uint64 offset, first row, rows, size
+ */
+
+namespace {
+  std::runtime_error systemError(std::string const& what, std::string const& name)
+  {
+    return std::runtime_error("Columnar_FileImp: " + what + " " + name + ": " +
+                              std::generic_category().message(errno));
+  }
+
+  void put(std::vector<std::byte>& out, std::uint64_t const value)
+  {
+    auto const bytes = std::as_bytes(std::span{&value, 1});
+    out.insert(out.end(), bytes.begin(), bytes.end());
+  }
+
+  // Bounds-checked reads from the mapped directory
+  class DirectoryCursor {
+  public:
+    DirectoryCursor(std::span<std::byte const> bytes, std::string const& file) :
+      m_bytes(bytes), m_file(file)
+    {
+    }
+
+    template <typename T>
+    T get()
+    {
+      T value;
+      std::memcpy(&value, take(sizeof(T)).data(), sizeof(T));
+      return value;
+    }
+
+    std::string getString()
+    {
+      auto const bytes = take(get<std::uint64_t>());
+      return {reinterpret_cast<char const*>(bytes.data()), bytes.size()};
+    }
+
+  private:
+    std::span<std::byte const> take(std::uint64_t const size)
+    {
+      if (size > m_bytes.size()) {
+        throw std::runtime_error("Columnar_FileImp: truncated directory in " + m_file);
+      }
+      auto const result = m_bytes.first(size);
+      m_bytes = m_bytes.subspan(size);
+      return result;
+    }
+
+    std::span<std::byte const> m_bytes;
+    std::string const& m_file;
+  };
+}
+
+Columnar_FileImp::Columnar_FileImp(std::string const& name, char mode) :
+  Storage_File(name, mode), m_writable(mode == 'c' || mode == 'r' || mode == 'o')
+{
+  if (m_writable) {
+    m_fd = ::open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+      throw systemError("unable to create", name);
+    }
+    writeBytes(std::as_bytes(std::span{columnar::magic}));
+    return;
+  }
+
+  m_fd = ::open(name.c_str(), O_RDONLY | O_CLOEXEC);
+  if (m_fd < 0) {
+    throw systemError("unable to open", name);
+  }
+  struct stat info{};
+  if (::fstat(m_fd, &info) != 0) {
+    auto error = systemError("unable to stat", name);
+    ::close(m_fd);
+    throw error;
+  }
+  m_size = static_cast<std::uint64_t>(info.st_size);
+  if (m_size > 0) {
+    void* mapped = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (mapped == MAP_FAILED) {
+      auto error = systemError("unable to map", name);
+      ::close(m_fd);
+      throw error;
+    }
+    m_mapped = static_cast<std::byte const*>(mapped);
+  }
+  try {
+    readDirectory();
+  } catch (...) {
+    if (m_mapped != nullptr) {
+      ::munmap(const_cast<std::byte*>(m_mapped), m_size);
+    }
+    ::close(m_fd);
+    throw;
+  }
+}
+
+Columnar_FileImp::~Columnar_FileImp()
+{
+  if (m_writable) {
+    try {
+      writeDirectory();
+    } catch (std::exception const& e) {
+      std::cerr << e.what() << '\n';
+    }
+  } else if (m_mapped != nullptr) {
+    ::munmap(const_cast<std::byte*>(m_mapped), m_size);
+  }
+  ::close(m_fd);
+}
+
+bool Columnar_FileImp::writable() const { return m_writable; }
+
+std::size_t Columnar_FileImp::addColumn(std::string const& name, std::uint8_t code)
+{
+  if (!m_writable) {
+    throw std::runtime_error("Columnar_FileImp::addColumn file " + this->name() +
+                             " is not open for writing");
+  }
+  auto [it, inserted] = m_columns.try_emplace(name, Column{.code = code, .rows = 0, .pages = {}});
+  if (!inserted) {
+    throw std::runtime_error("Columnar_FileImp::addColumn column " + name +
+                             " already exists in " + this->name());
+  }
+  m_columnsByHandle.push_back(&it->second);
+  return m_columnsByHandle.size() - 1;
+}
+
+void Columnar_FileImp::appendPage(std::size_t column,
+                                  std::uint64_t rows,
+                                  std::span<std::byte const> offsets,
+                                  std::span<std::byte const> data)
+{
+  auto& col = *m_columnsByHandle.at(column);
+  static constexpr std::array<std::byte, columnar::page_alignment> padding{};
+  if (auto const misalignment = m_size % columnar::page_alignment; misalignment != 0) {
+    writeBytes(std::span{padding}.first(columnar::page_alignment - misalignment));
+  }
+  col.pages.push_back({.offset = m_size,
+                       .first_row = col.rows,
+                       .rows = rows,
+                       .size = offsets.size() + data.size()});
+  col.rows += rows;
+  writeBytes(offsets);
+  writeBytes(data);
+}
+
+Columnar_FileImp::Column const* Columnar_FileImp::findColumn(std::string const& name) const
+{
+  auto it = m_columns.find(name);
+  return it != m_columns.end() ? &it->second : nullptr;
+}
+
+std::span<std::byte const> Columnar_FileImp::bytes(std::uint64_t offset, std::uint64_t size) const
+{
+  if (m_mapped == nullptr || offset > m_size || size > m_size - offset) {
+    throw std::runtime_error("Columnar_FileImp::bytes range outside of the mapped file");
+  }
+  return {m_mapped + offset, size};
+}
+
+void Columnar_FileImp::writeBytes(std::span<std::byte const> data)
+{
+  while (!data.empty()) {
+    auto const written = ::write(m_fd, data.data(), data.size());
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw systemError("unable to write", name());
+    }
+    data = data.subspan(static_cast<std::size_t>(written));
+    m_size += static_cast<std::uint64_t>(written);
+  }
+}
+
+void Columnar_FileImp::writeDirectory()
+{
+  std::vector<std::byte> directory;
+  put(directory, m_columns.size());
+  for (auto const& [name, column] : m_columns) {
+    put(directory, name.size());
+    auto const name_bytes = std::as_bytes(std::span{name});
+    directory.insert(directory.end(), name_bytes.begin(), name_bytes.end());
+    directory.push_back(std::byte{column.code});
+    put(directory, column.pages.size());
+    for (auto const& page : column.pages) {
+      put(directory, page.offset);
+      put(directory, page.first_row);
+      put(directory, page.rows);
+      put(directory, page.size);
+    }
+  }
+  put(directory, m_size);
+  auto const magic = std::as_bytes(std::span{columnar::magic});
+  directory.insert(directory.end(), magic.begin(), magic.end());
+  writeBytes(directory);
+}
+
+void Columnar_FileImp::readDirectory()
+{
+  auto const magic = std::as_bytes(std::span{columnar::magic});
+  auto const trailer_size = sizeof(std::uint64_t) + magic.size();
+  if (m_size < magic.size() + trailer_size ||
+      !std::ranges::equal(bytes(0, magic.size()), magic) ||
+      !std::ranges::equal(bytes(m_size - magic.size(), magic.size()), magic)) {
+    throw std::runtime_error("Columnar_FileImp: " + name() +
+                             " is not a complete FORM columnar file");
+  }
+
+  std::uint64_t directory_offset{};
+  std::memcpy(&directory_offset,
+              bytes(m_size - trailer_size, sizeof(std::uint64_t)).data(),
+              sizeof(std::uint64_t));
+  if (directory_offset < magic.size() || directory_offset > m_size - trailer_size) {
+    throw std::runtime_error("Columnar_FileImp: invalid directory offset in " + name());
+  }
+
+  DirectoryCursor cursor{bytes(directory_offset, m_size - trailer_size - directory_offset),
+                         name()};
+  auto const columns = cursor.get<std::uint64_t>();
+  for (std::uint64_t i = 0; i != columns; ++i) {
+    auto column_name = cursor.getString();
+    Column column{.code = cursor.get<std::uint8_t>(), .rows = 0, .pages = {}};
+    auto const pages = cursor.get<std::uint64_t>();
+    for (std::uint64_t p = 0; p != pages; ++p) {
+      Page page{.offset = cursor.get<std::uint64_t>(),
+                .first_row = cursor.get<std::uint64_t>(),
+                .rows = cursor.get<std::uint64_t>(),
+                .size = cursor.get<std::uint64_t>()};
+      // Validate once here so that reads need not check the page bounds again
+      bytes(page.offset, page.size);
+      if (page.first_row != column.rows) {
+        throw std::runtime_error("Columnar_FileImp: inconsistent pages for column " +
+                                 column_name + " in " + name());
+      }
+      column.rows += page.rows;
+      column.pages.push_back(page);
+    }
+    m_columns.emplace(std::move(column_name), std::move(column));
+  }
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_COLUMNAR_STORAGE_COLUMNAR_FILE_HPP
+#define FORM_COLUMNAR_STORAGE_COLUMNAR_FILE_HPP
+
+#include "storage/storage_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace form::detail::experimental {
+
+  // A FORM columnar file (see columnar_format.hpp), opened either for writing or for reading.
+  //
+  // Written files are append-only: write containers hand complete pages to appendPage, which
+  // writes them sequentially, and the directory describing all columns is written when the file
+  // is destroyed.  A file is therefore only readable once every container writing to it and the
+  // file itself have been destroyed.
+  //
+  // Files opened for reading are memory-mapped; page bytes are accessed in place and the file
+  // may be read from several threads at once.
+  class Columnar_FileImp : public Storage_File {
+  public:
+    struct Page {
+      std::uint64_t offset;    // of the page in the file
+      std::uint64_t first_row; // of the column
+      std::uint64_t rows;
+      std::uint64_t size; // in bytes
+    };
+
+    struct Column {
+      std::uint8_t code; // see columnar::ColumnType::handle
+      std::uint64_t rows{};
+      std::vector<Page> pages;
+    };
+
+    Columnar_FileImp(std::string const& name, char mode);
+    ~Columnar_FileImp() override;
+
+    Columnar_FileImp(Columnar_FileImp const&) = delete;
+    Columnar_FileImp& operator=(Columnar_FileImp const&) = delete;
+    Columnar_FileImp(Columnar_FileImp&&) = delete;
+    Columnar_FileImp& operator=(Columnar_FileImp&&) = delete;
+
+    bool writable() const;
+
+    // Writing: declares a column and returns its handle for appendPage
+    std::size_t addColumn(std::string const& name, std::uint8_t code);
+    // Writing: appends one page of the column holding 'rows' rows
+    void appendPage(std::size_t column,
+                    std::uint64_t rows,
+                    std::span<std::byte const> offsets,
+                    std::span<std::byte const> data);
+
+    // Reading: the column with the given name, or nullptr
+    Column const* findColumn(std::string const& name) const;
+    // Reading: a range of bytes of the mapped file
+    std::span<std::byte const> bytes(std::uint64_t offset, std::uint64_t size) const;
+
+  private:
+    void writeBytes(std::span<std::byte const> data);
+    void writeDirectory();
+    void readDirectory();
+
+    int m_fd{-1};
+    bool m_writable;
+    std::uint64_t m_size{}; // bytes written so far, or size of the mapped file
+    std::byte const* m_mapped{nullptr};
+
+    std::map<std::string, Column, std::less<>> m_columns;
+    std::vector<Column*> m_columnsByHandle;
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_COLUMNAR_STORAGE_COLUMNAR_FILE_HPP
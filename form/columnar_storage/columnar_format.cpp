@@ -0,0 +1,75 @@
+// Copyright (C) 2025 ...
+
+#include "columnar_format.hpp"
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace form::detail::experimental;
+using namespace form::detail::experimental::columnar;
+
+namespace {
+  // The on-disk code of each stored type.  Vectors of a scalar type use the scalar code with
+  // vector_bit set.
+  constexpr std::uint8_t vector_bit = 0x40;
+
+  template <typename T>
+  constexpr std::uint8_t code = 0;
+  template <>
+  constexpr std::uint8_t code<bool> = 1;
+  template <>
+  constexpr std::uint8_t code<char> = 2;
+  template <>
+  constexpr std::uint8_t code<signed char> = 3;
+  template <>
+  constexpr std::uint8_t code<unsigned char> = 4;
+  template <>
+  constexpr std::uint8_t code<short> = 5;
+  template <>
+  constexpr std::uint8_t code<unsigned short> = 6;
+  template <>
+  constexpr std::uint8_t code<int> = 7;
+  template <>
+  constexpr std::uint8_t code<unsigned int> = 8;
+  template <>
+  constexpr std::uint8_t code<long> = 9;
+  template <>
+  constexpr std::uint8_t code<unsigned long> = 10;
+  template <>
+  constexpr std::uint8_t code<long long> = 11;
+  template <>
+  constexpr std::uint8_t code<unsigned long long> = 12;
+  template <>
+  constexpr std::uint8_t code<float> = 13;
+  template <>
+  constexpr std::uint8_t code<double> = 14;
+  template <typename T>
+  constexpr std::uint8_t code<std::vector<T>> = code<T> | vector_bit;
+  template <>
+  constexpr std::uint8_t code<std::string> = 0x80;
+
+  std::vector<ColumnType> const& columnTypes()
+  {
+    static std::vector<ColumnType> const types = makeStoredTypes<std::uint8_t>(
+      []<typename T>(std::type_identity<T>) { return code<T>; });
+    return types;
+  }
+}
+
+namespace form::detail::experimental::columnar {
+
+  ColumnType const* columnType(std::type_info const& type)
+  {
+    return findStoredType(columnTypes(), type);
+  }
+
+  ColumnType const* columnType(std::uint8_t code)
+  {
+    auto const& types = columnTypes();
+    auto it = std::ranges::find(types, code, &ColumnType::handle);
+    return it != types.end() ? &*it : nullptr;
+  }
+
+} // namespace form::detail::experimental::columnar
@@ -0,0 +1,44 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_COLUMNAR_STORAGE_COLUMNAR_FORMAT_HPP
+#define FORM_COLUMNAR_STORAGE_COLUMNAR_FORMAT_HPP
+
+#include "storage/storage_types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <typeinfo>
+
+/* On-disk layout of a FORM columnar file
+ *
+ *   magic                               8 bytes
+ *   page, page, ...                     each page starts on an 8-byte boundary
+ *   directory                           see Columnar_FileImp
+ *   directory offset                    uint64
+ *   magic                               8 bytes
+ *
+ * A page holds a run of consecutive rows of one column.  Fixed-width columns (fundamental types)
+ * store the values back to back.  Variable-width columns (std::vector of a fundamental type and
+ * std::string) store rows + 1 uint64 byte offsets, relative to the start of the page data,
+ * followed by the element bytes of all rows.  All values are in the byte order of the writing
+ * host.
+ */
+
+namespace form::detail::experimental::columnar {
+
+  inline constexpr std::array<char, 8> magic{'F', 'O', 'R', 'M', 'C', 'O', 'L', '1'};
+  inline constexpr std::size_t page_alignment = 8;
+
+  // How objects of one C++ type are stored in a column.  The handle is the code that identifies
+  // the type on disk, which must never be reused for a different type.
+  using ColumnType = StoredType<std::uint8_t>;
+
+  // The column type of a C++ type, or nullptr if the type cannot be stored
+  ColumnType const* columnType(std::type_info const& type);
+  // The column type with the given on-disk code, or nullptr if the code is unknown
+  ColumnType const* columnType(std::uint8_t code);
+
+} // namespace form::detail::experimental::columnar
+
+#endif // FORM_COLUMNAR_STORAGE_COLUMNAR_FORMAT_HPP
@@ -0,0 +1,130 @@
+// Copyright (C) 2025 ...
+
+#include "columnar_read_container.hpp"
+#include "columnar_format.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using namespace form::detail::experimental;
+
+Columnar_Read_ContainerImp::Columnar_Read_ContainerImp(std::string const& name) :
+  Storage_Read_Container(name)
+{
+}
+
+void Columnar_Read_ContainerImp::setFile(std::shared_ptr<IStorage_File> file)
+{
+  this->Storage_Read_Container::setFile(file);
+  m_file = std::dynamic_pointer_cast<Columnar_FileImp>(file);
+  if (m_file == nullptr || m_file->writable()) {
+    throw std::runtime_error(
+      "Columnar_Read_ContainerImp::setFile can't attach to a file not opened for reading");
+  }
+  // A missing column is only reported when the container is used.
+  m_column = m_file->findColumn(name());
+}
+
+void Columnar_Read_ContainerImp::prime(std::type_info const& type)
+{
+  checkType(column("prime"), type, "prime");
+}
+
+bool Columnar_Read_ContainerImp::read(int id, void const** data, std::type_info const& type)
+{
+  auto const& col = column("read");
+  checkType(col, type, "read");
+  if (id < 0 || static_cast<std::uint64_t>(id) >= col.rows) {
+    return false;
+  }
+
+  auto const row = static_cast<std::uint64_t>(id);
+  auto const page =
+    std::ranges::upper_bound(col.pages, row, {}, &Columnar_FileImp::Page::first_row) - 1;
+  auto const index = row - page->first_row;
+  auto const& column_type = *columnar::columnType(col.code);
+
+  if (!column_type.variable) {
+    *data = column_type.create(
+      m_file->bytes(page->offset + index * column_type.element_size, column_type.element_size));
+    return true;
+  }
+
+  // Offsets are read with memcpy, as the mapped bytes carry no alignment guarantee for them.
+  std::uint64_t bounds[2];
+  std::memcpy(bounds,
+              m_file->bytes(page->offset + index * sizeof(std::uint64_t), sizeof(bounds)).data(),
+              sizeof(bounds));
+  auto const data_start = page->offset + (page->rows + 1) * sizeof(std::uint64_t);
+  if (bounds[0] > bounds[1] || data_start + bounds[1] > page->offset + page->size) {
+    throw std::runtime_error("Columnar_Read_ContainerImp::read corrupt page in column " + name());
+  }
+  *data = column_type.create(m_file->bytes(data_start + bounds[0], bounds[1] - bounds[0]));
+  return true;
+}
+
+int Columnar_Read_ContainerImp::readBulk(int first,
+                                         int count,
+                                         void* buffer,
+                                         std::type_info const& type)
+{
+  auto const& col = column("readBulk");
+  checkType(col, type, "readBulk");
+  auto const& column_type = *columnar::columnType(col.code);
+  if (column_type.variable) {
+    throw std::runtime_error("Columnar_Read_ContainerImp::readBulk column " + name() +
+                             " does not hold a fundamental type");
+  }
+  if (first < 0 || count <= 0 || static_cast<std::uint64_t>(first) >= col.rows) {
+    return 0;
+  }
+
+  auto const begin = static_cast<std::uint64_t>(first);
+  auto const end = std::min(col.rows, begin + static_cast<std::uint64_t>(count));
+  auto* out = static_cast<std::byte*>(buffer);
+  auto page =
+    std::ranges::upper_bound(col.pages, begin, {}, &Columnar_FileImp::Page::first_row) - 1;
+  for (auto row = begin; row != end; ++page) {
+    auto const rows = std::min(end, page->first_row + page->rows) - row;
+    auto const offset = page->offset + (row - page->first_row) * column_type.element_size;
+    auto const bytes = m_file->bytes(offset, rows * column_type.element_size);
+    std::memcpy(out, bytes.data(), bytes.size());
+    out += bytes.size();
+    row += rows;
+  }
+  return static_cast<int>(end - begin);
+}
+
+int Columnar_Read_ContainerImp::entries()
+{
+  auto const rows = column("entries").rows;
+  if (rows > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+    throw std::runtime_error("Columnar_Read_ContainerImp::entries too many rows in " + name());
+  }
+  return static_cast<int>(rows);
+}
+
+Columnar_FileImp::Column const& Columnar_Read_ContainerImp::column(std::string const& caller)
+{
+  if (m_file == nullptr) {
+    throw std::runtime_error("Columnar_Read_ContainerImp::" + caller + " no file attached");
+  }
+  if (m_column == nullptr) {
+    throw container_not_found("Columnar_Read_ContainerImp::" + caller +
+                              " no column found with name " + name() + " in " + m_file->name());
+  }
+  return *m_column;
+}
+
+void Columnar_Read_ContainerImp::checkType(Columnar_FileImp::Column const& column,
+                                           std::type_info const& type,
+                                           std::string const& caller)
+{
+  auto const* requested = columnar::columnType(type);
+  if (requested == nullptr || requested->handle != column.code) {
+    throw std::runtime_error("Columnar_Read_ContainerImp::" + caller + " type " + type.name() +
+                             " does not match the type stored in column " + name());
+  }
+}
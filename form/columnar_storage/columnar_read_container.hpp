@@ -0,0 +1,43 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_COLUMNAR_STORAGE_COLUMNAR_READ_CONTAINER_HPP
+#define FORM_COLUMNAR_STORAGE_COLUMNAR_READ_CONTAINER_HPP
+
+#include "columnar_file.hpp"
+
+#include "storage/storage_read_container.hpp"
+
+#include <memory>
+#include <string>
+
+namespace form::detail::experimental {
+
+  // Reads one column of a memory-mapped FORM columnar file.  Each product is copied straight
+  // from the mapped page into a newly created object; nothing is modified after setFile, so
+  // reads may be issued concurrently.
+  class Columnar_Read_ContainerImp : public Storage_Read_Container {
+  public:
+    explicit Columnar_Read_ContainerImp(std::string const& name);
+    ~Columnar_Read_ContainerImp() override = default;
+
+    void setFile(std::shared_ptr<IStorage_File> file) override;
+    void prime(std::type_info const& type) override;
+
+    bool read(int id, void const** data, std::type_info const& type) override;
+    // Copies whole runs of a fixed-width column straight from the mapped pages
+    int readBulk(int first, int count, void* buffer, std::type_info const& type) override;
+    int entries() override;
+
+  private:
+    Columnar_FileImp::Column const& column(std::string const& caller);
+    void checkType(Columnar_FileImp::Column const& column,
+                   std::type_info const& type,
+                   std::string const& caller);
+
+    std::shared_ptr<Columnar_FileImp> m_file;
+    Columnar_FileImp::Column const* m_column{nullptr};
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_COLUMNAR_STORAGE_COLUMNAR_READ_CONTAINER_HPP
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 ...
+
+#include "columnar_write_container.hpp"
+#include "columnar_file.hpp"
+#include "columnar_format.hpp"
+
+#include <iostream>
+#include <span>
+#include <stdexcept>
+
+using namespace form::detail::experimental;
+
+Columnar_Write_ContainerImp::Columnar_Write_ContainerImp(std::string const& name) :
+  Storage_Write_Container(name)
+{
+}
+
+Columnar_Write_ContainerImp::~Columnar_Write_ContainerImp()
+{
+  try {
+    flushPage();
+  } catch (std::exception const& e) {
+    std::cerr << "Columnar_Write_ContainerImp: rows of " << name() << " were lost: " << e.what()
+              << '\n';
+  }
+}
+
+void Columnar_Write_ContainerImp::setFile(std::shared_ptr<IStorage_File> file)
+{
+  this->Storage_Write_Container::setFile(file);
+  m_file = std::dynamic_pointer_cast<Columnar_FileImp>(file);
+  if (m_file == nullptr) {
+    throw std::runtime_error(
+      "Columnar_Write_ContainerImp::setFile can't attach to non-columnar file");
+  }
+}
+
+void Columnar_Write_ContainerImp::setupWrite(std::type_info const& type)
+{
+  if (m_file == nullptr) {
+    throw std::runtime_error("Columnar_Write_ContainerImp::setupWrite no file attached");
+  }
+  if (m_type != nullptr) {
+    return;
+  }
+  m_type = columnar::columnType(type);
+  if (m_type == nullptr) {
+    throw std::runtime_error(
+      std::string{"Columnar_Write_ContainerImp::setupWrite unsupported type: "} + type.name());
+  }
+  m_column = m_file->addColumn(name(), m_type->handle);
+  if (m_type->variable) {
+    m_offsets.push_back(0);
+  }
+  // The page buffer is reused for every page, so it is allocated only once.
+  m_data.reserve(m_pageSize);
+}
+
+std::uint64_t Columnar_Write_ContainerImp::fill(void const* data)
+{
+  if (m_type == nullptr) {
+    throw std::runtime_error("Columnar_Write_ContainerImp::fill called before setupWrite for " +
+                             name());
+  }
+  auto const bytes = m_type->bytes(data);
+  m_data.insert(m_data.end(), bytes.begin(), bytes.end());
+  if (m_type->variable) {
+    m_offsets.push_back(m_data.size());
+  }
+  ++m_pageRows;
+  if (m_data.size() >= m_pageSize) {
+    flushPage();
+  }
+  return m_rows++;
+}
+
+// Rows are made durable when the page is written (or the output is flushed), not per commit.
+void Columnar_Write_ContainerImp::commit() {}
+
+void Columnar_Write_ContainerImp::flush()
+{
+  if (m_type != nullptr) {
+    flushPage();
+  }
+}
+
+void Columnar_Write_ContainerImp::setAttribute(std::string const& key, std::string const& value)
+{
+  if (key == "page_size") {
+    m_pageSize = std::stoul(value);
+  } else {
+    throw std::runtime_error("Columnar_Write_ContainerImp accepts some attributes, but not " +
+                             key);
+  }
+}
+
+void Columnar_Write_ContainerImp::flushPage()
+{
+  if (m_pageRows == 0) {
+    return;
+  }
+  m_file->appendPage(m_column, m_pageRows, std::as_bytes(std::span{m_offsets}), m_data);
+  m_pageRows = 0;
+  m_data.clear();
+  if (m_type->variable) {
+    m_offsets.assign(1, 0);
+  }
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_COLUMNAR_STORAGE_COLUMNAR_WRITE_CONTAINER_HPP
+#define FORM_COLUMNAR_STORAGE_COLUMNAR_WRITE_CONTAINER_HPP
+
+#include "columnar_format.hpp"
+
+#include "storage/storage_write_container.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace form::detail::experimental {
+
+  class Columnar_FileImp;
+
+  // Writes one column of a FORM columnar file.  Rows are collected in memory and handed to the
+  // file one page at a time; a page is written once it holds at least page_size bytes (settable
+  // through the "page_size" attribute) and when the container is destroyed.  Columns are
+  // independent of each other, so no association container is needed.
+  class Columnar_Write_ContainerImp : public Storage_Write_Container {
+  public:
+    explicit Columnar_Write_ContainerImp(std::string const& name);
+    ~Columnar_Write_ContainerImp() override;
+
+    Columnar_Write_ContainerImp(Columnar_Write_ContainerImp const&) = delete;
+    Columnar_Write_ContainerImp& operator=(Columnar_Write_ContainerImp const&) = delete;
+    Columnar_Write_ContainerImp(Columnar_Write_ContainerImp&&) = delete;
+    Columnar_Write_ContainerImp& operator=(Columnar_Write_ContainerImp&&) = delete;
+
+    void setFile(std::shared_ptr<IStorage_File> file) override;
+    void setupWrite(std::type_info const& type) override;
+    std::uint64_t fill(void const* data) override;
+    void commit() override;
+    void flush() override;
+
+    void setAttribute(std::string const& key, std::string const& value) override;
+
+  private:
+    void flushPage();
+
+    std::shared_ptr<Columnar_FileImp> m_file;
+    columnar::ColumnType const* m_type{nullptr};
+    std::size_t m_column{};
+    std::size_t m_pageSize{std::size_t{1} << 20};
+
+    std::uint64_t m_rows{};     // written to this column so far
+    std::uint64_t m_pageRows{}; // in the current page
+    std::vector<std::uint64_t> m_offsets;
+    std::vector<std::byte> m_data;
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_COLUMNAR_STORAGE_COLUMNAR_WRITE_CONTAINER_HPP
@@ -16,6 +16,7 @@ namespace form::technology {
     generic = 0, // no specific technology requested
     root = 1,
     hdf5 = 2,
+    columnar = 3, // FORM's own memory-mapped columnar files
   };
 
   // Minor variant within a Major (e.g. TTree vs RNTuple within ROOT)
@@ -31,6 +32,7 @@ namespace form::technology {
   inline constexpr Id ROOT_TTREE{.major = Major::root, .minor = 1};
   inline constexpr Id ROOT_RNTUPLE{.major = Major::root, .minor = 2};
   inline constexpr Id HDF5{.major = Major::hdf5, .minor = 1};
+  inline constexpr Id COLUMNAR{.major = Major::columnar, .minor = 1};
 
   // Canonical string -> technology mapping: the single place a technology string is parsed, replacing the copies that used to live in each module/source/test
   inline Id from_string(std::string_view name)
@@ -42,8 +44,10 @@ namespace form::technology {
       return ROOT_RNTUPLE;
     }
     if (name == "HDF5") {
-      // HDF5 is a reserved technology but has no backend yet: reject it at parse time
-      throw std::runtime_error("Technology 'HDF5' is recognized but not yet implemented");
+      return HDF5;
+    }
+    if (name == "COLUMNAR") {
+      return COLUMNAR;
     }
     throw std::runtime_error("Unknown technology: " + std::string(name));
   }
@@ -60,6 +64,9 @@ namespace form::technology {
     if (tech == HDF5) {
       return "HDF5";
     }
+    if (tech == COLUMNAR) {
+      return "COLUMNAR";
+    }
     return "UNKNOWN";
   }
 
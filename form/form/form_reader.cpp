@@ -35,6 +35,20 @@ namespace form::experimental {
     m_pers_reader->read(creator, product.label, segment_id, &product.data, *product.type);
   }
 
+  int form_reader_interface::readBulk(std::string const& creator,
+                                      std::string const& product_name,
+                                      std::string const& first_segment_id,
+                                      int count,
+                                      void* buffer,
+                                      std::type_info const& type)
+  {
+    if (!m_product_to_config.contains(product_name)) {
+      throw std::runtime_error("No configuration found for product: " + product_name);
+    }
+
+    return m_pers_reader->readBulk(creator, product_name, first_segment_id, count, buffer, type);
+  }
+
   void form_reader_interface::prime(std::string const& creator,
                                     std::string const& product_name,
                                     std::type_info const& type)
@@ -42,9 +56,9 @@ namespace form::experimental {
     m_pers_reader->prime(creator, product_name, type);
   }
 
-  std::vector<std::string> form_reader_interface::indices(std::string const& creator,
-                                                          std::string const& product_name)
+  std::vector<form::detail::experimental::IndexCell> form_reader_interface::indices(
+    std::string const& creator, std::string const& product_name)
   {
-    return m_pers_reader->listIndices(creator, product_name);
+    return m_pers_reader->listIndexCells(creator, product_name);
   }
 }
@@ -25,11 +25,22 @@ namespace form::experimental {
               std::string const& segment_id,
               product_with_name& product);
 
+    // Reads a product of fundamental type for 'count' consecutive segments, starting with
+    // 'first_segment_id', into 'buffer'; returns the number of segments read.
+    int readBulk(std::string const& creator,
+                 std::string const& product_name,
+                 std::string const& first_segment_id,
+                 int count,
+                 void* buffer,
+                 std::type_info const& type);
+
     void prime(std::string const& creator,
                std::string const& product_name,
                std::type_info const& type);
 
-    std::vector<std::string> indices(std::string const& creator, std::string const& product_name);
+    // The data cells holding the product, in the order written
+    std::vector<form::detail::experimental::IndexCell> indices(std::string const& creator,
+                                                               std::string const& product_name);
 
   private:
     std::unique_ptr<form::detail::experimental::IPersistenceReader> m_pers_reader;
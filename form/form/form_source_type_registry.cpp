@@ -28,7 +28,9 @@ namespace form::experimental {
   void register_form_product_type(std::string product_type,
                                   phlex::detail::type_id type,
                                   std::type_info const& cpp_type,
-                                  form_source_product_from_data_fn product_from_data_fn)
+                                  form_source_product_from_data_fn product_from_data_fn,
+                                  std::size_t bulk_value_size,
+                                  form_source_product_from_value_fn product_from_value_fn)
   {
     if (product_type.empty()) {
       throw std::runtime_error("Cannot register empty FORM product type name");
@@ -36,12 +38,18 @@ namespace form::experimental {
     if (!product_from_data_fn) {
       throw std::runtime_error("Cannot register FORM product type with empty conversion function");
     }
+    if ((bulk_value_size == 0) != !product_from_value_fn) {
+      throw std::runtime_error("Cannot register FORM product type with a bulk value size but no "
+                               "bulk conversion function, or the reverse");
+    }
 
     std::scoped_lock lock(form_type_registry_mutex());
     mutable_form_type_registry()[std::move(product_type)] =
       form_source_type_entry{.type_id = std::move(type),
                              .cpp_type = &cpp_type,
-                             .product_from_data_fn = std::move(product_from_data_fn)};
+                             .product_from_data_fn = std::move(product_from_data_fn),
+                             .bulk_value_size = bulk_value_size,
+                             .product_from_value_fn = std::move(product_from_value_fn)};
   }
 
   // Returns a pointer to the registry entry. The registry is is immutable after the first call to this function.
@@ -87,6 +95,16 @@ namespace form::experimental {
   {
     static std::once_flag once;
     std::call_once(once, [] {
+      register_form_scalar_product_type<int>("int");
+      register_form_scalar_product_type<unsigned int>("unsigned int");
+      register_form_scalar_product_type<long>("long");
+      register_form_scalar_product_type<unsigned long>("unsigned long");
+      register_form_scalar_product_type<long long>("long long");
+      register_form_scalar_product_type<unsigned long long>("unsigned long long");
+      register_form_scalar_product_type<float>("float");
+      register_form_scalar_product_type<double>("double");
+      register_form_scalar_product_type<bool>("bool");
+      register_form_scalar_product_type<char>("char");
       register_form_vector_product_type<int>("std::vector<int>");
       register_form_vector_product_type<unsigned int>("std::vector<unsigned int>");
       register_form_vector_product_type<long>("std::vector<long>");
@@ -6,7 +6,9 @@
 #include "phlex/model/products.hpp"
 #include "phlex/model/type_id.hpp"
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -16,17 +18,25 @@ namespace form::experimental {
 
   using form_source_product_from_data_fn = std::function<phlex::detail::product_ptr(
     void const* data, std::string const& product_name, std::string const& index_str)>;
+  // Makes a product from a copy of one value in a bulk-read buffer, which it does not own
+  using form_source_product_from_value_fn =
+    std::function<phlex::detail::product_ptr(void const* value)>;
 
   struct form_source_type_entry {
     phlex::detail::type_id type_id;
     std::type_info const* cpp_type{nullptr};
     form_source_product_from_data_fn product_from_data_fn;
+    // Only set for fundamental types, which may be read in bulk
+    std::size_t bulk_value_size{0};
+    form_source_product_from_value_fn product_from_value_fn;
   };
 
   void register_form_product_type(std::string product_type,
                                   phlex::detail::type_id type,
                                   std::type_info const& cpp_type,
-                                  form_source_product_from_data_fn product_from_data_fn);
+                                  form_source_product_from_data_fn product_from_data_fn,
+                                  std::size_t bulk_value_size = 0,
+                                  form_source_product_from_value_fn product_from_value_fn = {});
 
   form_source_type_entry const* find_form_product_type(std::string const& product_type);
   std::string const* find_form_product_type_name(phlex::detail::type_id const& type);
@@ -55,6 +65,35 @@ namespace form::experimental {
                                std::move(product_from_data_fn));
   }
 
+  // Registers a fundamental type, whose products the source may read many at a time
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  void register_form_scalar_product_type(std::string product_type)
+  {
+    auto product_from_data_fn = [](void const* data,
+                                   std::string const& product_name,
+                                   std::string const& index_str) -> phlex::detail::product_ptr {
+      if (!data) {
+        throw std::runtime_error("FORM Error: Failed to retrieve product [" + product_name +
+                                 "] for " + index_str);
+      }
+
+      auto ptr = std::unique_ptr<T const>(static_cast<T const*>(data));
+      return phlex::detail::product_for(*ptr);
+    };
+
+    auto product_from_value_fn = [](void const* value) -> phlex::detail::product_ptr {
+      return phlex::detail::product_for(*static_cast<T const*>(value));
+    };
+
+    register_form_product_type(std::move(product_type),
+                               phlex::detail::make_type_id<T>(),
+                               typeid(T),
+                               std::move(product_from_data_fn),
+                               sizeof(T),
+                               std::move(product_from_value_fn));
+  }
+
   template <typename T>
   void register_form_vector_product_type(std::string product_type)
   {
@@ -2,6 +2,8 @@
 
 #include "form_writer.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <iostream>
 #include <stdexcept>
 #include <typeinfo>
@@ -27,50 +29,105 @@ namespace form::experimental {
                                     std::string const& segment_id,
                                     product_with_name const& product)
   {
-
-    auto config_it = m_product_to_config.find(product.label);
-    if (config_it == m_product_to_config.end()) {
-      std::cerr << "No configuration found for product: " << product.label << '\n';
-      return;
-    }
-
-    std::map<std::string, std::type_info const*> products = {{product.label, product.type}};
-    m_pers_writer->createContainers(creator, products);
-
-    m_pers_writer->registerWrite(creator, product.label, product.data, *product.type);
-
-    m_pers_writer->commitOutput(creator, segment_id);
+    writeProducts(creator, segment_id, std::span{&product, 1});
   }
 
   void form_writer_interface::write(std::string const& creator,
                                     std::string const& segment_id,
                                     std::vector<product_with_name> const& products)
   {
+    writeProducts(creator, segment_id, std::span{products});
+  }
 
+  void form_writer_interface::writeProducts(std::string const& creator,
+                                            std::string const& segment_id,
+                                            std::span<product_with_name const> products)
+  {
     if (products.empty()) {
       return;
     }
 
-    auto config_it = m_product_to_config.find(products[0].label);
-    if (config_it == m_product_to_config.end()) {
-      std::cerr << "No configuration found for product: " << products[0].label << '\n';
+    // Usual case: the creator's containers are known and aligned with the products, so only a
+    // shared lock is needed and writes from several threads may proceed concurrently.
+    {
+      std::shared_lock lock(m_mutex);
+      auto const it = m_creators.find(creator);
+      if (it != m_creators.end() && aligned(it->second, products)) {
+        writeAligned(it->second, segment_id, products);
+        return;
+      }
+    }
+
+    std::unique_lock lock(m_mutex);
+    auto* cache = cacheFor(creator, products[0]);
+    if (cache == nullptr) {
       return;
     }
 
-    // FIXME: Really only needed on first call
-    std::map<std::string, std::type_info const*> product_types;
-    for (auto const& pb : products) {
-      product_types.insert(std::make_pair(pb.label, pb.type));
+    // Re-align the cached containers only if the products differ from the previous call.
+    if (!aligned(*cache, products)) {
+      auto& cached = cache->products;
+      cached.clear();
+      for (auto const& pb : products) {
+        // FIXME: We could consider checking id to be identical for all product bases here
+        auto const& [label, container] = containerFor(creator, *cache, pb);
+        cached.emplace_back(label, &container);
+      }
     }
+    writeAligned(*cache, segment_id, products);
+  }
 
-    m_pers_writer->createContainers(creator, product_types);
+  void form_writer_interface::flush()
+  {
+    std::unique_lock lock(m_mutex);
+    m_pers_writer->flushOutput();
+  }
 
-    for (auto const& pb : products) {
-      // FIXME: We could consider checking id to be identical for all product bases here
-      m_pers_writer->registerWrite(creator, pb.label, pb.data, *pb.type);
+  bool form_writer_interface::aligned(creator_cache const& cache,
+                                      std::span<product_with_name const> products)
+  {
+    auto const cached_label = [](auto const& entry) { return entry.first; };
+    return std::ranges::equal(
+      products, cache.products, {}, &product_with_name::label, cached_label);
+  }
+
+  void form_writer_interface::writeAligned(creator_cache const& cache,
+                                           std::string const& segment_id,
+                                           std::span<product_with_name const> products)
+  {
+    for (std::size_t i = 0; i != products.size(); ++i) {
+      m_pers_writer->write(*cache.products[i].second, products[i].data);
+    }
+    m_pers_writer->commitOutput(*cache.containers, segment_id);
+  }
+
+  form_writer_interface::creator_cache* form_writer_interface::cacheFor(
+    std::string const& creator, product_with_name const& first_product)
+  {
+    if (auto it = m_creators.find(creator); it != m_creators.end()) {
+      return &it->second;
     }
 
-    m_pers_writer->commitOutput(creator, segment_id);
+    if (!m_product_to_config.contains(first_product.label)) {
+      std::cerr << "No configuration found for product: " << first_product.label << '\n';
+      return nullptr;
+    }
+
+    auto const& containers = m_pers_writer->createContainers(
+      creator, {{first_product.label, first_product.type}});
+    return &m_creators.emplace(creator, creator_cache{&containers, {}}).first->second;
+  }
+
+  form_writer_interface::labeled_container const& form_writer_interface::containerFor(
+    std::string const& creator, creator_cache& cache, product_with_name const& product)
+  {
+    auto const& products = cache.containers->products;
+    auto it = products.find(product.label);
+    if (it == products.end()) {
+      m_pers_writer->createContainers(creator, {{product.label, product.type}});
+      it = products.find(product.label);
+    }
+    return *it;
   }
 
 }
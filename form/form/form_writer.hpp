@@ -7,13 +7,21 @@
 #include "form/product_with_name.hpp"
 #include "persistence/ipersistence_writer.hpp"
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace form::experimental {
 
+  // Writes may be issued from several threads at once.  The products are then filled into their
+  // containers concurrently, which requires storage supporting concurrent fills (RNTuple with the
+  // "parallel_fill" file attribute); other storage must be written from one thread at a time.
   class form_writer_interface {
   public:
     form_writer_interface(config::ItemConfig const& config_item,
@@ -28,9 +36,42 @@ namespace form::experimental {
                std::string const& segment_id,
                std::vector<product_with_name> const& products);
 
+    // Writes what the storage still buffers; called once every product has been written, and
+    // throws if the output is incomplete.
+    void flush();
+
   private:
+    using product_container = form::detail::experimental::ProductContainer;
+    using labeled_container =
+      decltype(form::detail::experimental::CreatorContainers::products)::value_type;
+
+    // Containers resolved for one creator.  'products' is aligned with the products passed to
+    // the most recent write, so that a creator writing the same products in the same order (the
+    // usual case) needs no lookups.  The label views refer to keys owned by the persistence
+    // writer.
+    struct creator_cache {
+      form::detail::experimental::CreatorContainers const* containers;
+      std::vector<std::pair<std::string_view, product_container const*>> products;
+    };
+
+    void writeProducts(std::string const& creator,
+                       std::string const& segment_id,
+                       std::span<product_with_name const> products);
+    static bool aligned(creator_cache const& cache, std::span<product_with_name const> products);
+    void writeAligned(creator_cache const& cache,
+                      std::string const& segment_id,
+                      std::span<product_with_name const> products);
+
+    creator_cache* cacheFor(std::string const& creator, product_with_name const& first_product);
+    labeled_container const& containerFor(std::string const& creator,
+                                          creator_cache& cache,
+                                          product_with_name const& product);
+
     std::unique_ptr<form::detail::experimental::IPersistenceWriter> m_pers_writer;
     std::map<std::string, form::experimental::config::PersistenceItem> m_product_to_config;
+    std::map<std::string, creator_cache, std::less<>> m_creators;
+    // Guards m_creators and the container creation; held shared while writing
+    std::shared_mutex m_mutex;
   };
 }
 
@@ -0,0 +1,153 @@
+// Copyright (C) 2025 ...
+
+#include "read_ahead.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace form::experimental {
+
+  read_ahead::product_reads::product_reads(phlex::experimental::identifier layer,
+                                           read_function read,
+                                           bulk_read_function read_bulk) :
+    layer{std::move(layer)}, read{std::move(read)}, read_bulk{std::move(read_bulk)}
+  {
+  }
+
+  read_ahead::read_ahead(std::size_t const window, list_function list_cells) :
+    m_window{window}, m_list_cells{std::move(list_cells)}
+  {
+  }
+
+  read_ahead::~read_ahead() { m_reads.wait(); }
+
+  void read_ahead::add_product(std::string const& product,
+                               phlex::experimental::identifier const& layer,
+                               read_function read,
+                               bulk_read_function read_bulk)
+  {
+    m_products.try_emplace(product, layer, std::move(read), std::move(read_bulk));
+  }
+
+  phlex::detail::product_ptr read_ahead::take(std::string const& product, std::string const& index)
+  {
+    std::call_once(m_cells_listed, [this] { list_cells(); });
+    auto& p = m_products.at(product);
+
+    phlex::detail::product_ptr result;
+    std::vector<std::size_t> scheduled;
+    {
+      std::unique_lock lock{p.mutex};
+      // A read in flight is waited for rather than repeated by the caller.
+      p.read_done.wait(lock, [&p, &index] {
+        auto const it = p.outstanding.find(index);
+        return it == p.outstanding.end() or it->second.state != read_state::in_flight;
+      });
+      if (auto it = p.outstanding.find(index); it != p.outstanding.end()) {
+        // A read that has not started yet is withdrawn; its task skips it.
+        result = std::move(it->second.product);
+        p.outstanding.erase(it);
+      }
+      if (auto const position = m_positions.find(index); position != m_positions.end()) {
+        scheduled = schedule_after(p, position->second);
+      }
+    }
+
+    // One task per read, or per run of consecutive data cells for bulk reads
+    for (auto first = scheduled.begin(); first != scheduled.end();) {
+      auto last = std::next(first);
+      while (p.read_bulk and last != scheduled.end() and *last == *std::prev(last) + 1) {
+        ++last;
+      }
+      m_reads.run([this, &p, positions = std::vector(first, last)] { perform_reads(p, positions); });
+      first = last;
+    }
+    return result;
+  }
+
+  void read_ahead::wait() { m_reads.wait(); }
+
+  void read_ahead::list_cells()
+  {
+    m_cells = m_list_cells();
+    for (std::size_t position = 0; position != m_cells.size(); ++position) {
+      if (not m_cells[position].index.empty()) {
+        m_positions.emplace(m_cells[position].index, position);
+      }
+    }
+  }
+
+  std::vector<std::size_t> read_ahead::schedule_after(product_reads& p, std::size_t const position)
+  {
+    std::vector<std::size_t> result;
+    auto const end = std::min(m_cells.size(), position + 1 + m_window);
+    auto next = std::max(p.next_position, position + 1);
+    for (; next < end and p.outstanding.size() < m_window; ++next) {
+      auto const& cell = m_cells[next];
+      if (cell.index.empty() or cell.layer != p.layer or
+          not p.outstanding.try_emplace(cell.index).second) {
+        continue;
+      }
+      result.push_back(next);
+    }
+    p.next_position = std::max(p.next_position, next);
+    return result;
+  }
+
+  void read_ahead::perform_reads(product_reads& p, std::vector<std::size_t> const& positions)
+  {
+    // Only the reads that have not been withdrawn in the meantime are performed.
+    std::vector<std::size_t> claimed;
+    {
+      std::scoped_lock lock{p.mutex};
+      for (auto const position : positions) {
+        auto it = p.outstanding.find(m_cells[position].index);
+        if (it != p.outstanding.end() and it->second.state == read_state::scheduled) {
+          it->second.state = read_state::in_flight;
+          claimed.push_back(position);
+        }
+      }
+    }
+
+    // A withdrawn read splits a bulk read into runs of consecutive data cells.
+    for (auto first = claimed.begin(); first != claimed.end();) {
+      auto last = std::next(first);
+      while (last != claimed.end() and *last == *std::prev(last) + 1) {
+        ++last;
+      }
+      std::vector<std::size_t> const run(first, last);
+      std::vector<phlex::detail::product_ptr> products;
+      try {
+        if (p.read_bulk) {
+          products = p.read_bulk(m_cells[run.front()].index, run.size());
+        } else {
+          products.push_back(p.read(m_cells[run.front()].index));
+        }
+      } catch (...) {
+        // Left to the provider's own read, which reports the error where it belongs.
+      }
+      store(p, run, products);
+      first = last;
+    }
+  }
+
+  void read_ahead::store(product_reads& p,
+                         std::vector<std::size_t> const& positions,
+                         std::vector<phlex::detail::product_ptr>& products)
+  {
+    {
+      std::scoped_lock lock{p.mutex};
+      for (std::size_t i = 0; i != positions.size(); ++i) {
+        auto it = p.outstanding.find(m_cells[positions[i]].index);
+        if (i < products.size() and products[i]) {
+          it->second.product = std::move(products[i]);
+          it->second.state = read_state::done;
+        } else {
+          p.outstanding.erase(it);
+        }
+      }
+    }
+    p.read_done.notify_all();
+  }
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_FORM_READ_AHEAD_HPP
+#define FORM_FORM_READ_AHEAD_HPP
+
+#include "phlex/model/identifier.hpp"
+#include "phlex/model/products.hpp"
+
+#include "oneapi/tbb/task_group.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace form::experimental {
+
+  // Reads products ahead of the providers that will ask for them.  Data cells are assumed to
+  // reach the providers roughly in the order in which they were written, so a provider call for
+  // one data cell schedules reads of the same product for the next `window` data cells of the
+  // product's layer in the file.  The reads run as TBB tasks in the arena of the provider that
+  // scheduled them, and their results are held until the providers take them.
+  //
+  // At most `window` reads per product are outstanding (scheduled, in flight, or read but not
+  // yet taken).  Once that bound is reached nothing more is scheduled for the product until its
+  // providers catch up.  A provider that asks for a product whose read has not started yet
+  // withdraws it and reads the product itself; one whose read is in flight waits for it, so a
+  // product is never read twice.  A prefetched product that is never asked for therefore costs
+  // memory but cannot stall processing.
+  //
+  // Products of fundamental type are read in bulk: the scheduled reads of consecutive data cells
+  // in the file are performed together, with one read of the product's column.
+  class read_ahead {
+  public:
+    struct cell {
+      std::string index;
+      phlex::experimental::identifier layer;
+    };
+
+    using read_function = std::function<phlex::detail::product_ptr(std::string const& index)>;
+    // Reads the product for `count` consecutive data cells, starting with `first_index`; fewer
+    // products are returned at the end of the file.
+    using bulk_read_function = std::function<std::vector<phlex::detail::product_ptr>(
+      std::string const& first_index, std::size_t count)>;
+    // Lists the data cells of the file in file order; an entry with an empty index stands for
+    // an id that does not name a data cell.  Called once, on first use.
+    using list_function = std::function<std::vector<cell>()>;
+
+    read_ahead(std::size_t window, list_function list_cells);
+    // Waits for the reads in flight
+    ~read_ahead();
+
+    read_ahead(read_ahead const&) = delete;
+    read_ahead& operator=(read_ahead const&) = delete;
+
+    // Must not be called concurrently with take(); all products are added before processing.
+    void add_product(std::string const& product,
+                     phlex::experimental::identifier const& layer,
+                     read_function read,
+                     bulk_read_function read_bulk = {});
+
+    // Returns the prefetched product for `index`, or nullptr if the caller must read it itself,
+    // and schedules reads of the product for the data cells that follow `index` in the file.
+    phlex::detail::product_ptr take(std::string const& product, std::string const& index);
+
+    // Waits until no scheduled read is left
+    void wait();
+
+  private:
+    enum class read_state { scheduled, in_flight, done };
+
+    struct outstanding_read {
+      read_state state{read_state::scheduled};
+      phlex::detail::product_ptr product;
+    };
+
+    struct product_reads {
+      product_reads(phlex::experimental::identifier layer,
+                    read_function read,
+                    bulk_read_function read_bulk);
+
+      phlex::experimental::identifier const layer;
+      read_function const read;
+      bulk_read_function const read_bulk; // Empty unless the product may be read in bulk
+
+      std::mutex mutex;
+      std::condition_variable read_done;
+      // First file position not yet considered for scheduling
+      std::size_t next_position{};
+      std::unordered_map<std::string, outstanding_read> outstanding;
+    };
+
+    void list_cells();
+    // Schedules reads of the product for the data cells after the given file position; returns
+    // the file positions scheduled.  Requires p.mutex to be held.
+    std::vector<std::size_t> schedule_after(product_reads& p, std::size_t position);
+    void perform_reads(product_reads& p, std::vector<std::size_t> const& positions);
+    void store(product_reads& p,
+               std::vector<std::size_t> const& positions,
+               std::vector<phlex::detail::product_ptr>& products);
+
+    std::size_t const m_window;
+    list_function const m_list_cells;
+
+    std::once_flag m_cells_listed;
+    std::vector<cell> m_cells;
+    std::unordered_map<std::string, std::size_t> m_positions;
+
+    std::map<std::string, product_reads> m_products;
+    tbb::task_group m_reads;
+  };
+}
+
+#endif // FORM_FORM_READ_AHEAD_HPP
@@ -8,10 +8,19 @@
 #include "form/config.hpp"
 #include "form/form_writer.hpp"
 
+#include "oneapi/tbb/concurrent_queue.h"
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <exception>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -19,12 +28,22 @@ namespace {
   public:
     FormOutputModule(std::string output_file,
                      form::technology::Id technology,
-                     std::vector<std::string> const& products_to_save) :
-      m_output_file(std::move(output_file)), m_technology(technology)
+                     std::vector<std::string> const& products_to_save,
+                     std::size_t queue_depth,
+                     std::size_t write_concurrency,
+                     bool root_implicit_mt) :
+      m_output_file(std::move(output_file)),
+      m_technology(technology),
+      // Concurrent writes are made directly by the output node's threads.
+      m_queue_depth(write_concurrency > 1 ? 0 : queue_depth)
     {
       std::cout << "FormOutputModule initialized\n";
       std::cout << "  Output file: " << m_output_file << "\n";
       std::cout << "  Technology: " << form::technology::to_string(m_technology) << "\n";
+      std::cout << "  Queue depth: " << m_queue_depth
+                << (m_queue_depth == 0 ? " (synchronous)" : "") << "\n";
+      std::cout << "  Write concurrency: " << write_concurrency << "\n";
+      std::cout << "  ROOT implicit MT: " << (root_implicit_mt ? "enabled" : "disabled") << "\n";
 
       // Build FORM configuration
       form::experimental::config::ItemConfig output_cfg;
@@ -40,19 +59,126 @@ namespace {
         output_cfg.addItem(product, m_output_file, m_technology);
       }
 
+      // Only RNTuple supports filling from several threads at once: each thread fills (and
+      // compresses) its own clusters.
+      if (write_concurrency > 1) {
+        if (m_technology != form::technology::ROOT_RNTUPLE) {
+          throw std::runtime_error("FormOutputModule: write_concurrency > 1 requires the "
+                                   "ROOT_RNTUPLE technology, not " +
+                                   form::technology::to_string(m_technology));
+        }
+        tech_cfg.file_settings[m_technology][m_output_file].emplace_back("parallel_fill", "true");
+      }
+
+      // ROOT compresses baskets and pages in parallel, using no more threads than Phlex may.
+      if (root_implicit_mt) {
+        if (m_technology.major != form::technology::Major::root) {
+          throw std::runtime_error("FormOutputModule: root_implicit_mt requires a ROOT technology, "
+                                   "not " +
+                                   form::technology::to_string(m_technology));
+        }
+        tech_cfg.file_settings[m_technology][m_output_file].emplace_back("implicit_mt", "true");
+      }
+
       // Initialize FORM interface
       m_form_interface =
         std::make_unique<form::experimental::form_writer_interface>(output_cfg, tech_cfg);
+
+      // With a non-zero queue depth, stores are handed to a dedicated writer thread so that
+      // persistence is taken off the critical path of the output node.  The bounded queue
+      // provides back-pressure: the output node blocks only when the writer has fallen
+      // queue_depth stores behind.
+      if (m_queue_depth != 0) {
+        m_queue.set_capacity(static_cast<std::ptrdiff_t>(m_queue_depth));
+        m_writer = std::thread{[this] { drain(); }};
+      }
+    }
+
+    FormOutputModule(FormOutputModule const&) = delete;
+    FormOutputModule& operator=(FormOutputModule const&) = delete;
+    FormOutputModule(FormOutputModule&&) = delete;
+    FormOutputModule& operator=(FormOutputModule&&) = delete;
+
+    ~FormOutputModule()
+    {
+      // Only reached with a running writer if the job failed before it ended, in which case
+      // the job's error has already been reported.
+      stop_writer();
+      std::cout << "FormOutputModule wrote " << m_stores_written.load() << " product stores to "
+                << m_output_file << "\n";
     }
 
-    // This method is called by Phlex - signature must be: void(product_store const&)
-    void save_data_products(phlex::experimental::product_store const& store)
+    // Called by Phlex for each product store.  Taking the store's shared pointer lets the writer
+    // thread keep the store's products alive until it has persisted them.
+    void save_data_products(phlex::experimental::product_store_const_ptr const& store)
     {
       // Check if store is empty - smart way, check store not products vector
-      if (store.empty()) {
+      if (store->empty()) {
         return;
       }
 
+      if (m_queue_depth == 0) {
+        write(*store);
+        return;
+      }
+
+      // Report a failure of the writer thread at the earliest opportunity.
+      if (m_writer_failed.load(std::memory_order_acquire)) {
+        std::rethrow_exception(m_writer_error);
+      }
+
+      m_queue.push(store);
+    }
+
+    // Called by Phlex once every store has been handed over: the writes still queued are
+    // completed and the output is flushed, and a failure of either fails the job.
+    void finish()
+    {
+      stop_writer();
+      if (m_writer_error) {
+        std::rethrow_exception(m_writer_error);
+      }
+      m_form_interface->flush();
+    }
+
+  private:
+    void stop_writer()
+    {
+      if (m_writer.joinable()) {
+        // A null store tells the writer thread that no more stores will arrive.
+        m_queue.push(nullptr);
+        m_writer.join();
+      }
+    }
+
+    // Runs on the writer thread: writes the stores in the order they were queued, until the null
+    // sentinel is received.  Each store is still written (and committed) on its own, as FORM
+    // commits one entry per data cell; the thread only takes that work off the output node.
+    void drain()
+    {
+      while (true) {
+        phlex::experimental::product_store_const_ptr store;
+        m_queue.pop(store);
+        if (not store) {
+          return;
+        }
+
+        // After a failure, stores are still drained (so that the output node never blocks on a
+        // full queue) but are no longer written.
+        if (m_writer_failed.load(std::memory_order_relaxed)) {
+          continue;
+        }
+        try {
+          write(*store);
+        } catch (...) {
+          m_writer_error = std::current_exception();
+          m_writer_failed.store(true, std::memory_order_release);
+        }
+      }
+    }
+
+    void write(phlex::experimental::product_store const& store)
+    {
       // STEP 1: Extract metadata from Phlex's product_store
 
       // Extract creator (algorithm name)
@@ -61,11 +187,6 @@ namespace {
       // Extract segment ID (partition) - extract once for entire store
       auto segment_id = store.index()->to_string();
 
-      std::cout << "\n=== FormOutputModule::save_data_products ===\n";
-      std::cout << "Creator: " << creator.to_string() << "\n";
-      std::cout << "Segment ID: " << segment_id << "\n";
-      std::cout << "Number of products: " << store.size() << "\n";
-
       // STEP 2: Convert each Phlex product to FORM format
 
       // Collect all products for writing
@@ -80,8 +201,6 @@ namespace {
         // product_ptr: pointer to the actual product data
         assert(product_ptr && "store should not contain null product_ptr");
 
-        std::cout << "  Product: " << product_spec.to_string() << "\n";
-
         // Create FORM product with metadata
         products.emplace_back(product_spec.suffix().trans_get_string(), // label, from map key
                               product_ptr->address(), // data,  from phlex product_base
@@ -95,16 +214,23 @@ namespace {
       // Pass segment_id once for entire collection (not duplicated in each product)
       // No need to check if products is empty - already checked store.empty() above
       m_form_interface->write(creator.to_string(), segment_id, products);
-      std::cout << "Wrote " << products.size() << " products to FORM\n";
+      m_stores_written.fetch_add(1, std::memory_order_relaxed);
     }
 
-  private:
     // Algorithm configuration fixed at construction; intentionally immutable for object lifetime.
     // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
     std::string const m_output_file;
     form::technology::Id const m_technology;
+    std::size_t const m_queue_depth;
     // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
     std::unique_ptr<form::experimental::form_writer_interface> m_form_interface;
+
+    // Asynchronous output (only used when m_queue_depth is non-zero)
+    tbb::concurrent_bounded_queue<phlex::experimental::product_store_const_ptr> m_queue;
+    std::exception_ptr m_writer_error;
+    std::atomic<bool> m_writer_failed{false};
+    std::atomic<std::size_t> m_stores_written{};
+    std::thread m_writer;
   };
 
 }
@@ -125,13 +251,30 @@ PHLEX_REGISTER_ALGORITHMS(m, config)
 
   auto products_to_save = config.get<std::vector<std::string>>("products");
 
+  // Number of product stores that may be queued for a writer thread; 0 (the default) writes
+  // synchronously from within the output node.
+  auto const queue_depth = config.get<std::size_t>("queue_depth", 0);
+  std::cout << "  queue_depth: " << queue_depth << "\n";
+
+  // Number of product stores that may be written at the same time (ROOT_RNTUPLE only); above 1,
+  // writes bypass the queue.
+  auto const write_concurrency = config.get<std::size_t>("write_concurrency", 1);
+  std::cout << "  write_concurrency: " << write_concurrency << "\n";
+
+  // Whether ROOT may compress output in parallel, within Phlex's limit on the number of threads
+  auto const root_implicit_mt = config.get<bool>("root_implicit_mt", false);
+
   // Phlex needs an OBJECT
   // Create the FORM output module
-  auto form_output = m.make<FormOutputModule>(output_file, technology, products_to_save);
+  auto form_output = m.make<FormOutputModule>(
+    output_file, technology, products_to_save, queue_depth, write_concurrency, root_implicit_mt);
 
   // Phlex needs a MEMBER FUNCTION to call
   // Register the callback that Phlex will invoke
-  form_output.output("save_data_products", &FormOutputModule::save_data_products);
+  form_output.output("save_data_products",
+                     &FormOutputModule::save_data_products,
+                     phlex::concurrency{std::max<std::size_t>(write_concurrency, 1)})
+    .end_of_job(&FormOutputModule::finish);
 
   std::cout << "FORM output module registered successfully\n";
 }
@@ -4,13 +4,14 @@
 #include "form/config.hpp"
 #include "form/form_reader.hpp"
 #include "form/form_source_type_registry.hpp"
+#include "form/read_ahead.hpp"
 
 #include "phlex/model/data_cell_index.hpp"
 
-#include <cassert>
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
 #include <memory>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -18,43 +19,18 @@
 
 namespace {
 
-  phlex::data_cell_index_ptr parse_index_string(std::string const& index_string)
-  {
-    if (index_string == "[]") {
-      return phlex::data_cell_index::job();
-    }
+  using form::experimental::read_ahead;
 
-    if (index_string.size() < 2 || index_string.front() != '[' || index_string.back() != ']') {
-      throw std::runtime_error("Unsupported FORM index format: " + index_string);
+  // The data cell of an index row, or null if the row's id does not name one
+  phlex::data_cell_index_ptr make_index(form::detail::experimental::IndexCell const& cell)
+  {
+    if (!cell.layers) {
+      return nullptr;
     }
 
     auto current = phlex::data_cell_index::job();
-    std::string const body = index_string.substr(1, index_string.size() - 2);
-    std::stringstream ss{body};
-    std::string component;
-    while (std::getline(ss, component, ',')) {
-      auto const first = component.find_first_not_of(' ');
-      if (first == std::string::npos) {
-        continue;
-      }
-      auto const trimmed = component.substr(first, component.find_last_not_of(' ') - first + 1);
-      auto const colon = trimmed.find(':');
-      if (colon == std::string::npos || colon == 0 || colon == trimmed.size() - 1) {
-        throw std::runtime_error("Unsupported FORM index component: " + trimmed);
-      }
-      std::string const layer = trimmed.substr(0, colon);
-      std::string const number_str = trimmed.substr(colon + 1);
-      std::size_t number = 0;
-      try {
-        std::size_t pos = 0;
-        number = std::stoull(number_str, &pos);
-        if (pos != number_str.size()) {
-          throw std::runtime_error("Unsupported FORM index component: " + trimmed);
-        }
-      } catch (std::exception const&) {
-        throw std::runtime_error("Unsupported FORM index component: " + trimmed);
-      }
-      current = current->make_child(layer, number);
+    for (std::size_t i = 0; i != cell.layers->size(); ++i) {
+      current = current->make_child((*cell.layers)[i], cell.numbers[i]);
     }
     return current;
   }
@@ -65,7 +41,8 @@ namespace {
                     form::experimental::config::tech_setting_config const& tech_cfg,
                     std::string actual_creator,
                     std::string advertised_creator,
-                    std::vector<std::string> const& products) :
+                    std::vector<std::string> const& products,
+                    std::size_t const prefetch_window) :
       reader_(std::make_shared<form::experimental::form_reader_interface>(input_cfg, tech_cfg)),
       actual_creator_(std::move(actual_creator)),
       advertised_creator_(std::move(advertised_creator)),
@@ -73,6 +50,21 @@ namespace {
     {
       // Ensure all builtin types are registered for dynamic dispatch
       form::experimental::ensure_builtin_form_product_types_registered();
+
+      if (prefetch_window > 0 and not products_.empty()) {
+        read_ahead_ = std::make_unique<read_ahead>(prefetch_window, [this] {
+          std::vector<read_ahead::cell> cells;
+          for (auto const& cell : reader_->indices(actual_creator_, products_.front())) {
+            if (auto const index = make_index(cell)) {
+              cells.push_back({index->to_string(), index->layer_name()});
+            } else {
+              // Ids that do not name a data cell are never asked for by a provider.
+              cells.emplace_back();
+            }
+          }
+          return cells;
+        });
+      }
     }
 
     phlex::detail::provider_bundles create_providers(
@@ -107,14 +99,41 @@ namespace {
 
         reader_->prime(actual_creator_, name, *selected_entry->cpp_type);
 
-        auto provider_func = [this, name, product_type = *product_type_name](
+        if (read_ahead_) {
+          read_ahead::bulk_read_function read_bulk;
+          if (selected_entry->bulk_value_size != 0) {
+            read_bulk = [this, name, selected_entry](std::string const& first_index,
+                                                     std::size_t const count) {
+              return this->read_products_in_bulk(
+                actual_creator_, name, first_index, count, *selected_entry);
+            };
+          }
+          read_ahead_->add_product(
+            name,
+            selector_layer,
+            [this, name, selected_entry](std::string const& index_str) {
+              return this->read_product_from_form(
+                actual_creator_, name, index_str, *selected_entry);
+            },
+            std::move(read_bulk));
+        }
+
+        // FORM reads are safe to issue concurrently, so the provider is not serialized.
+        auto provider_func = [this, name, selected_entry](
                                phlex::data_cell_index const& id) -> phlex::detail::product_ptr {
-          return this->read_product_from_form(actual_creator_, name, id.to_string(), product_type);
+          auto const index_str = id.to_string();
+          if (not read_ahead_) {
+            return this->read_product_from_form(actual_creator_, name, index_str, *selected_entry);
+          }
+          auto product = read_ahead_->take(name, index_str);
+          return product ? std::move(product)
+                         : this->read_product_from_form(
+                             actual_creator_, name, index_str, *selected_entry);
         };
 
         bundles.push_back(
           phlex::detail::provider_bundle{.provider_function = provider_func,
-                                         .max_concurrency = phlex::concurrency::serial,
+                                         .max_concurrency = phlex::concurrency::unlimited,
                                          .spec = std::move(spec),
                                          .layer = std::string(selector_layer.trans_get_string()),
                                          .stage = std::string(selector_stage.trans_get_string())});
@@ -130,25 +149,54 @@ namespace {
         co_return;
       }
 
-      for (auto const& index_string : reader_->indices(actual_creator_, products_.front())) {
-        co_yield parse_index_string(index_string);
+      for (auto const& cell : reader_->indices(actual_creator_, products_.front())) {
+        auto index = make_index(cell);
+        if (!index) {
+          throw std::runtime_error("Unsupported FORM index entry for creator: " + actual_creator_);
+        }
+        co_yield std::move(index);
       }
     }
 
-    phlex::detail::product_ptr read_product_from_form(std::string const& creator,
-                                                      std::string const& product_name,
-                                                      std::string const& index_str,
-                                                      std::string const& product_type)
+    // The type entry is looked up once, when the provider is created, rather than per read.
+    phlex::detail::product_ptr read_product_from_form(
+      std::string const& creator,
+      std::string const& product_name,
+      std::string const& index_str,
+      form::experimental::form_source_type_entry const& entry)
     {
-      form::experimental::form_source_type_entry const* entry =
-        form::experimental::find_form_product_type(product_type);
-      if (entry && entry->cpp_type && entry->product_from_data_fn) {
+      if (entry.cpp_type && entry.product_from_data_fn) {
         form::experimental::product_with_name pb{
-          .label = product_name, .data = nullptr, .type = entry->cpp_type};
+          .label = product_name, .data = nullptr, .type = entry.cpp_type};
         reader_->read(creator, index_str, pb);
-        return entry->product_from_data_fn(pb.data, product_name, index_str);
+        return entry.product_from_data_fn(pb.data, product_name, index_str);
       }
-      throw std::runtime_error("Unsupported FORM product type: " + product_type);
+      throw std::runtime_error("Unsupported FORM product type for product: " + product_name);
+    }
+
+    // Reads a product of fundamental type for `count` consecutive data cells with one bulk read;
+    // fewer products are returned at the end of the file.  A product shares its row with the
+    // creator's index entry, so consecutive data cells occupy consecutive rows.
+    std::vector<phlex::detail::product_ptr> read_products_in_bulk(
+      std::string const& creator,
+      std::string const& product_name,
+      std::string const& first_index,
+      std::size_t const count,
+      form::experimental::form_source_type_entry const& entry)
+    {
+      std::vector<std::byte> buffer(count * entry.bulk_value_size);
+      auto const rows = static_cast<std::size_t>(reader_->readBulk(creator,
+                                                                   product_name,
+                                                                   first_index,
+                                                                   static_cast<int>(count),
+                                                                   buffer.data(),
+                                                                   *entry.cpp_type));
+      std::vector<phlex::detail::product_ptr> result;
+      result.reserve(rows);
+      for (std::size_t i = 0; i != rows; ++i) {
+        result.push_back(entry.product_from_value_fn(buffer.data() + i * entry.bulk_value_size));
+      }
+      return result;
     }
 
   private:
@@ -156,6 +204,8 @@ namespace {
     std::string actual_creator_;
     std::string advertised_creator_;
     std::vector<std::string> products_;
+    // Declared last so that the reads in flight finish before the reader they use is destroyed
+    std::unique_ptr<read_ahead> read_ahead_;
   };
 }
 
@@ -168,6 +218,10 @@ PHLEX_REGISTER_SOURCE(s, config)
   auto const tech_string = config.get<std::string>("technology", "ROOT_TTREE");
   auto const module_label = config.get<std::string>("module_label", "form_source");
   auto const products = config.get<std::vector<std::string>>("products");
+  // Number of data cells per product read ahead of the providers; 0 disables read-ahead
+  auto const prefetch_window = config.get<std::size_t>("prefetch_window", 0);
+  // Whether ROOT may decompress input in parallel, within Phlex's limit on the number of threads
+  auto const root_implicit_mt = config.get<bool>("root_implicit_mt", false);
 
   std::string actual_creator = advertised_creator;
   auto const algorithm = config.get_if_present<std::string>("algorithm");
@@ -183,10 +237,23 @@ PHLEX_REGISTER_SOURCE(s, config)
   for (auto const& name : products) {
     input_cfg.addItem(name, input_file, technology);
   }
+  if (root_implicit_mt) {
+    if (technology.major != form::technology::Major::root) {
+      throw std::runtime_error("FORM input source: root_implicit_mt requires a ROOT technology, "
+                               "not " +
+                               tech_string);
+    }
+    tech_cfg.file_settings[technology][input_file].emplace_back("implicit_mt", "true");
+  }
 
   // Register the source object with Phlex
-  s.add_source<FormInputSource>(
-    module_label, input_cfg, tech_cfg, actual_creator, advertised_creator, products);
+  s.add_source<FormInputSource>(module_label,
+                                input_cfg,
+                                tech_cfg,
+                                actual_creator,
+                                advertised_creator,
+                                products,
+                                prefetch_window);
 
   std::cout << "FORM input source registered successfully\n";
 }
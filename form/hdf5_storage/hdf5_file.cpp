@@ -0,0 +1,31 @@
+// Copyright (C) 2025 ...
+
+#include "hdf5_file.hpp"
+
+using namespace form::detail::experimental;
+
+HDF5_FileImp::HDF5_FileImp(std::string const& name, char mode) :
+  Storage_File(name, mode), m_writable(mode == 'c' || mode == 'r' || mode == 'o')
+{
+  hdf5::Lock const lock;
+  if (m_writable) {
+    m_file = hdf5::Handle{
+      hdf5::check(H5Fcreate(name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT),
+                  "unable to create " + name),
+      &H5Fclose};
+  } else {
+    m_file = hdf5::Handle{hdf5::check(H5Fopen(name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT),
+                                      "unable to open " + name),
+                          &H5Fclose};
+  }
+}
+
+HDF5_FileImp::~HDF5_FileImp()
+{
+  hdf5::Lock const lock;
+  m_file.reset();
+}
+
+bool HDF5_FileImp::writable() const { return m_writable; }
+
+hid_t HDF5_FileImp::id() const { return m_file.get(); }
@@ -0,0 +1,37 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_HDF5_STORAGE_HDF5_FILE_HPP
+#define FORM_HDF5_STORAGE_HDF5_FILE_HPP
+
+#include "hdf5_utils.hpp"
+
+#include "storage/storage_file.hpp"
+
+#include <string>
+
+namespace form::detail::experimental {
+
+  // An HDF5 file (see hdf5_utils.hpp for the layout), opened either for writing, replacing any
+  // existing file, or for reading.
+  class HDF5_FileImp : public Storage_File {
+  public:
+    HDF5_FileImp(std::string const& name, char mode);
+    ~HDF5_FileImp() override;
+
+    HDF5_FileImp(HDF5_FileImp const&) = delete;
+    HDF5_FileImp& operator=(HDF5_FileImp const&) = delete;
+    HDF5_FileImp(HDF5_FileImp&&) = delete;
+    HDF5_FileImp& operator=(HDF5_FileImp&&) = delete;
+
+    bool writable() const;
+    // Only to be used while an hdf5::Lock is held
+    hid_t id() const;
+
+  private:
+    bool m_writable;
+    hdf5::Handle m_file;
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_HDF5_STORAGE_HDF5_FILE_HPP
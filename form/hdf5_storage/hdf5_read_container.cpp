@@ -0,0 +1,250 @@
+// Copyright (C) 2025 ...
+
+#include "hdf5_read_container.hpp"
+#include "hdf5_file.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace form::detail::experimental;
+
+namespace {
+  std::string readTypeAttribute(hid_t location, std::string const& path)
+  {
+    hdf5::Handle const attribute{
+      hdf5::check(H5Aopen_by_name(location, path.c_str(), "form_type", H5P_DEFAULT, H5P_DEFAULT),
+                  "no form_type attribute for " + path),
+      &H5Aclose};
+    hdf5::Handle const type{hdf5::check(H5Aget_type(attribute.get()), "unable to get type"),
+                            &H5Tclose};
+    if (H5Tget_class(type.get()) != H5T_STRING || H5Tis_variable_str(type.get()) != 0) {
+      throw std::runtime_error("FORM HDF5: unexpected form_type attribute for " + path);
+    }
+    std::string result(H5Tget_size(type.get()), '\0');
+    hdf5::check(H5Aread(attribute.get(), type.get(), result.data()),
+                "unable to read form_type attribute of " + path);
+    return result;
+  }
+
+  hsize_t extent(hdf5::Handle const& dataset, std::string const& path)
+  {
+    hdf5::Handle const space{
+      hdf5::check(H5Dget_space(dataset.get()), "unable to get dataspace of " + path), &H5Sclose};
+    if (H5Sget_simple_extent_ndims(space.get()) != 1) {
+      throw std::runtime_error("FORM HDF5: " + path + " is not a one-dimensional dataset");
+    }
+    hsize_t size{};
+    hdf5::check(H5Sget_simple_extent_dims(space.get(), &size, nullptr),
+                "unable to get extent of " + path);
+    return size;
+  }
+
+  hsize_t chunkRows(hdf5::Handle const& dataset)
+  {
+    hdf5::Handle const creation_list{
+      hdf5::check(H5Dget_create_plist(dataset.get()), "unable to get property list"), &H5Pclose};
+    hsize_t chunk{};
+    if (H5Pget_layout(creation_list.get()) != H5D_CHUNKED ||
+        H5Pget_chunk(creation_list.get(), 1, &chunk) != 1) {
+      // Not written by FORM; any reasonable block size will do.
+      return 4096;
+    }
+    return chunk;
+  }
+}
+
+HDF5_Read_ContainerImp::HDF5_Read_ContainerImp(std::string const& name) :
+  Storage_Read_Container(name)
+{
+}
+
+HDF5_Read_ContainerImp::~HDF5_Read_ContainerImp()
+{
+  hdf5::Lock const lock;
+  m_values.reset();
+  m_offsets.reset();
+}
+
+void HDF5_Read_ContainerImp::setFile(std::shared_ptr<IStorage_File> file)
+{
+  this->Storage_Read_Container::setFile(file);
+  m_file = std::dynamic_pointer_cast<HDF5_FileImp>(file);
+  if (m_file == nullptr || m_file->writable()) {
+    throw std::runtime_error(
+      "HDF5_Read_ContainerImp::setFile can't attach to a file not opened for reading");
+  }
+
+  hdf5::Lock const lock;
+  // A missing container is only reported when the container is used.
+  if (!hdf5::pathExists(m_file->id(), name())) {
+    return;
+  }
+  auto const type_name = readTypeAttribute(m_file->id(), name());
+  auto const* type = hdf5::elementType(type_name);
+  if (type == nullptr) {
+    throw std::runtime_error("HDF5_Read_ContainerImp::setFile unknown type " + type_name +
+                             " of " + name());
+  }
+
+  auto const open = [this](std::string const& path) {
+    return hdf5::Handle{hdf5::check(H5Dopen2(m_file->id(), path.c_str(), H5P_DEFAULT),
+                                    "unable to open dataset " + path),
+                        &H5Dclose};
+  };
+  if (type->variable) {
+    m_offsets = open(name() + "/offsets");
+    m_values = open(name() + "/values");
+    m_rows = extent(m_offsets, name());
+    m_valueCount = extent(m_values, name());
+    m_blockRows = chunkRows(m_offsets);
+  } else {
+    m_values = open(name());
+    m_rows = extent(m_values, name());
+    m_blockRows = chunkRows(m_values);
+  }
+  m_type = type;
+}
+
+void HDF5_Read_ContainerImp::prime(std::type_info const& type)
+{
+  hdf5::Lock const lock;
+  checkType(type, "prime");
+}
+
+bool HDF5_Read_ContainerImp::read(int id, void const** data, std::type_info const& type)
+{
+  hdf5::Lock const lock;
+  checkType(type, "read");
+  if (id < 0 || static_cast<std::uint64_t>(id) >= m_rows) {
+    return false;
+  }
+
+  auto const row = static_cast<std::uint64_t>(id);
+  if (row < m_blockFirst || row >= m_blockFirst + m_blockSize) {
+    loadBlock(row);
+  }
+  auto const index = row - m_blockFirst;
+  auto const element_size = m_type->element_size;
+  if (!m_type->variable) {
+    *data = m_type->create(std::span{m_block}.subspan(index * element_size, element_size));
+  } else {
+    auto const begin = m_blockOffsets[index];
+    auto const end = m_blockOffsets[index + 1];
+    *data = m_type->create(
+      std::span{m_block}.subspan(begin * element_size, (end - begin) * element_size));
+  }
+  return true;
+}
+
+int HDF5_Read_ContainerImp::readBulk(int first, int count, void* buffer, std::type_info const& type)
+{
+  hdf5::Lock const lock;
+  checkType(type, "readBulk");
+  if (m_type->variable) {
+    throw std::runtime_error("HDF5_Read_ContainerImp::readBulk " + name() +
+                             " does not hold a fundamental type");
+  }
+  if (first < 0 || count <= 0 || static_cast<std::uint64_t>(first) >= m_rows) {
+    return 0;
+  }
+  auto const begin = static_cast<std::uint64_t>(first);
+  auto const rows = std::min(m_rows - begin, static_cast<std::uint64_t>(count));
+  readRows(m_values, m_type->handle, begin, rows, buffer);
+  return static_cast<int>(rows);
+}
+
+int HDF5_Read_ContainerImp::entries()
+{
+  hdf5::Lock const lock;
+  checkType(typeid(void), "entries");
+  if (m_rows > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+    throw std::runtime_error("HDF5_Read_ContainerImp::entries too many rows in " + name());
+  }
+  return static_cast<int>(m_rows);
+}
+
+void HDF5_Read_ContainerImp::setAttribute(std::string const& key, std::string const& value)
+{
+  if (key == "read_rows") {
+    auto const rows = std::stoull(value);
+    if (rows == 0) {
+      throw std::runtime_error("HDF5_Read_ContainerImp: read_rows must be positive");
+    }
+    hdf5::Lock const lock;
+    m_blockRows = rows;
+    m_blockSize = 0;
+  } else {
+    throw std::runtime_error("HDF5_Read_ContainerImp accepts some attributes, but not " + key);
+  }
+}
+
+// Requires the hdf5::Lock to be held.  typeid(void) only checks that the container exists.
+void HDF5_Read_ContainerImp::checkType(std::type_info const& type, std::string const& caller)
+{
+  if (m_file == nullptr) {
+    throw std::runtime_error("HDF5_Read_ContainerImp::" + caller + " no file attached");
+  }
+  if (m_type == nullptr) {
+    throw container_not_found("HDF5_Read_ContainerImp::" + caller +
+                              " no container found with name " + name() + " in " +
+                              m_file->name());
+  }
+  if (type != typeid(void) && *m_type->type != type) {
+    throw std::runtime_error("HDF5_Read_ContainerImp::" + caller + " type " + type.name() +
+                             " does not match the type stored in " + name());
+  }
+}
+
+void HDF5_Read_ContainerImp::readRows(
+  hdf5::Handle const& dataset, hid_t type, hsize_t first, hsize_t count, void* buffer)
+{
+  if (count == 0) {
+    return;
+  }
+  hdf5::Handle const file_space{
+    hdf5::check(H5Dget_space(dataset.get()), "unable to get dataspace of " + name()), &H5Sclose};
+  hdf5::check(
+    H5Sselect_hyperslab(file_space.get(), H5S_SELECT_SET, &first, nullptr, &count, nullptr),
+    "unable to select rows of " + name());
+  hdf5::Handle const memory_space{
+    hdf5::check(H5Screate_simple(1, &count, nullptr), "unable to create dataspace"), &H5Sclose};
+  hdf5::check(
+    H5Dread(dataset.get(), type, memory_space.get(), file_space.get(), H5P_DEFAULT, buffer),
+    "unable to read " + name());
+}
+
+// Requires the hdf5::Lock to be held
+void HDF5_Read_ContainerImp::loadBlock(std::uint64_t row)
+{
+  auto const first = row - row % m_blockRows;
+  auto const size = std::min(m_blockRows, m_rows - first);
+  m_blockSize = 0; // until the block has been read successfully
+
+  if (!m_type->variable) {
+    m_block.resize(size * m_type->element_size);
+    readRows(m_values, m_type->handle, first, size, m_block.data());
+  } else {
+    // Stored offsets are row ends; the end of the previous row is the start of this block.
+    m_blockOffsets.resize(size + 1);
+    m_blockOffsets[0] = 0;
+    auto const previous = first == 0 ? 0 : first - 1;
+    readRows(m_offsets,
+             H5T_NATIVE_UINT64,
+             previous,
+             size + (first - previous),
+             m_blockOffsets.data() + (first == 0 ? 1 : 0));
+    auto const begin = m_blockOffsets.front();
+    auto const end = m_blockOffsets.back();
+    if (!std::ranges::is_sorted(m_blockOffsets) || end > m_valueCount) {
+      throw std::runtime_error("HDF5_Read_ContainerImp::read corrupt offsets in " + name());
+    }
+    for (auto& offset : m_blockOffsets) {
+      offset -= begin;
+    }
+    m_block.resize((end - begin) * m_type->element_size);
+    readRows(m_values, m_type->handle, begin, end - begin, m_block.data());
+  }
+  m_blockFirst = first;
+  m_blockSize = size;
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_HDF5_STORAGE_HDF5_READ_CONTAINER_HPP
+#define FORM_HDF5_STORAGE_HDF5_READ_CONTAINER_HPP
+
+#include "hdf5_utils.hpp"
+
+#include "storage/storage_read_container.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace form::detail::experimental {
+
+  class HDF5_FileImp;
+
+  // Reads one container of an HDF5 file.  Rows are read in blocks: the first read of a row loads
+  // the whole block holding it with one hyperslab selection per dataset, and later reads of rows
+  // in that block are served from memory.  A block is one chunk of the dataset by default; the
+  // "read_rows" attribute sets a different number of rows.  Reads may be issued concurrently.
+  class HDF5_Read_ContainerImp : public Storage_Read_Container {
+  public:
+    explicit HDF5_Read_ContainerImp(std::string const& name);
+    ~HDF5_Read_ContainerImp() override;
+
+    HDF5_Read_ContainerImp(HDF5_Read_ContainerImp const&) = delete;
+    HDF5_Read_ContainerImp& operator=(HDF5_Read_ContainerImp const&) = delete;
+    HDF5_Read_ContainerImp(HDF5_Read_ContainerImp&&) = delete;
+    HDF5_Read_ContainerImp& operator=(HDF5_Read_ContainerImp&&) = delete;
+
+    void setFile(std::shared_ptr<IStorage_File> file) override;
+    void prime(std::type_info const& type) override;
+
+    bool read(int id, void const** data, std::type_info const& type) override;
+    // Reads fixed-width rows with one hyperslab selection, straight into the caller's buffer
+    int readBulk(int first, int count, void* buffer, std::type_info const& type) override;
+    int entries() override;
+
+    void setAttribute(std::string const& key, std::string const& value) override;
+
+  private:
+    void checkType(std::type_info const& type, std::string const& caller);
+    void readRows(hdf5::Handle const& dataset,
+                  hid_t type,
+                  hsize_t first,
+                  hsize_t count,
+                  void* buffer);
+    void loadBlock(std::uint64_t row);
+
+    std::shared_ptr<HDF5_FileImp> m_file;
+    hdf5::ElementType const* m_type{nullptr}; // nullptr if the container is not in the file
+    hdf5::Handle m_values;                    // the dataset of fixed-width rows, or "values"
+    hdf5::Handle m_offsets;                   // only for variable-width rows
+    std::uint64_t m_rows{};
+    std::uint64_t m_valueCount{}; // elements in "values"
+    std::uint64_t m_blockRows{};
+
+    // The rows [m_blockFirst, m_blockFirst + m_blockSize) are held in m_block.  For
+    // variable-width rows, m_blockOffsets holds m_blockSize + 1 element offsets into m_block.
+    std::uint64_t m_blockFirst{};
+    std::uint64_t m_blockSize{};
+    std::vector<std::byte> m_block;
+    std::vector<std::uint64_t> m_blockOffsets;
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_HDF5_STORAGE_HDF5_READ_CONTAINER_HPP
@@ -0,0 +1,104 @@
+// Copyright (C) 2025 ...
+
+#include "hdf5_utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace form::detail::experimental;
+using namespace form::detail::experimental::hdf5;
+
+namespace {
+  // The HDF5 memory type of the elements of each stored type
+  struct MemoryType {
+    hid_t operator()(std::type_identity<bool>) const { return H5T_NATIVE_HBOOL; }
+    hid_t operator()(std::type_identity<char>) const { return H5T_NATIVE_CHAR; }
+    hid_t operator()(std::type_identity<signed char>) const { return H5T_NATIVE_SCHAR; }
+    hid_t operator()(std::type_identity<unsigned char>) const { return H5T_NATIVE_UCHAR; }
+    hid_t operator()(std::type_identity<short>) const { return H5T_NATIVE_SHORT; }
+    hid_t operator()(std::type_identity<unsigned short>) const { return H5T_NATIVE_USHORT; }
+    hid_t operator()(std::type_identity<int>) const { return H5T_NATIVE_INT; }
+    hid_t operator()(std::type_identity<unsigned int>) const { return H5T_NATIVE_UINT; }
+    hid_t operator()(std::type_identity<long>) const { return H5T_NATIVE_LONG; }
+    hid_t operator()(std::type_identity<unsigned long>) const { return H5T_NATIVE_ULONG; }
+    hid_t operator()(std::type_identity<long long>) const { return H5T_NATIVE_LLONG; }
+    hid_t operator()(std::type_identity<unsigned long long>) const { return H5T_NATIVE_ULLONG; }
+    hid_t operator()(std::type_identity<float>) const { return H5T_NATIVE_FLOAT; }
+    hid_t operator()(std::type_identity<double>) const { return H5T_NATIVE_DOUBLE; }
+    hid_t operator()(std::type_identity<std::string>) const { return H5T_NATIVE_CHAR; }
+    template <typename T>
+    hid_t operator()(std::type_identity<std::vector<T>>) const
+    {
+      return (*this)(std::type_identity<T>{});
+    }
+  };
+
+  std::vector<ElementType> const& elementTypes()
+  {
+    static_assert(sizeof(hbool_t) == sizeof(bool));
+    static std::vector<ElementType> const types = makeStoredTypes<hid_t>(MemoryType{});
+    return types;
+  }
+
+  herr_t innermostError(unsigned n, H5E_error2_t const* error, void* client_data)
+  {
+    if (n == 0 && error->desc != nullptr) {
+      *static_cast<std::string*>(client_data) = error->desc;
+    }
+    return 0;
+  }
+
+  std::mutex& libraryMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+}
+
+namespace form::detail::experimental::hdf5 {
+
+  ElementType const* elementType(std::type_info const& type)
+  {
+    return findStoredType(elementTypes(), type);
+  }
+
+  ElementType const* elementType(std::string_view name)
+  {
+    auto const& types = elementTypes();
+    auto it = std::ranges::find(types, name, [](ElementType const& t) { return t.name; });
+    return it != types.end() ? &*it : nullptr;
+  }
+
+  Lock::Lock() : m_lock(libraryMutex())
+  {
+    H5Eget_auto2(H5E_DEFAULT, &m_errorFunction, &m_errorData);
+    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+  }
+
+  Lock::~Lock() { H5Eset_auto2(H5E_DEFAULT, m_errorFunction, m_errorData); }
+
+  void fail(std::string const& what)
+  {
+    std::string reason;
+    H5Ewalk2(H5E_DEFAULT, H5E_WALK_DOWNWARD, &innermostError, &reason);
+    H5Eclear2(H5E_DEFAULT);
+    throw std::runtime_error("FORM HDF5: " + what + (reason.empty() ? "" : ": " + reason));
+  }
+
+  bool pathExists(hid_t location, std::string const& path)
+  {
+    // Each link is checked in turn, as H5Lexists requires all but the last one to exist.
+    for (auto end = path.find('/');; end = path.find('/', end + 1)) {
+      if (H5Lexists(location, path.substr(0, end).c_str(), H5P_DEFAULT) <= 0) {
+        return false;
+      }
+      if (end == std::string::npos) {
+        return true;
+      }
+    }
+  }
+
+} // namespace form::detail::experimental::hdf5
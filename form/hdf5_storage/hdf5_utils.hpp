@@ -0,0 +1,110 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_HDF5_STORAGE_HDF5_UTILS_HPP
+#define FORM_HDF5_STORAGE_HDF5_UTILS_HPP
+
+#include "storage/storage_types.hpp"
+
+#include <hdf5.h>
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+
+/* Layout of FORM products in an HDF5 file
+ *
+ * Each container is stored at the HDF5 path given by its name ("creator/product"), creating the
+ * intermediate groups as needed.  Products of a fundamental type are stored as a one-dimensional,
+ * chunked, extendible dataset with one element per row.  Products of variable length
+ * (std::vector of a fundamental type and std::string) are stored as a group holding two such
+ * datasets: "values", the elements of all rows back to back, and "offsets", the uint64 end
+ * offset of each row in "values".  The "form_type" string attribute of the dataset or group names
+ * the C++ type that was written.
+ */
+
+namespace form::detail::experimental::hdf5 {
+
+  // How objects of one C++ type are stored.  The handle is the HDF5 memory type of the
+  // elements; the name is the value of the "form_type" attribute.
+  using ElementType = StoredType<hid_t>;
+
+  // The element type of a C++ type, or nullptr if the type cannot be stored
+  ElementType const* elementType(std::type_info const& type);
+  // The element type with the given "form_type" name, or nullptr if the name is unknown
+  ElementType const* elementType(std::string_view name);
+
+  // Serializes all calls into the HDF5 library, which is not thread-safe in most builds.  While
+  // held, HDF5's automatic error printing is suspended: failures are reported by check() instead.
+  class Lock {
+  public:
+    Lock();
+    ~Lock();
+
+    Lock(Lock const&) = delete;
+    Lock& operator=(Lock const&) = delete;
+    Lock(Lock&&) = delete;
+    Lock& operator=(Lock&&) = delete;
+
+  private:
+    std::unique_lock<std::mutex> m_lock;
+    H5E_auto2_t m_errorFunction{nullptr};
+    void* m_errorData{nullptr};
+  };
+
+  // Throws, quoting the innermost HDF5 error
+  [[noreturn]] void fail(std::string const& what);
+
+  // The result of an HDF5 call, which failed if it is negative
+  template <typename T>
+  T check(T result, std::string const& what)
+  {
+    if (result < 0) {
+      fail(what);
+    }
+    return result;
+  }
+
+  // Owns an HDF5 identifier; must be destroyed while a Lock is held
+  class Handle {
+  public:
+    Handle() = default;
+    Handle(hid_t id, herr_t (*close)(hid_t)) : m_id(id), m_close(close) {}
+    ~Handle() { reset(); }
+
+    Handle(Handle const&) = delete;
+    Handle& operator=(Handle const&) = delete;
+    Handle(Handle&& other) noexcept : m_id(other.m_id), m_close(other.m_close) { other.m_id = -1; }
+    Handle& operator=(Handle&& other) noexcept
+    {
+      if (this != &other) {
+        reset();
+        m_id = other.m_id;
+        m_close = other.m_close;
+        other.m_id = -1;
+      }
+      return *this;
+    }
+
+    hid_t get() const { return m_id; }
+    explicit operator bool() const { return m_id >= 0; }
+
+    void reset()
+    {
+      if (m_id >= 0) {
+        m_close(m_id);
+        m_id = -1;
+      }
+    }
+
+  private:
+    hid_t m_id{-1};
+    herr_t (*m_close)(hid_t){nullptr};
+  };
+
+  // Whether every link of the given path exists below 'location'
+  bool pathExists(hid_t location, std::string const& path);
+
+} // namespace form::detail::experimental::hdf5
+
+#endif // FORM_HDF5_STORAGE_HDF5_UTILS_HPP
@@ -0,0 +1,229 @@
+// Copyright (C) 2025 ...
+
+#include "hdf5_write_container.hpp"
+#include "hdf5_file.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+using namespace form::detail::experimental;
+
+namespace {
+  void writeTypeAttribute(hid_t object, char const* type_name)
+  {
+    hdf5::Handle const type{hdf5::check(H5Tcopy(H5T_C_S1), "unable to copy string type"),
+                            &H5Tclose};
+    hdf5::check(H5Tset_size(type.get(), std::strlen(type_name)), "unable to size string type");
+    hdf5::Handle const space{hdf5::check(H5Screate(H5S_SCALAR), "unable to create dataspace"),
+                             &H5Sclose};
+    hdf5::Handle const attribute{
+      hdf5::check(
+        H5Acreate2(object, "form_type", type.get(), space.get(), H5P_DEFAULT, H5P_DEFAULT),
+        "unable to create form_type attribute"),
+      &H5Aclose};
+    hdf5::check(H5Awrite(attribute.get(), type.get(), type_name),
+                "unable to write form_type attribute");
+  }
+
+  hdf5::Handle linkCreationList()
+  {
+    hdf5::Handle list{hdf5::check(H5Pcreate(H5P_LINK_CREATE), "unable to create property list"),
+                      &H5Pclose};
+    hdf5::check(H5Pset_create_intermediate_group(list.get(), 1),
+                "unable to request intermediate groups");
+    return list;
+  }
+}
+
+HDF5_Write_ContainerImp::HDF5_Write_ContainerImp(std::string const& name) :
+  Storage_Write_Container(name)
+{
+}
+
+HDF5_Write_ContainerImp::~HDF5_Write_ContainerImp()
+{
+  hdf5::Lock const lock;
+  // Rows filled since the last flush or chunk are written here as a last resort; an error can
+  // then only be reported, which is why writers flush their containers.
+  try {
+    writeBuffer();
+  } catch (std::exception const& e) {
+    std::cerr << "HDF5_Write_ContainerImp: unflushed rows of " << name()
+              << " were lost: " << e.what() << '\n';
+  }
+  m_values.handle.reset();
+  m_offsets.handle.reset();
+}
+
+void HDF5_Write_ContainerImp::setFile(std::shared_ptr<IStorage_File> file)
+{
+  this->Storage_Write_Container::setFile(file);
+  m_file = std::dynamic_pointer_cast<HDF5_FileImp>(file);
+  if (m_file == nullptr || !m_file->writable()) {
+    throw std::runtime_error(
+      "HDF5_Write_ContainerImp::setFile can't attach to a file not opened for writing");
+  }
+}
+
+void HDF5_Write_ContainerImp::setupWrite(std::type_info const& type)
+{
+  if (m_file == nullptr) {
+    throw std::runtime_error("HDF5_Write_ContainerImp::setupWrite no file attached");
+  }
+  if (m_type != nullptr) {
+    return;
+  }
+  hdf5::Lock const lock;
+  auto const* element_type = hdf5::elementType(type);
+  if (element_type == nullptr) {
+    throw std::runtime_error(
+      std::string{"HDF5_Write_ContainerImp::setupWrite unsupported type: "} + type.name());
+  }
+
+  if (element_type->variable) {
+    auto const link_list = linkCreationList();
+    hdf5::Handle const group{
+      hdf5::check(
+        H5Gcreate2(m_file->id(), name().c_str(), link_list.get(), H5P_DEFAULT, H5P_DEFAULT),
+        "unable to create group " + name()),
+      &H5Gclose};
+    writeTypeAttribute(group.get(), element_type->name);
+    m_offsets.handle = createDataset(group.get(), "offsets", H5T_NATIVE_UINT64, m_chunkRows);
+    m_values.handle =
+      createDataset(group.get(), "values", element_type->handle, m_chunkElements);
+    m_bufferOffsets.reserve(m_chunkRows);
+    m_buffer.reserve(m_chunkElements * element_type->element_size);
+  } else {
+    m_values.handle =
+      createDataset(m_file->id(), name(), element_type->handle, m_chunkRows);
+    writeTypeAttribute(m_values.handle.get(), element_type->name);
+    m_buffer.reserve(m_chunkRows * element_type->element_size);
+  }
+  m_type = element_type;
+}
+
+std::uint64_t HDF5_Write_ContainerImp::fill(void const* data)
+{
+  if (m_type == nullptr) {
+    throw std::runtime_error("HDF5_Write_ContainerImp::fill called before setupWrite for " +
+                             name());
+  }
+  auto const bytes = m_type->bytes(data);
+  m_buffer.insert(m_buffer.end(), bytes.begin(), bytes.end());
+  ++m_bufferRows;
+  if (m_type->variable) {
+    m_bufferOffsets.push_back(m_values.size + m_buffer.size() / m_type->element_size);
+    if (m_bufferRows >= m_chunkRows || m_buffer.size() >= m_chunkElements * m_type->element_size) {
+      hdf5::Lock const lock;
+      writeBuffer();
+    }
+  } else if (m_bufferRows >= m_chunkRows) {
+    hdf5::Lock const lock;
+    writeBuffer();
+  }
+  return m_rows++;
+}
+
+// The rows of a commit stay buffered until a chunk is full, so that they are still appended in
+// blocks; flush() writes the rest.
+void HDF5_Write_ContainerImp::commit()
+{
+  if (m_type == nullptr) {
+    throw std::runtime_error("HDF5_Write_ContainerImp::commit called before setupWrite for " +
+                             name());
+  }
+}
+
+void HDF5_Write_ContainerImp::flush()
+{
+  if (m_type == nullptr) {
+    return;
+  }
+  hdf5::Lock const lock;
+  writeBuffer();
+}
+
+void HDF5_Write_ContainerImp::setAttribute(std::string const& key, std::string const& value)
+{
+  if (key == "chunk_rows" || key == "chunk_elements") {
+    auto const chunk = std::stoull(value);
+    if (chunk == 0) {
+      throw std::runtime_error("HDF5_Write_ContainerImp: " + key + " must be positive");
+    }
+    (key == "chunk_rows" ? m_chunkRows : m_chunkElements) = chunk;
+  } else if (key == "compression") {
+    m_compression = static_cast<unsigned>(std::stoul(value));
+    if (m_compression > 9) {
+      throw std::runtime_error("HDF5_Write_ContainerImp: compression must be between 0 and 9");
+    }
+  } else {
+    throw std::runtime_error("HDF5_Write_ContainerImp accepts some attributes, but not " + key);
+  }
+}
+
+hdf5::Handle HDF5_Write_ContainerImp::createDataset(hid_t location,
+                                                    std::string const& path,
+                                                    hid_t type,
+                                                    hsize_t chunk)
+{
+  hsize_t const initial = 0;
+  hsize_t const maximum = H5S_UNLIMITED;
+  hdf5::Handle const space{hdf5::check(H5Screate_simple(1, &initial, &maximum),
+                                       "unable to create dataspace for " + name()),
+                           &H5Sclose};
+  hdf5::Handle const creation_list{
+    hdf5::check(H5Pcreate(H5P_DATASET_CREATE), "unable to create property list"), &H5Pclose};
+  hdf5::check(H5Pset_chunk(creation_list.get(), 1, &chunk), "unable to set chunk size");
+  if (m_compression != 0) {
+    hdf5::check(H5Pset_shuffle(creation_list.get()), "unable to enable shuffling");
+    hdf5::check(H5Pset_deflate(creation_list.get(), m_compression),
+                "unable to enable compression");
+  }
+  auto const link_list = linkCreationList();
+  return hdf5::Handle{hdf5::check(H5Dcreate2(location,
+                                             path.c_str(),
+                                             type,
+                                             space.get(),
+                                             link_list.get(),
+                                             creation_list.get(),
+                                             H5P_DEFAULT),
+                                  "unable to create dataset for " + name()),
+                      &H5Dclose};
+}
+
+void HDF5_Write_ContainerImp::append(Dataset& dataset, hid_t type, void const* data, hsize_t count)
+{
+  if (count == 0) {
+    return;
+  }
+  hsize_t const extent = dataset.size + count;
+  hdf5::check(H5Dset_extent(dataset.handle.get(), &extent), "unable to extend " + name());
+  hdf5::Handle const file_space{
+    hdf5::check(H5Dget_space(dataset.handle.get()), "unable to get dataspace of " + name()),
+    &H5Sclose};
+  hdf5::check(
+    H5Sselect_hyperslab(file_space.get(), H5S_SELECT_SET, &dataset.size, nullptr, &count, nullptr),
+    "unable to select rows of " + name());
+  hdf5::Handle const memory_space{
+    hdf5::check(H5Screate_simple(1, &count, nullptr), "unable to create dataspace"), &H5Sclose};
+  hdf5::check(
+    H5Dwrite(dataset.handle.get(), type, memory_space.get(), file_space.get(), H5P_DEFAULT, data),
+    "unable to write " + name());
+  dataset.size = extent;
+}
+
+// Requires the hdf5::Lock to be held
+void HDF5_Write_ContainerImp::writeBuffer()
+{
+  if (m_bufferRows == 0) {
+    return;
+  }
+  append(m_values, m_type->handle, m_buffer.data(), m_buffer.size() / m_type->element_size);
+  if (m_type->variable) {
+    append(m_offsets, H5T_NATIVE_UINT64, m_bufferOffsets.data(), m_bufferOffsets.size());
+    m_bufferOffsets.clear();
+  }
+  m_buffer.clear();
+  m_bufferRows = 0;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_HDF5_STORAGE_HDF5_WRITE_CONTAINER_HPP
+#define FORM_HDF5_STORAGE_HDF5_WRITE_CONTAINER_HPP
+
+#include "hdf5_utils.hpp"
+
+#include "storage/storage_write_container.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace form::detail::experimental {
+
+  class HDF5_FileImp;
+
+  // Writes one container of an HDF5 file into chunked, extendible datasets.  Rows are collected
+  // in memory and appended with a single H5Dwrite per dataset once a chunk's worth of rows (or of
+  // vector elements) has been collected, and when the container is flushed; a commit leaves
+  // them buffered.  Errors of writes made by fill() and flush() are thrown to the caller.  The
+  // following attributes may be set through the container settings:
+  //
+  //   chunk_rows      rows per chunk of the dataset (or of "offsets"), default 4096
+  //   chunk_elements  elements per chunk of "values" for vectors and strings, default 65536
+  //   compression     deflate level from 0 (none, the default) to 9; byte shuffling is applied
+  //                   before compressing
+  //
+  // Containers are independent of each other, so no association container is needed.
+  class HDF5_Write_ContainerImp : public Storage_Write_Container {
+  public:
+    explicit HDF5_Write_ContainerImp(std::string const& name);
+    ~HDF5_Write_ContainerImp() override;
+
+    HDF5_Write_ContainerImp(HDF5_Write_ContainerImp const&) = delete;
+    HDF5_Write_ContainerImp& operator=(HDF5_Write_ContainerImp const&) = delete;
+    HDF5_Write_ContainerImp(HDF5_Write_ContainerImp&&) = delete;
+    HDF5_Write_ContainerImp& operator=(HDF5_Write_ContainerImp&&) = delete;
+
+    void setFile(std::shared_ptr<IStorage_File> file) override;
+    void setupWrite(std::type_info const& type) override;
+    std::uint64_t fill(void const* data) override;
+    void commit() override;
+    void flush() override;
+
+    void setAttribute(std::string const& key, std::string const& value) override;
+
+  private:
+    struct Dataset {
+      hdf5::Handle handle;
+      hsize_t size{}; // elements written so far
+    };
+
+    hdf5::Handle createDataset(hid_t location,
+                               std::string const& path,
+                               hid_t type,
+                               hsize_t chunk);
+    void append(Dataset& dataset, hid_t type, void const* data, hsize_t count);
+    void writeBuffer();
+
+    std::shared_ptr<HDF5_FileImp> m_file;
+    hdf5::ElementType const* m_type{nullptr};
+    hsize_t m_chunkRows{4096};
+    hsize_t m_chunkElements{65536};
+    unsigned m_compression{0};
+
+    Dataset m_values;  // the dataset of fixed-width rows, or "values"
+    Dataset m_offsets; // only for variable-width rows
+
+    std::uint64_t m_rows{};       // filled so far
+    std::uint64_t m_bufferRows{}; // filled but not yet written
+    std::vector<std::byte> m_buffer;
+    std::vector<std::uint64_t> m_bufferOffsets; // end offset of each buffered row in "values"
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_HDF5_STORAGE_HDF5_WRITE_CONTAINER_HPP
@@ -3,6 +3,8 @@
 #ifndef FORM_PERSISTENCE_IPERSISTENCE_READER_HPP
 #define FORM_PERSISTENCE_IPERSISTENCE_READER_HPP
 
+#include "storage/storage_index.hpp"
+
 #include <map>
 #include <memory>
 #include <string>
@@ -32,12 +34,27 @@ namespace form::detail::experimental {
                       void const** data,
                       std::type_info const& type) = 0;
 
+    // Reads the product of a fundamental type for 'count' consecutive rows, starting with the row
+    // of 'first_id', into 'buffer'.  Returns the number of rows read, which is only less than
+    // 'count' at the end of the container.
+    virtual int readBulk(std::string const& creator,
+                         std::string const& label,
+                         std::string const& first_id,
+                         int count,
+                         void* buffer,
+                         std::type_info const& type) = 0;
+
     virtual void prime(std::string const& creator,
                        std::string const& label,
                        std::type_info const& type) = 0;
 
     virtual std::vector<std::string> listIndices(std::string const& creator,
                                                  std::string const& label) = 0;
+
+    // The data cells of the creator's index, in row order, rebuilt without reading the ids
+    // where the file allows it
+    virtual std::vector<IndexCell> listIndexCells(std::string const& creator,
+                                                  std::string const& label) = 0;
   };
 
   std::unique_ptr<IPersistenceReader> createPersistenceReader();
@@ -3,8 +3,11 @@
 #ifndef FORM_PERSISTENCE_IPERSISTENCE_WRITER_HPP
 #define FORM_PERSISTENCE_IPERSISTENCE_WRITER_HPP
 
+#include "core/placement.hpp"
 #include "core/token.hpp"
 
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -17,6 +20,24 @@ namespace form::experimental::config {
 
 namespace form::detail::experimental {
 
+  class IStorage_Write_Container;
+
+  // Where one product is written: its placement and the storage container resolved for it.
+  struct ProductContainer {
+    Placement placement;
+    IStorage_Write_Container* container{nullptr};
+  };
+
+  // The containers of all products from one creator, together with the index containers that
+  // are filled on each commit.  Obtained from IPersistenceWriter::createContainers and valid for
+  // the lifetime of the writer; writing through it requires no name lookups.
+  struct CreatorContainers {
+    std::map<std::string, ProductContainer, std::less<>> products;
+    ProductContainer index;
+    ProductContainer index_key;
+    ProductContainer index_cell;
+  };
+
   class IPersistenceWriter {
   public:
     IPersistenceWriter() = default;
@@ -27,8 +48,10 @@ namespace form::detail::experimental {
 
     virtual void configure(form::experimental::config::ItemConfig const& configItems) = 0;
 
-    virtual void createContainers(std::string const& creator,
-                                  std::map<std::string, std::type_info const*> const& products) = 0;
+    // Containers are created only for products not seen before from this creator, so the call
+    // is cheap once a creator's products are known.
+    virtual CreatorContainers const& createContainers(
+      std::string const& creator, std::map<std::string, std::type_info const*> const& products) = 0;
     // Write one product and return a Token locating it: placement plus 0-based row (entry) number
     // Throws if backend isn't row-addressed, causing Token read lookup to fail
     virtual Token registerWrite(std::string const& creator,
@@ -36,6 +59,22 @@ namespace form::detail::experimental {
                                 void const* data,
                                 std::type_info const& type) = 0;
     virtual void commitOutput(std::string const& creator, std::string const& id) = 0;
+
+    // Lookup-free counterparts of registerWrite and commitOutput, using containers returned by
+    // createContainers.  write returns the 0-based row written, or kDeferredRowId if the backend
+    // only assigns rows when it flushes, and throws if the backend does not address rows.
+    //
+    // Products and commits through different CreatorContainers may be written concurrently if
+    // the storage supports concurrent fills (RNTuple with the "parallel_fill" file attribute);
+    // a product and the commit of its entry must then be written from the same thread.
+    virtual std::uint64_t write(ProductContainer const& product, void const* data) = 0;
+    virtual void commitOutput(CreatorContainers const& containers, std::string const& id) = 0;
+
+    // Ends the output: writes what the storage still buffers for every container of every
+    // creator (products, index and index key), and throws if that fails.  Commits leave rows
+    // buffered where the storage writes them in larger blocks (e.g. HDF5 chunks), so this must
+    // be called once all entries have been committed.
+    virtual void flushOutput() = 0;
   };
 
   std::unique_ptr<IPersistenceWriter> createPersistenceWriter();
@@ -47,6 +47,17 @@ void PersistenceReader::read(std::string const& creator,
   m_store_reader->readContainer(*token, data, type, m_tech_settings);
 }
 
+int PersistenceReader::readBulk(std::string const& creator,
+                                std::string const& label,
+                                std::string const& first_id,
+                                int count,
+                                void* buffer,
+                                std::type_info const& type)
+{
+  std::unique_ptr<Token> token = getToken(creator, label, first_id);
+  return m_store_reader->readContainerBulk(*token, count, buffer, type, m_tech_settings);
+}
+
 void PersistenceReader::prime(std::string const& creator,
                               std::string const& label,
                               std::type_info const& type)
@@ -78,6 +89,21 @@ std::vector<std::string> PersistenceReader::listIndices(std::string const& creat
     Token{config_item->file_name, full_label, config_item->technology}, m_tech_settings);
 }
 
+std::vector<IndexCell> PersistenceReader::listIndexCells(std::string const& creator,
+                                                         std::string const& label)
+{
+  auto const config_item = findConfigItem(m_config_items, label);
+
+  if (!config_item) {
+    throw std::runtime_error("No configuration found for product: " + label +
+                             " from creator: " + creator);
+  }
+
+  std::string const full_label = buildFullLabel(creator, "index");
+  return m_store_reader->listIndexCells(
+    Token{config_item->file_name, full_label, config_item->technology}, m_tech_settings);
+}
+
 std::unique_ptr<Token> PersistenceReader::getToken(std::string const& creator,
                                                    std::string const& label,
                                                    std::string const& id)
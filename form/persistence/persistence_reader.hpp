@@ -35,12 +35,21 @@ namespace form::detail::experimental {
               void const** data,
               std::type_info const& type) override;
 
+    int readBulk(std::string const& creator,
+                 std::string const& label,
+                 std::string const& first_id,
+                 int count,
+                 void* buffer,
+                 std::type_info const& type) override;
+
     void prime(std::string const& creator,
                std::string const& label,
                std::type_info const& type) override;
 
     std::vector<std::string> listIndices(std::string const& creator,
                                          std::string const& label) override;
+    std::vector<IndexCell> listIndexCells(std::string const& creator,
+                                          std::string const& label) override;
 
   private:
     std::unique_ptr<Token> getToken(std::string const& creator,
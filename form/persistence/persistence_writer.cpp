@@ -3,15 +3,32 @@
 #include "persistence_writer.hpp"
 #include "persistence_utils.hpp"
 
+#include "storage/istorage.hpp"
+#include "storage/storage_index.hpp"
+
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 using namespace form::detail::experimental;
 
+namespace {
+  // A Token must carry the row of the product, which a deferred row is not.
+  void checkDeferredRow(std::uint64_t row, std::string const& creator, std::string const& label)
+  {
+    if (row == kDeferredRowId) {
+      throw std::runtime_error("PersistenceWriter::registerWrite backend for product '" + label +
+                               "' from creator '" + creator + "' assigns rows only when it " +
+                               "flushes; cannot produce a Token locating the written product");
+    }
+  }
+}
+
 namespace form::detail::experimental {
   std::unique_ptr<IPersistenceWriter> createPersistenceWriter()
   {
@@ -37,15 +54,50 @@ void PersistenceWriter::configure(form::experimental::config::ItemConfig const&
   m_config_items = config_items;
 }
 
-void PersistenceWriter::createContainers(
+CreatorContainers const& PersistenceWriter::createContainers(
   std::string const& creator, std::map<std::string, std::type_info const*> const& products)
 {
+  auto& result = m_containers[creator];
+
+  // Nothing is recorded in 'result' until the storage writer has created the containers, so a
+  // failure (e.g. an unconfigured product) leaves no partially-resolved entries behind.
   std::map<std::unique_ptr<Placement>, std::type_info const*> containers;
+  std::vector<std::pair<std::string const*, Placement const*>> new_products;
   for (auto const& [label, type] : products) {
-    containers.insert(std::make_pair(getPlacement(creator, label), type));
+    if (!result.products.contains(label)) {
+      auto plcmnt = getPlacement(creator, label);
+      new_products.emplace_back(&label, plcmnt.get());
+      containers.emplace(std::move(plcmnt), type);
+    }
+  }
+  Placement const* index = nullptr;
+  Placement const* index_key = nullptr;
+  Placement const* index_cell = nullptr;
+  if (result.index.container == nullptr) {
+    auto index_plcmnt = getPlacement(creator, "index");
+    auto key_plcmnt = indexKeyPlacement(*index_plcmnt);
+    auto cell_plcmnt = indexCellPlacement(*index_plcmnt);
+    index = index_plcmnt.get();
+    index_key = key_plcmnt.get();
+    index_cell = cell_plcmnt.get();
+    containers.emplace(std::move(key_plcmnt), &typeid(std::uint64_t));
+    containers.emplace(std::move(cell_plcmnt), &typeid(std::vector<std::uint64_t>));
+    containers.emplace(std::move(index_plcmnt), &typeid(std::string));
+  }
+  if (containers.empty()) {
+    return result;
   }
-  containers.insert(std::make_pair(getPlacement(creator, "index"), &typeid(std::string)));
-  m_store_writer->createContainers(containers, m_tech_settings);
+
+  auto const created = m_store_writer->createContainers(containers, m_tech_settings);
+  for (auto const& [label, plcmnt] : new_products) {
+    result.products.emplace(*label, ProductContainer{*plcmnt, created.at(plcmnt)});
+  }
+  if (index != nullptr) {
+    result.index = ProductContainer{*index, created.at(index)};
+    result.index_key = ProductContainer{*index_key, created.at(index_key)};
+    result.index_cell = ProductContainer{*index_cell, created.at(index_cell)};
+  }
+  return result;
 }
 
 Token PersistenceWriter::registerWrite(std::string const& creator,
@@ -53,6 +105,18 @@ Token PersistenceWriter::registerWrite(std::string const& creator,
                                        void const* data,
                                        std::type_info const& type)
 {
+  if (auto const creator_it = m_containers.find(creator); creator_it != m_containers.end()) {
+    auto const& products = creator_it->second.products;
+    if (auto const product_it = products.find(label); product_it != products.end()) {
+      auto const& plcmnt = product_it->second.placement;
+      auto const row = write(product_it->second, data);
+      checkDeferredRow(row, creator, label);
+      return Token{plcmnt.fileName(), plcmnt.containerName(), plcmnt.technology(), row};
+    }
+  }
+
+  // Containers not created through createContainers (an error unless the storage writer
+  // already knows the container).
   std::unique_ptr<Placement> plcmnt = getPlacement(creator, label);
   std::uint64_t const row = m_store_writer->fillContainer(*plcmnt, data, type);
   // A returned Token must locate a readable product: its row is the read-side navigation key.
@@ -62,16 +126,56 @@ Token PersistenceWriter::registerWrite(std::string const& creator,
                              "' from creator '" + creator + "' does not address rows; " +
                              "cannot produce a Token locating the written product");
   }
+  checkDeferredRow(row, creator, label);
   return Token{plcmnt->fileName(), plcmnt->containerName(), plcmnt->technology(), row};
 }
 
 void PersistenceWriter::commitOutput(std::string const& creator, std::string const& id)
 {
+  if (auto const it = m_containers.find(creator); it != m_containers.end()) {
+    commitOutput(it->second, id);
+    return;
+  }
+
   std::unique_ptr<Placement> plcmnt = getPlacement(creator, "index");
+  // The key and cell must outlive the commit: some backends only read filled data when
+  // committing.
+  std::uint64_t const key = indexKey(id);
+  auto const cell = indexCell(id);
   m_store_writer->fillContainer(*plcmnt, &id, typeid(std::string));
+  m_store_writer->fillContainer(*indexKeyPlacement(*plcmnt), &key, typeid(std::uint64_t));
+  m_store_writer->fillContainer(
+    *indexCellPlacement(*plcmnt), &cell, typeid(std::vector<std::uint64_t>));
   m_store_writer->commitContainers(*plcmnt);
 }
 
+std::uint64_t PersistenceWriter::write(ProductContainer const& product, void const* data)
+{
+  std::uint64_t const row = product.container->fill(data);
+  // A row is the read-side navigation key of the written product; see registerWrite.  A
+  // deferred row is fine: the product shares its row with the index entry committed next.
+  if (row == kInvalidRowId) {
+    throw std::runtime_error("PersistenceWriter::write backend for container '" +
+                             product.placement.containerName() + "' does not address rows; " +
+                             "the written product could not be located on read");
+  }
+  return row;
+}
+
+void PersistenceWriter::commitOutput(CreatorContainers const& containers, std::string const& id)
+{
+  // The key and cell must outlive the commit: some backends only read filled data when
+  // committing.
+  std::uint64_t const key = indexKey(id);
+  auto const cell = indexCell(id);
+  containers.index.container->fill(&id);
+  containers.index_key.container->fill(&key);
+  containers.index_cell.container->fill(&cell);
+  containers.index.container->commit();
+}
+
+void PersistenceWriter::flushOutput() { m_store_writer->flushContainers(); }
+
 std::unique_ptr<Placement> PersistenceWriter::getPlacement(std::string const& creator,
                                                            std::string const& label)
 {
@@ -85,3 +189,15 @@ std::unique_ptr<Placement> PersistenceWriter::getPlacement(std::string const& cr
   std::string const full_label = buildFullLabel(creator, label);
   return std::make_unique<Placement>(config_item->file_name, full_label, config_item->technology);
 }
+
+std::unique_ptr<Placement> PersistenceWriter::indexKeyPlacement(Placement const& index)
+{
+  return std::make_unique<Placement>(
+    index.fileName(), indexKeyContainerName(index.containerName()), index.technology());
+}
+
+std::unique_ptr<Placement> PersistenceWriter::indexCellPlacement(Placement const& index)
+{
+  return std::make_unique<Placement>(
+    index.fileName(), indexCellContainerName(index.containerName()), index.technology());
+}
@@ -8,6 +8,8 @@
 #include "core/placement.hpp"
 #include "storage/istorage.hpp"
 
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -29,20 +31,31 @@ namespace form::detail::experimental {
 
     void configure(form::experimental::config::ItemConfig const& config_items) override;
 
-    void createContainers(std::string const& creator,
-                          std::map<std::string, std::type_info const*> const& products) override;
+    CreatorContainers const& createContainers(
+      std::string const& creator,
+      std::map<std::string, std::type_info const*> const& products) override;
     Token registerWrite(std::string const& creator,
                         std::string const& label,
                         void const* data,
                         std::type_info const& type) override;
     void commitOutput(std::string const& creator, std::string const& id) override;
 
+    std::uint64_t write(ProductContainer const& product, void const* data) override;
+    void commitOutput(CreatorContainers const& containers, std::string const& id) override;
+    void flushOutput() override;
+
   private:
     std::unique_ptr<Placement> getPlacement(std::string const& creator, std::string const& label);
+    // Placement of the key container accompanying an index container (see storage_index.hpp)
+    static std::unique_ptr<Placement> indexKeyPlacement(Placement const& index);
+    // Placement of the cell container accompanying an index container (see storage_index.hpp)
+    static std::unique_ptr<Placement> indexCellPlacement(Placement const& index);
 
     std::unique_ptr<IStorageWriter> m_store_writer;
     form::experimental::config::ItemConfig m_config_items;
     form::experimental::config::tech_setting_config m_tech_settings;
+    // Containers resolved so far, per creator
+    std::map<std::string, CreatorContainers, std::less<>> m_containers;
   };
 
 } // namespace form::detail::experimental
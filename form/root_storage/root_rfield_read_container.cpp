@@ -4,23 +4,29 @@
 #include "demangle_name.hpp"
 #include "root_tfile.hpp"
 
+#include "ROOT/RFieldBase.hxx"
+#include "ROOT/RNTupleDescriptor.hxx"
+#include "ROOT/RNTupleModel.hxx"
 #include "ROOT/RNTupleReader.hxx"
 #include "ROOT/RNTupleView.hxx"
+#include "TDataType.h"
 #include "TDictionary.h"
 #include "TFile.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
-#include <mutex>
-
-namespace {
-  std::mutex& root_rfield_read_mutex()
-  {
-    static std::mutex m;
-    return m;
-  }
-}
+#include <utility>
 
 namespace form::detail::experimental {
+  struct ROOT_RField_Read_ContainerImp::reader_slot {
+    std::unique_ptr<ROOT::RNTupleReader> reader;
+    std::unique_ptr<ROOT::RNTupleView<void>> view; //Created on the first read() through this slot
+    std::unique_ptr<ROOT::RFieldBase::RBulkValues> bulk; //Created on the first readBulk()
+  };
+
   ROOT_RField_Read_ContainerImp::ROOT_RField_Read_ContainerImp(std::string const& name) :
     Storage_Read_Container(name)
   {
@@ -49,21 +55,41 @@ namespace form::detail::experimental {
     return;
   }
 
-  void ROOT_RField_Read_ContainerImp::prime(std::type_info const& type)
+  auto ROOT_RField_Read_ContainerImp::acquireSlot(std::string const& caller)
+    -> std::unique_ptr<reader_slot>
   {
-    std::lock_guard<std::mutex> guard(root_rfield_read_mutex());
+    {
+      std::lock_guard<std::mutex> guard(m_slots_mutex);
+      if (!m_idle_slots.empty()) {
+        auto slot = std::move(m_idle_slots.back());
+        m_idle_slots.pop_back();
+        return slot;
+      }
+    }
 
+    //No idle slot: open a new reader outside the lock so that other threads may keep reading
     if (!m_tfile) {
-      throw std::runtime_error("ROOT_RField_Read_ContainerImp::prime No file loaded");
+      throw std::runtime_error("ROOT_RField_Read_ContainerImp::" + caller + " No file loaded");
     }
+    auto slot = std::make_unique<reader_slot>();
+    slot->reader = ROOT::RNTupleReader::Open(top_name(), m_tfile->GetName());
+    return slot;
+  }
 
-    if (!m_reader) {
-      m_reader = ROOT::RNTupleReader::Open(top_name(), m_tfile->GetName());
-    }
+  void ROOT_RField_Read_ContainerImp::releaseSlot(std::unique_ptr<reader_slot> slot)
+  {
+    std::lock_guard<std::mutex> guard(m_slots_mutex);
+    m_idle_slots.push_back(std::move(slot));
+  }
+
+  void ROOT_RField_Read_ContainerImp::prime(std::type_info const& type)
+  {
+    auto slot = acquireSlot("prime");
 
-    if (!m_view) {
-      createView(type);
+    if (!slot->view) {
+      createView(*slot, type);
     }
+    releaseSlot(std::move(slot));
 
     if (!TDictionary::GetDictionary(type)) {
       throw std::runtime_error("ROOT_RField_Read_ContainerImp::prime unsupported type");
@@ -72,24 +98,26 @@ namespace form::detail::experimental {
 
   bool ROOT_RField_Read_ContainerImp::read(int id, void const** data, std::type_info const& type)
   {
-    std::lock_guard<std::mutex> guard(root_rfield_read_mutex());
+    //A slot in use by a failed read is not returned to the pool; it is simply closed.
+    auto slot = acquireSlot("read");
 
     //Connect to file at the last possible moment at the cost of a little run-time branching
-    if (!m_view) {
-      createView(type);
+    if (!slot->view) {
+      createView(*slot, type);
     }
 
-    if (id >= static_cast<int>(m_reader->GetNEntries())) {
+    if (id >= static_cast<int>(slot->reader->GetNEntries())) {
+      releaseSlot(std::move(slot));
       return false;
     }
 
     //Using RNTupleView<> to read instead of reusing REntry gives us full schema evolution support: the ROOT feature that lets us read files with an old class version into a new class version's memory.
-    auto buffer = m_view->GetField().CreateObject<void>(); //PHLEX gets ownership of this memory
+    auto buffer = slot->view->GetField().CreateObject<void>(); //PHLEX gets ownership of this memory
     assert(buffer);
 
-    m_view->BindRawPtr(buffer.get());
+    slot->view->BindRawPtr(buffer.get());
     try {
-      (*m_view)(id);
+      (*slot->view)(id);
     } catch (ROOT::RException const& e) {
       throw std::runtime_error("ROOT_RField_Read_ContainerImp::read got a ROOT exception: " +
                                std::string(e.what()));
@@ -98,56 +126,105 @@ namespace form::detail::experimental {
       buffer.release(); //Ownership transferred to Phlex through Persistence and interface layers.
     //Any framework using FORM must free this memory.  FORM holds no reference to it.
 
+    releaseSlot(std::move(slot));
     return true;
   }
 
-  int ROOT_RField_Read_ContainerImp::entries()
+  int ROOT_RField_Read_ContainerImp::readBulk(int first,
+                                              int count,
+                                              void* buffer,
+                                              std::type_info const& type)
   {
-    std::lock_guard<std::mutex> guard(root_rfield_read_mutex());
+    auto* const dictInfo = TDictionary::GetDictionary(type);
+    if (!dictInfo || !(dictInfo->Property() & EProperty::kIsFundamental)) {
+      throw std::runtime_error(
+        "ROOT_RField_Read_ContainerImp::readBulk type is not fundamental: " + DemangleName(type));
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto const size = static_cast<std::size_t>(static_cast<TDataType*>(dictInfo)->Size());
 
-    if (!m_reader) {
-      if (!m_tfile) {
-        throw std::runtime_error("ROOT_RField_Read_ContainerImp::entries No file loaded");
+    auto slot = acquireSlot("readBulk");
+    if (!slot->view) {
+      createView(*slot, type);
+    }
+    std::uint64_t const entries = slot->reader->GetNEntries();
+    if (first < 0 || count <= 0 || static_cast<std::uint64_t>(first) >= entries) {
+      releaseSlot(std::move(slot));
+      return 0;
+    }
+    if (!slot->bulk) {
+      //The view has checked the type; the reader's own field must also hold values of that size.
+      auto const& model = slot->reader->GetModel();
+      if (model.GetConstField(col_name()).GetValueSize() != size) {
+        throw std::runtime_error("ROOT_RField_Read_ContainerImp::readBulk field " + col_name() +
+                                 " is not stored as " + DemangleName(type));
       }
-      m_reader = ROOT::RNTupleReader::Open(top_name(), m_tfile->GetName());
+      slot->bulk = std::make_unique<ROOT::RFieldBase::RBulkValues>(model.CreateBulk(col_name()));
     }
 
-    if (!m_view &&
-        (m_reader->GetDescriptor().FindFieldId(col_name()) == ROOT::kInvalidDescriptorId)) {
-      throw std::runtime_error("ROOT_RField_Read_ContainerImp::entries field " + col_name() +
-                               " does not exist");
+    //A bulk read cannot cross a cluster boundary, so the range is read one cluster at a time.
+    auto const begin = static_cast<std::uint64_t>(first);
+    auto const end = std::min(entries, begin + static_cast<std::uint64_t>(count));
+    auto const mask = std::make_unique<bool[]>(end - begin);
+    std::fill_n(mask.get(), end - begin, true);
+    auto* out = static_cast<std::byte*>(buffer);
+    auto const& descriptor = slot->reader->GetDescriptor();
+    try {
+      for (auto entry = begin; entry < end;) {
+        auto const clusterId = descriptor.FindClusterId(entry);
+        auto const& cluster = descriptor.GetClusterDescriptor(clusterId);
+        auto const clusterFirst = cluster.GetFirstEntryIndex();
+        auto const rows = std::min(end, clusterFirst + cluster.GetNEntries()) - entry;
+        auto const* values = slot->bulk->ReadBulk(
+          ROOT::RNTupleLocalIndex(clusterId, entry - clusterFirst), mask.get(), rows);
+        std::memcpy(out + (entry - begin) * size, values, rows * size);
+        entry += rows;
+      }
+    } catch (ROOT::RException const& e) {
+      throw std::runtime_error("ROOT_RField_Read_ContainerImp::readBulk got a ROOT exception: " +
+                               std::string(e.what()));
     }
 
-    return static_cast<int>(m_reader->GetNEntries());
+    releaseSlot(std::move(slot));
+    return static_cast<int>(end - begin);
   }
 
-  void ROOT_RField_Read_ContainerImp::createView(std::type_info const& type)
+  int ROOT_RField_Read_ContainerImp::entries()
   {
-    if (!m_reader) { //First time this RNTuple is read this job
-      if (!m_tfile) {
-        throw std::runtime_error("ROOT_RField_Read_ContainerImp::createView No file loaded to read "
-                                 "from on first read() call!");
-      }
+    auto slot = acquireSlot("entries");
 
-      m_reader = ROOT::RNTupleReader::Open(top_name(), m_tfile->GetName());
+    if (!slot->view &&
+        (slot->reader->GetDescriptor().FindFieldId(col_name()) == ROOT::kInvalidDescriptorId)) {
+      throw container_not_found("ROOT_RField_Read_ContainerImp::entries field " + col_name() +
+                                " does not exist");
     }
 
+    auto const result = static_cast<int>(slot->reader->GetNEntries());
+    releaseSlot(std::move(slot));
+    return result;
+  }
+
+  void ROOT_RField_Read_ContainerImp::createView(reader_slot& slot, std::type_info const& type)
+  {
+    if (slot.reader->GetDescriptor().FindFieldId(col_name()) == ROOT::kInvalidDescriptorId) {
+      throw container_not_found("ROOT_RField_Read_ContainerImp::createView field " + col_name() +
+                                " does not exist");
+    }
     try {
-      m_view =
-        std::make_unique<ROOT::RNTupleView<void>>(m_reader->GetView(col_name(), nullptr, type));
+      slot.view =
+        std::make_unique<ROOT::RNTupleView<void>>(slot.reader->GetView(col_name(), nullptr, type));
     } catch (ROOT::RException const& e) {
       //RNTupleView<void> will fail to create a field for fields written in streamer mode or for which type does not match the field's type on disk.  Passing an empty string for type forces it to create the same type of field as the object on disk.  Do this to handle streamer fields, then perform our own type check.
-      m_view =
-        std::make_unique<ROOT::RNTupleView<void>>(m_reader->GetView(col_name(), nullptr, ""));
+      slot.view =
+        std::make_unique<ROOT::RNTupleView<void>>(slot.reader->GetView(col_name(), nullptr, ""));
       //TClass takes the "std::" off of "std::vector<>" when RNTuple's on-disk format doesn't.  Convert RNTuple's type name to match TClass for manual type check because our dictionary of choice will likely be the same as TClass.
-      if (!TDictionary::GetDictionary(type) ||
-          !TDictionary::GetDictionary(m_view->GetField().GetTypeName().c_str()) ||
-          (strcmp(TDictionary::GetDictionary(m_view->GetField().GetTypeName().c_str())->GetName(),
-                  TDictionary::GetDictionary(type)->GetName()) != 0)) {
+      auto* const requested = TDictionary::GetDictionary(type);
+      auto* const on_disk = TDictionary::GetDictionary(slot.view->GetField().GetTypeName().c_str());
+      if (!requested || !on_disk || (strcmp(on_disk->GetName(), requested->GetName()) != 0)) {
         throw std::runtime_error(
           "ROOT_RField_Read_ContainerImp::createView type " + DemangleName(type) +
           " requested for a field named " + col_name() +
-          " does not match the type in the file: " + m_view->GetField().GetTypeName());
+          " does not match the type in the file: " + slot.view->GetField().GetTypeName());
       }
     }
   }
@@ -6,7 +6,9 @@
 #include "storage/storage_read_container.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 class TFile;
 
@@ -19,6 +21,7 @@ namespace ROOT {
 }
 
 namespace form::detail::experimental {
+  //An RNTupleReader may not be used from more than one thread at a time, so each concurrent read borrows a reader slot -- its own RNTupleReader and view -- from a pool.  Slots are created on demand, one per thread reading from this container at the same time.
   class ROOT_RField_Read_ContainerImp : public Storage_Read_Container {
   public:
     ROOT_RField_Read_ContainerImp(std::string const& name);
@@ -34,14 +37,20 @@ namespace form::detail::experimental {
     void setFile(std::shared_ptr<IStorage_File> file) override;
     void prime(std::type_info const& type) override;
     bool read(int id, void const** data, std::type_info const& type) override;
+    //Reads fields of fundamental type one cluster at a time through RNTuple's bulk API
+    int readBulk(int first, int count, void* buffer, std::type_info const& type) override;
     int entries() override;
 
   private:
+    struct reader_slot;
+
     std::shared_ptr<TFile> m_tfile;
-    std::unique_ptr<ROOT::RNTupleReader> m_reader;
-    std::unique_ptr<ROOT::RNTupleView<void>> m_view;
+    std::mutex m_slots_mutex;
+    std::vector<std::unique_ptr<reader_slot>> m_idle_slots;
 
-    void createView(std::type_info const& type);
+    std::unique_ptr<reader_slot> acquireSlot(std::string const& caller);
+    void releaseSlot(std::unique_ptr<reader_slot> slot);
+    void createView(reader_slot& slot, std::type_info const& type);
   };
 }
 
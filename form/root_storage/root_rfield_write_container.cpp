@@ -67,23 +67,11 @@ namespace form::detail::experimental {
       throw std::runtime_error(
         "ROOT_RField_Write_ContainerImp::fill No parent RNTuple set up before first fill() call");
     }
-
-    if (!m_rntuple_parent->m_writer) {
-      if (!m_tfile) {
-        throw std::runtime_error(
-          "ROOT_RField_Write_ContainerImp::fill No file loaded to write to on first fill() call");
-      }
-
-      m_rntuple_parent->m_writer =
-        ROOT::RNTupleWriter::Append(std::move(m_rntuple_parent->m_model), top_name(), *m_tfile);
-      m_rntuple_parent->m_entry = m_rntuple_parent->m_writer->CreateRawPtrWriteEntry();
+    if (!m_tfile) {
+      throw std::runtime_error(
+        "ROOT_RField_Write_ContainerImp::fill No file loaded to write to on first fill() call");
     }
-    m_rntuple_parent->m_entry->BindRawPtr(col_name(), data);
-
-    // Unlike a TBranch, an RNTuple entry is only written on commit();
-    // every field bound before that commit shares one entry.
-    // Return the 0-based index that pending entry will occupy (the current entry count).
-    return static_cast<std::uint64_t>(m_rntuple_parent->m_writer->GetNEntries());
+    return m_rntuple_parent->bind(col_name(), data);
   }
 
   void ROOT_RField_Write_ContainerImp::commit()
@@ -92,14 +80,7 @@ namespace form::detail::experimental {
       throw std::runtime_error("ROOT_RField_Write_ContainerImp::commit No parent RNTuple set up.  "
                                "You may have called commit() without calling setParent() first.");
     }
-
-    if (!m_rntuple_parent->m_entry) {
-      throw std::runtime_error(
-        "ROOT_RField_Write_ContainerImp::commit No RRawPtrWriteEntry set up.  "
-        "You may have called commit() without calling fill() first.");
-    }
-    assert(m_rntuple_parent->m_writer); //m_write and m_entry are set in the same place: fill()
-    m_rntuple_parent->m_writer->Fill(*m_rntuple_parent->m_entry);
+    m_rntuple_parent->fillEntry();
   }
 
   //setupWrite() may not be called after the first time fill() is called.
@@ -132,7 +113,7 @@ namespace form::detail::experimental {
       }
     }
 
-    m_rntuple_parent->m_model->AddField(std::move(field));
+    m_rntuple_parent->addField(std::move(field));
   }
 
 }
@@ -3,6 +3,8 @@
 #include "root_rntuple_write_container.hpp"
 #include "root_tfile.hpp"
 
+#include "ROOT/RNTupleFillContext.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
 #include "ROOT/RNTupleReader.hxx"
 #include "ROOT/RNTupleView.hxx"
 #include "ROOT/RNTupleWriter.hxx"
@@ -21,11 +23,21 @@ namespace form::detail::experimental {
     if (m_writer) {
       m_writer->CommitDataset();
     }
+    //Each fill context flushes its last cluster when destroyed; the parallel writer then
+    //commits the dataset.
+    m_slots.clear();
+    m_parallel_writer.reset();
   }
 
   void ROOT_RNTuple_Write_ContainerImp::setFile(std::shared_ptr<IStorage_File> file)
   {
     Storage_Write_Container::setFile(file);
+    m_file = dynamic_pointer_cast<ROOT_TFileImp>(file);
+    if (!m_file) {
+      throw std::runtime_error("ROOT_RNTuple_Write_ContainerImp::setFile failed to convert an "
+                               "IStorage_File to a ROOT_TFileImp.  "
+                               "ROOT_RNTuple_Write_ContainerImp only works with TFiles.");
+    }
     return;
   }
 
@@ -40,4 +52,73 @@ namespace form::detail::experimental {
   }
 
   void ROOT_RNTuple_Write_ContainerImp::setupWrite(std::type_info const& /*type*/) { return; }
+
+  void ROOT_RNTuple_Write_ContainerImp::addField(std::unique_ptr<ROOT::RFieldBase> field)
+  {
+    if (!m_model) {
+      throw std::runtime_error("ROOT_RNTuple_Write_ContainerImp::addField fields cannot be added "
+                               "to " +
+                               name() + " after its first entry was filled");
+    }
+    m_model->AddField(std::move(field));
+  }
+
+  std::uint64_t ROOT_RNTuple_Write_ContainerImp::bind(std::string const& field_name,
+                                                      void const* data)
+  {
+    std::call_once(m_writer_created, [this] { createWriter(); });
+
+    if (!m_parallel_writer) {
+      m_entry->BindRawPtr(field_name, data);
+      // Unlike a TBranch, an RNTuple entry is only written on commit();
+      // every field bound before that commit shares one entry.
+      // Return the 0-based index that pending entry will occupy (the current entry count).
+      return static_cast<std::uint64_t>(m_writer->GetNEntries());
+    }
+
+    auto& slot = m_slots.local();
+    if (!slot.context) {
+      slot.context = m_parallel_writer->CreateFillContext();
+      slot.entry = slot.context->GetModel().CreateRawPtrWriteEntry();
+    }
+    slot.entry->BindRawPtr(field_name, data);
+    // Rows are only assigned when a fill context flushes its cluster.  All fields of an entry,
+    // including the creator's index, still share one row.
+    return kDeferredRowId;
+  }
+
+  void ROOT_RNTuple_Write_ContainerImp::fillEntry()
+  {
+    if (m_parallel_writer) {
+      auto& slot = m_slots.local();
+      if (!slot.context) {
+        throw std::runtime_error("ROOT_RNTuple_Write_ContainerImp::fillEntry no entry was bound "
+                                 "on this thread for " +
+                                 name());
+      }
+      slot.context->Fill(*slot.entry);
+      return;
+    }
+    if (!m_entry) {
+      throw std::runtime_error(
+        "ROOT_RNTuple_Write_ContainerImp::fillEntry No RRawPtrWriteEntry set up.  "
+        "You may have called commit() without calling fill() first.");
+    }
+    m_writer->Fill(*m_entry);
+  }
+
+  void ROOT_RNTuple_Write_ContainerImp::createWriter()
+  {
+    if (!m_file) {
+      throw std::runtime_error(
+        "ROOT_RNTuple_Write_ContainerImp No file loaded to write to on first fill() call");
+    }
+    auto tfile = m_file->getTFile();
+    if (m_file->parallelFill()) {
+      m_parallel_writer = RNTupleParallelWriter::Append(std::move(m_model), name(), *tfile);
+    } else {
+      m_writer = ROOT::RNTupleWriter::Append(std::move(m_model), name(), *tfile);
+      m_entry = m_writer->CreateRawPtrWriteEntry();
+    }
+  }
 }
@@ -1,4 +1,5 @@
 //A ROOT_RNTuple_ContainerImp is a Storage_Write_Association (and therefore a Storage_Container) that coordinates the file accesses shared by several ROOT_RField_ContainerImps.  It only coordinates RNTuple-specific file-based resources and doesn't actually implement write() or read() for example.  This matches the early design of the TTree associative container.
+//If the file was given the "parallel_fill" attribute, entries are written through an RNTupleParallelWriter: each thread fills its own entry into its own fill context, which compresses and writes its clusters independently of the other threads.
 
 #ifndef FORM_ROOT_STORAGE_ROOT_RNTUPLE_WRITE_CONTAINER_HPP
 #define FORM_ROOT_STORAGE_ROOT_RNTUPLE_WRITE_CONTAINER_HPP
@@ -6,22 +7,30 @@
 #include "storage/storage_write_association.hpp"
 
 #include "RVersion.h"
+#include "oneapi/tbb/enumerable_thread_specific.h"
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 
 class TFile;
 
 namespace ROOT {
+  class RFieldBase;
   class RNTupleWriter;
   class RNTupleModel;
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6, 40, 0)
+  class RNTupleFillContext;
+  class RNTupleParallelWriter;
   namespace Detail {
     class RRawPtrWriteEntry;
   }
 #else
   namespace Experimental {
+    class RNTupleFillContext;
+    class RNTupleParallelWriter;
     namespace Detail {
       class RRawPtrWriteEntry;
     }
@@ -31,13 +40,19 @@ namespace ROOT {
 
 namespace form::detail::experimental {
 
-  //ROOT 6.40 moved RRawPtrWriteEntry from ROOT::Experimental::Detail to ROOT::Detail.
+  //ROOT 6.40 moved RRawPtrWriteEntry, RNTupleFillContext and RNTupleParallelWriter from ROOT::Experimental to ROOT.
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6, 40, 0)
   using RRawPtrWriteEntry = ROOT::Detail::RRawPtrWriteEntry;
+  using RNTupleFillContext = ROOT::RNTupleFillContext;
+  using RNTupleParallelWriter = ROOT::RNTupleParallelWriter;
 #else
   using RRawPtrWriteEntry = ROOT::Experimental::Detail::RRawPtrWriteEntry;
+  using RNTupleFillContext = ROOT::Experimental::RNTupleFillContext;
+  using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
 #endif
 
+  class ROOT_TFileImp;
+
   class ROOT_RNTuple_Write_ContainerImp : public Storage_Write_Association {
   public:
     ROOT_RNTuple_Write_ContainerImp(std::string const& name);
@@ -55,10 +70,35 @@ namespace form::detail::experimental {
     std::uint64_t fill(void const* data) override;
     void commit() override;
 
-    //State shared by ROOT_RField_ContainerImps
-    std::unique_ptr<ROOT::RNTupleWriter> m_writer;
+    //Interface for ROOT_RField_ContainerImps
+    //addField() may not be called once the first entry has been bound.
+    void addField(std::unique_ptr<ROOT::RFieldBase> field);
+    //Binds data to a field of the calling thread's pending entry, creating the writer on first
+    //use.  Returns the row the entry will be written to, or kDeferredRowId with parallel fills.
+    std::uint64_t bind(std::string const& field_name, void const* data);
+    //Writes the calling thread's pending entry
+    void fillEntry();
+
+  private:
+    struct fill_slot {
+      std::shared_ptr<RNTupleFillContext> context;
+      std::unique_ptr<RRawPtrWriteEntry> entry;
+    };
+
+    void createWriter();
+
+    std::shared_ptr<ROOT_TFileImp> m_file;
     std::unique_ptr<ROOT::RNTupleModel> m_model;
+    std::once_flag m_writer_created;
+
+    //Sequential writing
+    std::unique_ptr<ROOT::RNTupleWriter> m_writer;
     std::unique_ptr<RRawPtrWriteEntry> m_entry;
+
+    //Parallel writing: one fill context and entry per thread.  The slots must be destroyed
+    //before the parallel writer.
+    std::unique_ptr<RNTupleParallelWriter> m_parallel_writer;
+    tbb::enumerable_thread_specific<fill_slot> m_slots;
   };
 }
 
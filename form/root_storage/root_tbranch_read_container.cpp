@@ -5,30 +5,36 @@
 #include "root_tfile.hpp"
 
 #include "TBranch.h"
+#include "TBufferFile.h"
 #include "TFile.h"
 #include "TLeaf.h"
+#include "TMath.h"
 #include "TTree.h"
 
 #include <gsl/pointers>
 
-#include <mutex>
-#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
 
 using namespace form::detail::experimental;
 
-namespace {
-  std::mutex& root_tbranch_read_mutex()
-  {
-    static std::mutex m;
-    return m;
-  }
-}
+struct ROOT_TBranch_Read_ContainerImp::reader_slot {
+  std::unique_ptr<TFile> file;
+  TTree* tree{nullptr};     // Owned by file
+  TBranch* branch{nullptr}; // Owned by tree
+  // Receives one basket at a time from readBulk(); grows to the largest basket read
+  TBufferFile bulk_buffer{TBuffer::kWrite, 32 * 1024};
+};
 
 ROOT_TBranch_Read_ContainerImp::ROOT_TBranch_Read_ContainerImp(std::string const& name) :
   Storage_Read_Container(name)
 {
 }
 
+ROOT_TBranch_Read_ContainerImp::~ROOT_TBranch_Read_ContainerImp() = default;
+
 void ROOT_TBranch_Read_ContainerImp::setFile(std::shared_ptr<IStorage_File> file)
 {
   auto* root_tfile_imp = dynamic_cast<ROOT_TFileImp*>(file.get());
@@ -39,26 +45,50 @@ void ROOT_TBranch_Read_ContainerImp::setFile(std::shared_ptr<IStorage_File> file
   m_tfile = root_tfile_imp->getTFile();
 }
 
-void ROOT_TBranch_Read_ContainerImp::prime(std::type_info const& type)
+auto ROOT_TBranch_Read_ContainerImp::acquireSlot(std::string const& caller)
+  -> std::unique_ptr<reader_slot>
 {
-  std::scoped_lock guard(root_tbranch_read_mutex());
+  {
+    std::scoped_lock guard(m_slots_mutex);
+    if (!m_idle_slots.empty()) {
+      auto slot = std::move(m_idle_slots.back());
+      m_idle_slots.pop_back();
+      return slot;
+    }
+  }
 
+  // No idle slot: open a new one outside the lock so that other threads may keep reading.
   if (m_tfile == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::prime no file attached");
-  }
-  if (m_tree == nullptr) {
-    m_tree = m_tfile->Get<TTree>(top_name().c_str());
+    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::" + caller + " no file attached");
   }
-  if (m_tree == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::prime no tree found with name " +
-                             top_name());
+  auto slot = std::make_unique<reader_slot>();
+  slot->file.reset(TFile::Open(m_tfile->GetName(), "READ"));
+  if (slot->file == nullptr || slot->file->IsZombie()) {
+    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::" + caller +
+                             " unable to open file " + m_tfile->GetName());
   }
-  if (m_branch == nullptr) {
-    m_branch = m_tree->GetBranch(col_name().c_str());
+  slot->tree = slot->file->Get<TTree>(top_name().c_str());
+  if (slot->tree == nullptr) {
+    throw container_not_found("ROOT_TBranch_Read_ContainerImp::" + caller +
+                              " no tree found with name " + top_name());
   }
-  if (m_branch == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::prime no branch found");
+  slot->branch = slot->tree->GetBranch(col_name().c_str());
+  if (slot->branch == nullptr) {
+    throw container_not_found("ROOT_TBranch_Read_ContainerImp::" + caller + " no branch found");
   }
+  return slot;
+}
+
+void ROOT_TBranch_Read_ContainerImp::releaseSlot(std::unique_ptr<reader_slot> slot)
+{
+  std::scoped_lock guard(m_slots_mutex);
+  m_idle_slots.push_back(std::move(slot));
+}
+
+void ROOT_TBranch_Read_ContainerImp::prime(std::type_info const& type)
+{
+  // Opening the first slot here validates the tree and branch before any reads are issued.
+  releaseSlot(acquireSlot("prime"));
 
   auto* dictInfo = TDictionary::GetDictionary(type);
   if (!dictInfo) {
@@ -78,25 +108,10 @@ void ROOT_TBranch_Read_ContainerImp::prime(std::type_info const& type)
 
 bool ROOT_TBranch_Read_ContainerImp::read(int id, void const** data, std::type_info const& type)
 {
-  std::scoped_lock guard(root_tbranch_read_mutex());
-
-  if (m_tfile == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::read no file attached");
-  }
-  if (m_tree == nullptr) {
-    m_tree = m_tfile->Get<TTree>(top_name().c_str());
-  }
-  if (m_tree == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::read no tree found with name " +
-                             top_name());
-  }
-  if (m_branch == nullptr) {
-    m_branch = m_tree->GetBranch(col_name().c_str());
-  }
-  if (m_branch == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::read no branch found");
-  }
-  if (id >= m_tree->GetEntries()) {
+  // A slot that is in use by a failed read is not returned to the pool; it is simply closed.
+  auto slot = acquireSlot("read");
+  if (id >= slot->tree->GetEntries()) {
+    releaseSlot(std::move(slot));
     return false;
   }
 
@@ -157,7 +172,7 @@ bool ROOT_TBranch_Read_ContainerImp::read(int id, void const** data, std::type_i
         std::string{"ROOT_TBranch_ContainerImp::read unsupported fundamental type: "} +
         DemangleName(type));
     };
-    branchStatus = m_tree->SetBranchAddress(
+    branchStatus = slot->tree->SetBranchAddress(
       col_name().c_str(), branchBuffer, nullptr, EDataType(fundInfo->GetType()), false);
   } else {
     auto* klass = TClass::GetClass(type);
@@ -169,7 +184,7 @@ bool ROOT_TBranch_Read_ContainerImp::read(int id, void const** data, std::type_i
     // ROOT returns ownership of dynamically created branch payload objects here.
     // NOLINTNEXTLINE(readability-redundant-casting)
     branchBuffer = gsl::owner<void*>{klass->New()};
-    branchStatus = m_tree->SetBranchAddress(
+    branchStatus = slot->tree->SetBranchAddress(
       col_name().c_str(), reinterpret_cast<void*>(&branchBuffer), klass, EDataType::kOther_t, true);
   }
 
@@ -180,35 +195,88 @@ bool ROOT_TBranch_Read_ContainerImp::read(int id, void const** data, std::type_i
       std::to_string(branchStatus));
   }
 
-  Long64_t tentry = m_tree->LoadTree(id);
-  m_branch->GetEntry(tentry);
+  Long64_t tentry = slot->tree->LoadTree(id);
+  slot->branch->GetEntry(tentry);
   *data = branchBuffer;
 
   // Reset the branch address to avoid unwanted ownership issues.
-  m_branch->ResetAddress();
+  slot->branch->ResetAddress();
+  releaseSlot(std::move(slot));
 
   return true;
 }
 
-int ROOT_TBranch_Read_ContainerImp::entries()
+int ROOT_TBranch_Read_ContainerImp::readBulk(int first,
+                                             int count,
+                                             void* buffer,
+                                             std::type_info const& type)
 {
-  std::scoped_lock guard(root_tbranch_read_mutex());
-
-  if (m_tfile == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::entries no file attached");
-  }
-  if (m_tree == nullptr) {
-    m_tree = m_tfile->Get<TTree>(top_name().c_str());
+  auto* dictInfo = TDictionary::GetDictionary(type);
+  if (!dictInfo || !(dictInfo->Property() & EProperty::kIsFundamental)) {
+    throw std::runtime_error(
+      std::string{"ROOT_TBranch_Read_ContainerImp::readBulk type is not fundamental: "} +
+      DemangleName(type));
   }
-  if (m_tree == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::entries no tree found with name " +
-                             top_name());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  auto* fundInfo = static_cast<TDataType*>(dictInfo); // Already checked to be fundamental
+  auto const size = static_cast<std::size_t>(fundInfo->Size());
+
+  auto slot = acquireSlot("readBulk");
+  Long64_t const entries = slot->tree->GetEntries();
+  if (first < 0 || count <= 0 || first >= entries) {
+    releaseSlot(std::move(slot));
+    return 0;
   }
-  if (m_branch == nullptr) {
-    m_branch = m_tree->GetBranch(col_name().c_str());
+  auto const end = std::min<Long64_t>(entries, Long64_t{first} + count);
+  auto* out = static_cast<std::byte*>(buffer);
+  Long64_t entry = first;
+
+  // Bulk reads hand back whole baskets in host byte order, without creating an object per entry.
+  auto& bulk = slot->branch->GetBulkRead();
+  if (bulk.SupportsBulkRead()) {
+    while (entry < end) {
+      Long64_t const* basketEntry = slot->branch->GetBasketEntry();
+      auto const nBaskets = Long64_t{slot->branch->GetWriteBasket()} + 1;
+      auto const basketFirst = basketEntry[TMath::BinarySearch(nBaskets, basketEntry, entry)];
+      auto const available = bulk.GetBulkEntries(basketFirst, slot->bulk_buffer);
+      if (available <= entry - basketFirst) {
+        break; // Left to the entry-by-entry reads below
+      }
+      auto const rows = std::min<Long64_t>(end, basketFirst + available) - entry;
+      auto const* values = slot->bulk_buffer.GetCurrent();
+      std::memcpy(out + static_cast<std::size_t>(entry - first) * size,
+                  values + static_cast<std::size_t>(entry - basketFirst) * size,
+                  static_cast<std::size_t>(rows) * size);
+      entry += rows;
+    }
   }
-  if (m_branch == nullptr) {
-    throw std::runtime_error("ROOT_TBranch_Read_ContainerImp::entries no branch found");
+
+  if (entry < end) {
+    // The branch address is set once for the whole range rather than once per entry.
+    alignas(Long64_t) std::byte value[sizeof(Long64_t)];
+    auto const branchStatus = slot->tree->SetBranchAddress(
+      col_name().c_str(), value, nullptr, EDataType(fundInfo->GetType()), false);
+    if (branchStatus < 0) {
+      throw std::runtime_error(
+        std::string{"ROOT_TBranch_Read_ContainerImp::readBulk SetBranchAddress() failed"} +
+        " (col_name='" + col_name() + "', type='" + DemangleName(type) + "')" +
+        " with error code " + std::to_string(branchStatus));
+    }
+    for (; entry < end; ++entry) {
+      slot->branch->GetEntry(slot->tree->LoadTree(entry));
+      std::memcpy(out + static_cast<std::size_t>(entry - first) * size, value, size);
+    }
+    slot->branch->ResetAddress();
   }
-  return static_cast<int>(m_tree->GetEntries());
+
+  releaseSlot(std::move(slot));
+  return static_cast<int>(end - first);
+}
+
+int ROOT_TBranch_Read_ContainerImp::entries()
+{
+  auto slot = acquireSlot("entries");
+  auto const result = static_cast<int>(slot->tree->GetEntries());
+  releaseSlot(std::move(slot));
+  return result;
 }
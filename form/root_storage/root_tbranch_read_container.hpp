@@ -6,29 +6,42 @@
 #include "storage/storage_read_container.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 class TFile;
-class TTree;
-class TBranch;
 
 namespace form::detail::experimental {
 
+  // Reads from one TBranch may be issued concurrently.  TTree and TBranch objects cannot be
+  // shared between threads, so each concurrent read borrows a reader slot -- its own TFile
+  // handle together with the tree and branch it owns -- from a pool.  Slots are created on
+  // demand, so the pool grows to the number of threads that have read from the container at
+  // the same time.
   class ROOT_TBranch_Read_ContainerImp : public Storage_Read_Container {
   public:
     explicit ROOT_TBranch_Read_ContainerImp(std::string const& name);
-    ~ROOT_TBranch_Read_ContainerImp() override = default;
+    ~ROOT_TBranch_Read_ContainerImp() override;
 
     void setFile(std::shared_ptr<IStorage_File> file) override;
     void prime(std::type_info const& type) override;
 
     bool read(int id, void const** data, std::type_info const& type) override;
+    // Reads whole baskets of a fundamental-type branch with ROOT's bulk I/O, falling back to
+    // reading entry by entry into the caller's buffer for branches that do not support it
+    int readBulk(int first, int count, void* buffer, std::type_info const& type) override;
     int entries() override;
 
   private:
+    struct reader_slot;
+
+    std::unique_ptr<reader_slot> acquireSlot(std::string const& caller);
+    void releaseSlot(std::unique_ptr<reader_slot> slot);
+
     std::shared_ptr<TFile> m_tfile;
-    TTree* m_tree{nullptr};
-    TBranch* m_branch{nullptr};
+    std::mutex m_slots_mutex;
+    std::vector<std::unique_ptr<reader_slot>> m_idle_slots;
   };
 
 } // namespace form::detail::experimental
@@ -3,11 +3,67 @@
 #include "root_tfile.hpp"
 
 #include "TFile.h"
+#include "TROOT.h"
+
+#include "oneapi/tbb/global_control.h"
+
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 
 using namespace form::detail::experimental;
+
+namespace {
+  // ROOT's implicit MT runs its (de)compression tasks in a TBB arena of its own.  TBB worker
+  // threads are shared by every arena of the process and capped by tbb::global_control, which
+  // Phlex sets from its -j option; sizing ROOT's arena from the same limit therefore adds
+  // parallelism without adding threads.  Implicit MT is process-wide and cannot be resized, so
+  // a request for a different number of threads than the first one is rejected.
+  void enableImplicitMT(std::string const& value)
+  {
+    if (value == "false") {
+      return;
+    }
+    using control = tbb::global_control;
+    auto threads = static_cast<unsigned>(control::active_value(control::max_allowed_parallelism));
+    if (value != "true") {
+      unsigned requested = 0;
+      auto const* last = value.data() + value.size();
+      auto const [end, error] = std::from_chars(value.data(), last, requested);
+      if (error != std::errc{} || end != last || requested == 0) {
+        throw std::runtime_error("ROOT_TFileImp: implicit_mt must be true, false or a positive "
+                                 "number of threads, not " +
+                                 value);
+      }
+      threads = std::min(threads, requested);
+    }
+
+    static std::mutex mutex;
+    static unsigned enabled_threads = 0; // 0 until the first request
+    std::scoped_lock const lock{mutex};
+    if (enabled_threads == 0) {
+      if (threads > 1 && !ROOT::IsImplicitMTEnabled()) {
+        ROOT::EnableImplicitMT(threads);
+      }
+      enabled_threads = threads;
+    } else if (threads != enabled_threads) {
+      throw std::runtime_error("ROOT_TFileImp: implicit_mt was already set up for " +
+                               std::to_string(enabled_threads) +
+                               " thread(s) and cannot be changed to " + std::to_string(threads));
+    }
+  }
+}
+
 ROOT_TFileImp::ROOT_TFileImp(std::string const& name, char mode) :
   Storage_File(name, mode), m_file(nullptr)
 {
+  // Read containers open their own TFile handles from several threads; ROOT's global state
+  // must be protected before the first file is opened.
+  static std::once_flag thread_safety_enabled;
+  std::call_once(thread_safety_enabled, [] { ROOT::EnableThreadSafety(); });
+
   if (mode == 'c' || mode == 'r' || mode == 'o') {
     m_file.reset(TFile::Open(name.c_str(), "RECREATE"));
   } else {
@@ -36,9 +92,16 @@ void ROOT_TFileImp::setAttribute(std::string const& key, std::string const& valu
     }
 
     m_file->SetCompressionAlgorithm(compression);
+  } else if (key == "parallel_fill") {
+    // Lets several threads fill the same RNTuple concurrently, each compressing its own clusters
+    m_parallel_fill = (value == "true");
+  } else if (key == "implicit_mt") {
+    enableImplicitMT(value);
   } else {
     throw std::runtime_error("ROOT_TFileImp does not recognize an attribute named " + key);
   }
 }
 
 std::shared_ptr<TFile> ROOT_TFileImp::getTFile() { return m_file; }
+
+bool ROOT_TFileImp::parallelFill() const { return m_parallel_fill; }
@@ -20,9 +20,12 @@ namespace form::detail::experimental {
     void setAttribute(std::string const& key, std::string const& value) override;
 
     std::shared_ptr<TFile> getTFile();
+    // Whether RNTuples in this file are written through per-thread fill contexts
+    bool parallelFill() const;
 
   private:
     std::shared_ptr<TFile> m_file;
+    bool m_parallel_fill = false;
   };
 
 } // namespace form::detail::experimental
@@ -20,6 +20,18 @@
 #include "root_storage/root_rntuple_write_container.hpp"
 #endif
 
+#ifdef USE_HDF5_STORAGE
+#include "hdf5_storage/hdf5_file.hpp"
+#include "hdf5_storage/hdf5_read_container.hpp"
+#include "hdf5_storage/hdf5_write_container.hpp"
+#endif
+
+#ifdef USE_COLUMNAR_STORAGE
+#include "columnar_storage/columnar_file.hpp"
+#include "columnar_storage/columnar_read_container.hpp"
+#include "columnar_storage/columnar_write_container.hpp"
+#endif
+
 #include <stdexcept>
 
 namespace form::detail::experimental {
@@ -41,7 +53,17 @@ namespace form::detail::experimental {
       throw std::runtime_error("FORM: ROOT support is not compiled into this build");
 #endif
     case Major::hdf5:
-      throw std::runtime_error("FORM: HDF5 storage is recognized but not yet implemented");
+#ifdef USE_HDF5_STORAGE
+      return std::make_shared<HDF5_FileImp>(name, mode);
+#else
+      throw std::runtime_error("FORM: HDF5 support is not compiled into this build");
+#endif
+    case Major::columnar:
+#ifdef USE_COLUMNAR_STORAGE
+      return std::make_shared<Columnar_FileImp>(name, mode);
+#else
+      throw std::runtime_error("FORM: columnar storage is not compiled into this build");
+#endif
     }
     throw std::runtime_error("FORM: unsupported storage technology requested");
   }
@@ -70,7 +92,19 @@ namespace form::detail::experimental {
       throw std::runtime_error("FORM: ROOT support is not compiled into this build");
 #endif
     case Major::hdf5:
-      throw std::runtime_error("FORM: HDF5 storage is recognized but not yet implemented");
+#ifdef USE_HDF5_STORAGE
+      // Containers are independent; there is nothing to associate.
+      return std::make_shared<Storage_Write_Association>(name);
+#else
+      throw std::runtime_error("FORM: HDF5 support is not compiled into this build");
+#endif
+    case Major::columnar:
+#ifdef USE_COLUMNAR_STORAGE
+      // Columns are independent; there is nothing to associate.
+      return std::make_shared<Storage_Write_Association>(name);
+#else
+      throw std::runtime_error("FORM: columnar storage is not compiled into this build");
+#endif
     }
     throw std::runtime_error("FORM: unsupported storage technology requested");
   }
@@ -99,7 +133,17 @@ namespace form::detail::experimental {
       throw std::runtime_error("FORM: ROOT support is not compiled into this build");
 #endif
     case Major::hdf5:
-      throw std::runtime_error("FORM: HDF5 storage is recognized but not yet implemented");
+#ifdef USE_HDF5_STORAGE
+      return std::make_shared<HDF5_Read_ContainerImp>(name);
+#else
+      throw std::runtime_error("FORM: HDF5 support is not compiled into this build");
+#endif
+    case Major::columnar:
+#ifdef USE_COLUMNAR_STORAGE
+      return std::make_shared<Columnar_Read_ContainerImp>(name);
+#else
+      throw std::runtime_error("FORM: columnar storage is not compiled into this build");
+#endif
     }
     throw std::runtime_error("FORM: unsupported storage technology requested");
   }
@@ -128,7 +172,17 @@ namespace form::detail::experimental {
       throw std::runtime_error("FORM: ROOT support is not compiled into this build");
 #endif
     case Major::hdf5:
-      throw std::runtime_error("FORM: HDF5 storage is recognized but not yet implemented");
+#ifdef USE_HDF5_STORAGE
+      return std::make_shared<HDF5_Write_ContainerImp>(name);
+#else
+      throw std::runtime_error("FORM: HDF5 support is not compiled into this build");
+#endif
+    case Major::columnar:
+#ifdef USE_COLUMNAR_STORAGE
+      return std::make_shared<Columnar_Write_ContainerImp>(name);
+#else
+      throw std::runtime_error("FORM: columnar storage is not compiled into this build");
+#endif
     }
     throw std::runtime_error("FORM: unsupported storage technology requested");
   }
@@ -6,11 +6,13 @@
 #include "core/placement.hpp"
 #include "core/token.hpp"
 #include "form/config.hpp"
+#include "storage/storage_index.hpp"
 
 #include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -19,6 +21,17 @@ namespace form::detail::experimental {
   // Sentinel returned by the write chain when no addressable row was written
   // (e.g. the generic no-op container). A real row is always < this value.
   inline constexpr std::uint64_t kInvalidRowId = std::numeric_limits<std::uint64_t>::max();
+  // Sentinel returned when a row was written but its number is only assigned later, when the
+  // storage flushes (e.g. RNTuple parallel fills).  Such a product shares its row with the
+  // creator's index entry and is located through the index.
+  inline constexpr std::uint64_t kDeferredRowId = kInvalidRowId - 1;
+
+  // Thrown by a read container that is used although it does not exist in its file, so that
+  // callers can tell an absent container from one that cannot be read.
+  class container_not_found : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+  };
 
   class IStorageReader {
   public:
@@ -33,25 +46,43 @@ namespace form::detail::experimental {
                        form::experimental::config::tech_setting_config const& settings) = 0;
     virtual std::vector<std::string> listIndices(
       Token const& token, form::experimental::config::tech_setting_config const& settings) = 0;
+    // The data cells of the rows of an index container, in row order; see storage_index.hpp
+    virtual std::vector<IndexCell> listIndexCells(
+      Token const& token, form::experimental::config::tech_setting_config const& settings) = 0;
     virtual void readContainer(Token const& token,
                                void const** data,
                                std::type_info const& type,
                                form::experimental::config::tech_setting_config const& settings) = 0;
+    // Reads 'count' rows starting at the token's row; see IStorage_Read_Container::readBulk
+    virtual int readContainerBulk(
+      Token const& token,
+      int count,
+      void* buffer,
+      std::type_info const& type,
+      form::experimental::config::tech_setting_config const& settings) = 0;
   };
 
+  class IStorage_Write_Container;
+
   class IStorageWriter {
   public:
     IStorageWriter() = default;
     virtual ~IStorageWriter() = default;
 
-    virtual void createContainers(
+    // Creates the containers that do not exist yet and returns, for each placement, the
+    // container it is written through.  The containers are owned by the storage writer and
+    // remain valid for its lifetime, so callers may write through them directly.
+    virtual std::map<Placement const*, IStorage_Write_Container*> createContainers(
       std::map<std::unique_ptr<Placement>, std::type_info const*> const& containers,
       form::experimental::config::tech_setting_config const& settings) = 0;
-    // Returns the 0-based row (entry) number written, or kInvalidRowId if no rows
+    // Returns the 0-based row (entry) number written, kDeferredRowId if the row is only
+    // assigned later, or kInvalidRowId if no rows
     virtual std::uint64_t fillContainer(Placement const& plcmnt,
                                         void const* data,
                                         std::type_info const& type) = 0;
     virtual void commitContainers(Placement const& plcmnt) = 0;
+    // Writes the rows buffered by every container (see IStorage_Write_Container::flush)
+    virtual void flushContainers() = 0;
   };
 
   class IStorage_File {
@@ -74,9 +105,13 @@ namespace form::detail::experimental {
 
     virtual void setFile(std::shared_ptr<IStorage_File> file) = 0;
     virtual void setupWrite(std::type_info const& type = typeid(void)) = 0;
-    // Returns the 0-based row (entry) number written, or kInvalidRowId if no rows
+    // Returns the 0-based row (entry) number written, kDeferredRowId if the row is only
+    // assigned later, or kInvalidRowId if no rows
     virtual std::uint64_t fill(void const* data) = 0;
     virtual void commit() = 0;
+    // Writes the rows a container buffers beyond their commit, e.g. until a chunk is full; called
+    // once the output ends, so that a failure to write them is thrown rather than lost.
+    virtual void flush() = 0;
 
     virtual void setAttribute(std::string const& name, std::string const& value) = 0;
   };
@@ -91,6 +126,10 @@ namespace form::detail::experimental {
     virtual void setFile(std::shared_ptr<IStorage_File> file) = 0;
     virtual void prime(std::type_info const& type) = 0;
     virtual bool read(int id, void const** data, std::type_info const& type) = 0;
+    // Reads rows [first, first + count) of a container of fundamental type into 'buffer', which
+    // must have room for 'count' contiguous values of that type.  Returns the number of rows
+    // read, which is only less than 'count' at the end of the container.
+    virtual int readBulk(int first, int count, void* buffer, std::type_info const& type) = 0;
     virtual int entries() = 0;
 
     virtual void setAttribute(std::string const& name, std::string const& value) = 0;
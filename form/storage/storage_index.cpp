@@ -0,0 +1,192 @@
+// Copyright (C) 2025 ...
+
+#include "storage_index.hpp"
+
+#include <cctype>
+#include <string_view>
+
+namespace {
+  std::string trim_copy(std::string const& value)
+  {
+    auto begin = value.find_first_not_of(' ');
+    if (begin == std::string::npos) {
+      return {};
+    }
+    auto end = value.find_last_not_of(' ');
+    return value.substr(begin, end - begin + 1);
+  }
+
+  std::optional<long long> parse_index_number(std::string const& value)
+  {
+    if (value.empty()) {
+      return std::nullopt;
+    }
+
+    for (char ch : value) {
+      if (!std::isdigit(static_cast<unsigned char>(ch))) {
+        return std::nullopt;
+      }
+    }
+
+    try {
+      return std::stoll(value, nullptr, 10);
+    } catch (...) {
+      return std::nullopt;
+    }
+  }
+
+  // 64-bit FNV-1a
+  constexpr std::uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+  constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+
+  std::uint64_t fnv1a(std::uint64_t hash, std::string_view bytes)
+  {
+    for (char ch : bytes) {
+      hash ^= static_cast<unsigned char>(ch);
+      hash *= fnv_prime;
+    }
+    return hash;
+  }
+
+  std::uint64_t fnv1a(std::uint64_t hash, std::uint64_t value)
+  {
+    for (int shift = 0; shift != 64; shift += 8) {
+      hash ^= (value >> shift) & 0xffU;
+      hash *= fnv_prime;
+    }
+    return hash;
+  }
+}
+
+namespace form::detail::experimental {
+
+  std::string indexKeyContainerName(std::string const& index_container)
+  {
+    return index_container + "_key";
+  }
+
+  std::string indexCellContainerName(std::string const& index_container)
+  {
+    return index_container + "_cell";
+  }
+
+  std::uint64_t indexKey(std::string const& id)
+  {
+    // Structured and textual ids are hashed from different seeds.
+    auto const normalized = normalize_structured_index(id);
+    if (!normalized) {
+      return fnv1a(fnv1a(fnv_offset_basis, "t"), id);
+    }
+
+    auto hash = fnv1a(fnv_offset_basis, "s");
+    for (auto const& [layer, number] : *normalized) {
+      // The separator keeps a layer name from running into the next component.
+      hash = fnv1a(fnv1a(hash, layer), ":");
+      hash = fnv1a(hash, static_cast<std::uint64_t>(number));
+    }
+    return hash;
+  }
+
+  bool is_structured_index_id(std::string const& id)
+  {
+    return id.size() >= 2 && id.front() == '[' && id.back() == ']';
+  }
+
+  std::optional<std::map<std::string, long long>> normalize_structured_index(std::string const& id)
+  {
+    auto const components = structured_index_components(id);
+    if (!components || components->empty()) {
+      return std::nullopt;
+    }
+
+    std::map<std::string, long long> normalized;
+    for (auto [layer, number] : *components) {
+      for (char& ch : layer) {
+        ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+      }
+      normalized[layer] = number;
+    }
+    return normalized;
+  }
+
+  std::optional<std::vector<std::pair<std::string, long long>>> structured_index_components(
+    std::string const& id)
+  {
+    if (!is_structured_index_id(id)) {
+      return std::nullopt;
+    }
+
+    std::string const body = id.substr(1, id.size() - 2);
+    std::string token;
+    std::vector<std::pair<std::string, long long>> components;
+
+    auto commit_token = [&components](std::string const& raw_token) -> bool {
+      auto const token_trimmed = trim_copy(raw_token);
+      if (token_trimmed.empty()) {
+        return true;
+      }
+
+      auto const sep = token_trimmed.find_first_of(":=");
+      if (sep == std::string::npos) {
+        return false;
+      }
+
+      auto key = trim_copy(token_trimmed.substr(0, sep));
+      auto value = trim_copy(token_trimmed.substr(sep + 1));
+      if (key.empty() || value.empty()) {
+        return false;
+      }
+
+      auto parsed = parse_index_number(value);
+      if (!parsed) {
+        return false;
+      }
+
+      components.emplace_back(std::move(key), *parsed);
+      return true;
+    };
+
+    for (char ch : body) {
+      if (ch == ',' || ch == ';') {
+        if (!commit_token(token)) {
+          return std::nullopt;
+        }
+        token.clear();
+      } else {
+        token.push_back(ch);
+      }
+    }
+
+    if (!commit_token(token)) {
+      return std::nullopt;
+    }
+    return components;
+  }
+
+  std::uint64_t layerPathKey(std::vector<std::string> const& layers)
+  {
+    auto hash = fnv1a(fnv_offset_basis, "p");
+    for (auto const& layer : layers) {
+      hash = fnv1a(fnv1a(hash, layer), ":");
+    }
+    return hash;
+  }
+
+  std::vector<std::uint64_t> indexCell(std::string const& id)
+  {
+    auto const components = structured_index_components(id);
+    if (!components) {
+      return {};
+    }
+
+    std::vector<std::string> layers;
+    std::vector<std::uint64_t> result(1);
+    for (auto const& [layer, number] : *components) {
+      layers.push_back(layer);
+      result.push_back(static_cast<std::uint64_t>(number));
+    }
+    result.front() = layerPathKey(layers);
+    return result;
+  }
+
+} // namespace form::detail::experimental
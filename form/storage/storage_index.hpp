@@ -0,0 +1,61 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_STORAGE_STORAGE_INDEX_HPP
+#define FORM_STORAGE_STORAGE_INDEX_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* An index container holds, for each row, the id string of the data cell written in that row.
+ * Its companion key container holds, for the same row, the indexKey() of that id, so that a
+ * reader can locate a row by binary search over a sorted array of integers instead of loading
+ * and comparing every id string.  Its companion cell container holds, for the same row, the
+ * indexCell() of that id, from which the data cell can be rebuilt without the string.  Files
+ * written before key or cell containers existed are read through the id strings.
+ */
+namespace form::detail::experimental {
+
+  /// Name of the key container that accompanies the named index container
+  std::string indexKeyContainerName(std::string const& index_container);
+
+  /// Name of the cell container that accompanies the named index container
+  std::string indexCellContainerName(std::string const& index_container);
+
+  /// Key of an index id.  A structured id such as "[run:1, event:7]" is keyed by its normalized
+  /// components, so ids differing only in spacing, separators, layer-name case or component
+  /// order share a key.  Any other id is keyed by its exact text.
+  std::uint64_t indexKey(std::string const& id);
+
+  bool is_structured_index_id(std::string const& id);
+
+  /// Lower-cased layer name -> number, or nullopt if the id is not a well-formed structured id
+  std::optional<std::map<std::string, long long>> normalize_structured_index(std::string const& id);
+
+  /// (layer name, number) of each component in the order written, or nullopt if the id is not a
+  /// well-formed structured id.  "[]", the job, has no components.
+  std::optional<std::vector<std::pair<std::string, long long>>> structured_index_components(
+    std::string const& id);
+
+  /// Key of a sequence of layer names, outermost first
+  std::uint64_t layerPathKey(std::vector<std::string> const& layers);
+
+  /// What the cell container stores for an id: the layerPathKey() of its layers followed by its
+  /// number in each layer, or nothing if the id is not a structured id
+  std::vector<std::uint64_t> indexCell(std::string const& id);
+
+  /// A data cell read back from an index: its layers, outermost first, shared between all cells
+  /// with the same layers, and its number in each.  'layers' is null if the row's id does not
+  /// name a data cell.
+  struct IndexCell {
+    std::shared_ptr<std::vector<std::string> const> layers;
+    std::vector<std::uint64_t> numbers;
+  };
+
+} // namespace form::detail::experimental
+
+#endif // FORM_STORAGE_STORAGE_INDEX_HPP
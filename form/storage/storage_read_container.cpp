@@ -3,8 +3,48 @@
 #include "storage_read_container.hpp"
 #include "storage_file.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
 using namespace form::detail::experimental;
 
+namespace {
+  struct fundamental_type {
+    std::type_info const* type;
+    std::size_t size;
+    void (*destroy)(void const*);
+  };
+
+  template <typename T>
+  fundamental_type fundamental()
+  {
+    return {&typeid(T), sizeof(T), [](void const* data) { delete static_cast<T const*>(data); }};
+  }
+
+  fundamental_type const* findFundamental(std::type_info const& type)
+  {
+    static std::array const types{fundamental<bool>(),
+                                  fundamental<char>(),
+                                  fundamental<signed char>(),
+                                  fundamental<unsigned char>(),
+                                  fundamental<short>(),
+                                  fundamental<unsigned short>(),
+                                  fundamental<int>(),
+                                  fundamental<unsigned int>(),
+                                  fundamental<long>(),
+                                  fundamental<unsigned long>(),
+                                  fundamental<long long>(),
+                                  fundamental<unsigned long long>(),
+                                  fundamental<float>(),
+                                  fundamental<double>()};
+    auto it = std::ranges::find_if(types, [&type](auto const& t) { return *t.type == type; });
+    return it != types.end() ? &*it : nullptr;
+  }
+}
+
 Storage_Read_Container::Storage_Read_Container(std::string const& name) :
   m_name(name), m_file(nullptr)
 {
@@ -35,6 +75,22 @@ bool Storage_Read_Container::read(int /* id*/,
   return false;
 }
 
+int Storage_Read_Container::readBulk(int first, int count, void* buffer, std::type_info const& type)
+{
+  auto const* fundamental = findFundamental(type);
+  if (fundamental == nullptr) {
+    throw std::runtime_error("Storage_Read_Container::readBulk type " + std::string{type.name()} +
+                             " of container " + m_name + " is not a fundamental type");
+  }
+  auto* out = static_cast<std::byte*>(buffer);
+  int done = 0;
+  for (void const* data = nullptr; done < count && read(first + done, &data, type); ++done) {
+    std::memcpy(out + static_cast<std::size_t>(done) * fundamental->size, data, fundamental->size);
+    fundamental->destroy(data);
+  }
+  return done;
+}
+
 int Storage_Read_Container::entries() { return 0; }
 
 void Storage_Read_Container::setAttribute(std::string const& /*name*/, std::string const& /*value*/)
@@ -25,6 +25,8 @@ namespace form::detail::experimental {
     void prime(std::type_info const& type) override;
 
     bool read(int id, void const** data, std::type_info const& type) override;
+    // Copies one row at a time through read(); backends with contiguous storage override this.
+    int readBulk(int first, int count, void* buffer, std::type_info const& type) override;
     int entries() override;
 
     void setAttribute(std::string const& name, std::string const& value) override;
@@ -2,15 +2,20 @@
 
 #include "storage_reader.hpp"
 #include "storage_file.hpp"
+#include "storage_index.hpp"
 #include "storage_read_container.hpp"
 
 #include "storage/factories.hpp"
 
 #include <algorithm>
 #include <cctype>
-
+#include <cstdint>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <stdexcept>
 using namespace form::detail::experimental;
 
@@ -47,99 +52,61 @@ namespace {
     return per_container->second;
   }
 
-  bool is_structured_index_id(std::string const& id)
+  // Reads every row of a container holding one T per row
+  template <typename T>
+  std::vector<T> read_rows(IStorage_Read_Container& container)
   {
-    return id.size() >= 2 && id.front() == '[' && id.back() == ']';
-  }
-
-  std::string trim_copy(std::string const& value)
-  {
-    auto begin = value.find_first_not_of(' ');
-    if (begin == std::string::npos) {
-      return {};
+    std::vector<T> result;
+    int entry = 0;
+    void const* rawData = nullptr;
+    while (container.read(entry, &rawData, typeid(T))) {
+      std::unique_ptr<T const> data(static_cast<T const*>(rawData));
+      result.push_back(*data);
+      entry++;
     }
-    auto end = value.find_last_not_of(' ');
-    return value.substr(begin, end - begin + 1);
+    return result;
   }
 
-  std::optional<long long> parse_index_number(std::string const& value)
+  // Reads one row of a container holding one T per row
+  template <typename T>
+  std::optional<T> read_row(IStorage_Read_Container& container, int row)
   {
-    if (value.empty()) {
-      return std::nullopt;
-    }
-
-    for (char ch : value) {
-      if (!std::isdigit(static_cast<unsigned char>(ch))) {
-        return std::nullopt;
-      }
-    }
-
-    try {
-      return std::stoll(value, nullptr, 10);
-    } catch (...) {
+    void const* rawData = nullptr;
+    if (!container.read(row, &rawData, typeid(T))) {
       return std::nullopt;
     }
+    std::unique_ptr<T const> data(static_cast<T const*>(rawData));
+    return *data;
   }
 
-  std::optional<std::map<std::string, long long>> normalize_structured_index(std::string const& id)
+  // Whether the given row of an index container holds 'id', either verbatim or as the same
+  // structured id
+  bool row_holds_id(IStorage_Read_Container& index,
+                    int row,
+                    std::string const& id,
+                    std::optional<std::map<std::string, long long>> const& normalized_id)
   {
-    if (!is_structured_index_id(id) || id == "[]") {
-      return std::nullopt;
+    auto const stored = read_row<std::string>(index, row);
+    if (!stored) {
+      return false;
     }
+    return *stored == id || (normalized_id && normalize_structured_index(*stored) == normalized_id);
+  }
 
-    std::string const body = id.substr(1, id.size() - 2);
-    std::string token;
+  // Whether a cell with the given layers names the structured id with the given components
+  bool cell_holds_id(std::vector<std::string> const& layers,
+                     std::vector<std::uint64_t> const& cell,
+                     std::map<std::string, long long> const& normalized_id)
+  {
     std::map<std::string, long long> normalized;
-
-    auto commit_token = [&normalized](std::string const& raw_token) -> bool {
-      auto const token_trimmed = trim_copy(raw_token);
-      if (token_trimmed.empty()) {
-        return true;
-      }
-
-      auto const sep = token_trimmed.find_first_of(":=");
-      if (sep == std::string::npos) {
-        return false;
-      }
-
-      auto key = trim_copy(token_trimmed.substr(0, sep));
-      auto value = trim_copy(token_trimmed.substr(sep + 1));
-      if (key.empty() || value.empty()) {
-        return false;
-      }
-
-      for (char& ch : key) {
+    for (std::size_t i = 0; i != layers.size(); ++i) {
+      auto layer = layers[i];
+      for (char& ch : layer) {
         ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
       }
-
-      auto parsed = parse_index_number(value);
-      if (!parsed) {
-        return false;
-      }
-
-      normalized[key] = *parsed;
-      return true;
-    };
-
-    for (char ch : body) {
-      if (ch == ',' || ch == ';') {
-        if (!commit_token(token)) {
-          return std::nullopt;
-        }
-        token.clear();
-      } else {
-        token.push_back(ch);
-      }
-    }
-
-    if (!commit_token(token)) {
-      return std::nullopt;
-    }
-
-    if (normalized.empty()) {
-      return std::nullopt;
+      normalized[layer] = static_cast<long long>(cell[i + 1]);
     }
-    return normalized;
+    return normalized == normalized_id;
   }
 
   bool all_components_zero(std::map<std::string, long long> const& components)
@@ -192,81 +159,199 @@ namespace form::detail::experimental {
   }
 }
 
-int StorageReader::getIndex(Token const& token,
-                            std::string const& id,
-                            form::experimental::config::tech_setting_config const& settings)
+std::shared_ptr<IStorage_Read_Container> StorageReader::container(
+  Token const& token, form::experimental::config::tech_setting_config const& settings)
 {
-  if (auto row = sequential_row_from_index_id(id)) {
-    return *row;
+  {
+    std::shared_lock lock(m_mutex);
+    auto cont = m_read_containers.find(std::make_pair(token.fileName(), token.containerName()));
+    if (cont != m_read_containers.end()) {
+      return cont->second;
+    }
   }
+  std::unique_lock lock(m_mutex);
+  return openContainer(token, settings);
+}
 
-  if (m_indexMaps[token.containerName()].empty()) {
-    auto contKey = std::make_pair(token.fileName(), token.containerName());
-    auto cont = m_read_containers.find(contKey);
-    if (cont == m_read_containers.end()) {
-      auto file = m_files.find(token.fileName());
-      if (file == m_files.end()) {
-        file =
-          m_files.insert({token.fileName(), createFile(token.technology(), token.fileName(), 'i')})
-            .first;
-        for (auto const& [key, value] :
-             get_file_table(settings, token.technology(), token.fileName())) {
-          file->second->setAttribute(key, value);
-        }
+std::shared_ptr<IStorage_Read_Container> StorageReader::openContainer(
+  Token const& token, form::experimental::config::tech_setting_config const& settings)
+{
+  auto contKey = std::make_pair(token.fileName(), token.containerName());
+  auto cont = m_read_containers.find(contKey);
+  if (cont != m_read_containers.end()) {
+    return cont->second;
+  }
+
+  auto file = m_files.find(token.fileName());
+  if (file == m_files.end()) {
+    file = m_files.insert({token.fileName(), createFile(token.technology(), token.fileName(), 'i')})
+             .first;
+    for (auto const& [key, value] :
+         get_file_table(settings, token.technology(), token.fileName())) {
+      file->second->setAttribute(key, value);
+    }
+  }
+  cont = m_read_containers
+           .insert({contKey, createReadContainer(token.technology(), token.containerName())})
+           .first;
+  cont->second->setFile(file->second);
+  for (auto const& [key, value] :
+       get_container_table(settings, token.technology(), token.containerName())) {
+    cont->second->setAttribute(key, value);
+  }
+  return cont->second;
+}
+
+auto StorageReader::indexTable(Token const& token,
+                               form::experimental::config::tech_setting_config const& settings)
+  -> index_table const&
+{
+  {
+    std::shared_lock lock(m_mutex);
+    auto found = m_indexTables.find(token.containerName());
+    if (found != m_indexTables.end()) {
+      return found->second;
+    }
+  }
+
+  std::unique_lock lock(m_mutex);
+  auto found = m_indexTables.find(token.containerName());
+  if (found != m_indexTables.end()) {
+    return found->second;
+  }
+
+  index_table table;
+  Token const key_token{
+    token.fileName(), indexKeyContainerName(token.containerName()), token.technology()};
+  try {
+    auto const keys = read_rows<std::uint64_t>(*openContainer(key_token, settings));
+    table.keys.reserve(keys.size());
+    for (int row = 0; auto const key : keys) {
+      table.keys.emplace_back(key, row++);
+    }
+  } catch (container_not_found const&) {
+    // The file predates key containers: use the strings.
+    table.keys.clear();
+  }
+  std::ranges::sort(table.keys);
+  if (std::ranges::adjacent_find(table.keys, {}, &key_row_t::first) != table.keys.end()) {
+    // Two ids share a key; only their strings can tell them apart.
+    table.keys.clear();
+  }
+
+  Token const cell_token{
+    token.fileName(), indexCellContainerName(token.containerName()), token.technology()};
+  try {
+    table.cells = read_rows<std::vector<std::uint64_t>>(*openContainer(cell_token, settings));
+  } catch (container_not_found const&) {
+    // The file predates cell containers: ids are checked against their strings.
+    table.cells.clear();
+  }
+  if (!table.keys.empty() && table.cells.size() != table.keys.size()) {
+    table.cells.clear();
+  }
+  // The layers of each layer path are named by the id string of the first row with that path,
+  // so only one string is read per distinct path.
+  for (int row = 0; auto const& cell : table.cells) {
+    if (!cell.empty() && !table.paths.contains(cell.front())) {
+      auto const id = read_row<std::string>(*openContainer(token, settings), row);
+      auto const components = id ? structured_index_components(*id) : std::nullopt;
+      if (!components) {
+        table.paths.clear();
+        break;
+      }
+      std::vector<std::string> layers;
+      for (auto const& [layer, _] : *components) {
+        layers.push_back(layer);
       }
-      cont = m_read_containers
-               .insert({contKey, createReadContainer(token.technology(), token.containerName())})
-               .first;
-      for (auto const& [key, value] :
-           get_container_table(settings, token.technology(), token.containerName())) {
-        cont->second->setAttribute(key, value);
+      if (layerPathKey(layers) != cell.front()) {
+        table.paths.clear();
+        break;
       }
-      cont->second->setFile(file->second);
+      table.paths.emplace(cell.front(),
+                          std::make_shared<std::vector<std::string> const>(std::move(layers)));
     }
-    auto const& type = typeid(std::string);
-    int entry = 0;
-    void const* rawData = nullptr;
-    while (cont->second->read(entry, &rawData, type)) {
-      std::unique_ptr<std::string const> data(static_cast<std::string const*>(rawData));
-      m_indexMaps[token.containerName()].insert(std::make_pair(*data, entry));
-      entry++;
+    if (!cell.empty() && table.paths.at(cell.front())->size() + 1 != cell.size()) {
+      // A cell whose numbers do not match its layers cannot be trusted
+      table.paths.clear();
+      break;
     }
+    ++row;
+  }
+  if (table.paths.empty()) {
+    table.cells.clear();
+  }
 
-    if (m_indexMaps[token.containerName()].empty()) {
-      if (!is_structured_index_id(id)) {
-        return 0;
-      }
-      throw std::runtime_error("Unable to read index data from container: " +
-                               token.containerName());
+  if (table.keys.empty()) {
+    auto const ids = read_rows<std::string>(*openContainer(token, settings));
+    for (int row = 0; auto const& id : ids) {
+      table.rows.emplace(id, row++);
     }
   }
+  // The table is only published once complete, so readers never see it while it is being filled.
+  return m_indexTables.emplace(token.containerName(), std::move(table)).first->second;
+}
 
-  auto const found = m_indexMaps[token.containerName()].find(id);
-  if (found != m_indexMaps[token.containerName()].end()) {
-    return found->second;
+int StorageReader::getIndex(Token const& token,
+                            std::string const& id,
+                            form::experimental::config::tech_setting_config const& settings)
+{
+  if (auto row = sequential_row_from_index_id(id)) {
+    return *row;
+  }
+
+  auto const& table = indexTable(token, settings);
+  if (table.keys.empty() && table.rows.empty()) {
+    if (!is_structured_index_id(id)) {
+      return 0;
+    }
+    throw std::runtime_error("Unable to read index data from container: " +
+                             token.containerName());
   }
 
   auto const normalized_query = normalize_structured_index(id);
-  if (normalized_query) {
-    for (auto const& [existing_id, entry] : m_indexMaps[token.containerName()]) {
-      auto const normalized_existing = normalize_structured_index(existing_id);
-      if (normalized_existing && *normalized_existing == *normalized_query) {
-        return entry;
+  if (!table.keys.empty()) {
+    auto const key = indexKey(id);
+    auto const found = std::ranges::lower_bound(table.keys, key, {}, &key_row_t::first);
+    // Keys are hashes, so the row found must still be checked to hold this id and not another
+    // one with the same key.  Keys are unique within the table, so no other row can match.  A
+    // structured id is checked against the row's cell; only other ids need the row's string.
+    if (found != table.keys.end() && found->first == key) {
+      int const row = found->second;
+      bool holds_id = false;
+      if (normalized_query && !table.cells.empty()) {
+        auto const& cell = table.cells[row];
+        holds_id =
+          !cell.empty() && cell_holds_id(*table.paths.at(cell.front()), cell, *normalized_query);
+      } else {
+        holds_id = row_holds_id(*container(token, settings), row, id, normalized_query);
+      }
+      if (holds_id) {
+        return row;
       }
     }
+  } else {
+    auto const found = table.rows.find(id);
+    if (found != table.rows.end()) {
+      return found->second;
+    }
 
-    if (all_components_zero(*normalized_query)) {
-      auto const empty_key = m_indexMaps[token.containerName()].find("");
-      if (empty_key != m_indexMaps[token.containerName()].end()) {
-        return 0;
+    if (normalized_query) {
+      for (auto const& [existing_id, entry] : table.rows) {
+        auto const normalized_existing = normalize_structured_index(existing_id);
+        if (normalized_existing && *normalized_existing == *normalized_query) {
+          return entry;
+        }
       }
-
-      // Compatibility fallback for backends that do not persist the first
-      // structured id string in a normalized round-trippable form.
-      return 0;
     }
   }
 
+  if (normalized_query && all_components_zero(*normalized_query)) {
+    // Compatibility fallback for backends that do not persist the first
+    // structured id string in a normalized round-trippable form.
+    return 0;
+  }
+
   if (!is_structured_index_id(id)) {
     return 0;
   }
@@ -278,85 +363,58 @@ void StorageReader::prime(Token const& token,
                           std::type_info const& type,
                           form::experimental::config::tech_setting_config const& settings)
 {
-  auto contKey = std::make_pair(token.fileName(), token.containerName());
-  auto cont = m_read_containers.find(contKey);
-  if (cont == m_read_containers.end()) {
-    auto file = m_files.find(token.fileName());
-    if (file == m_files.end()) {
-      file =
-        m_files.insert({token.fileName(), createFile(token.technology(), token.fileName(), 'i')})
-          .first;
-      for (auto const& [key, value] :
-           get_file_table(settings, token.technology(), token.fileName())) {
-        file->second->setAttribute(key, value);
-      }
-    }
-    cont = m_read_containers
-             .insert({contKey, createReadContainer(token.technology(), token.containerName())})
-             .first;
-    cont->second->setFile(file->second);
-    for (auto const& [key, value] :
-         get_container_table(settings, token.technology(), token.containerName())) {
-      cont->second->setAttribute(key, value);
-    }
-  }
-  cont->second->prime(type);
+  container(token, settings)->prime(type);
 }
 
 std::vector<std::string> StorageReader::listIndices(
   Token const& token, form::experimental::config::tech_setting_config const& settings)
 {
-  if (m_indexMaps[token.containerName()].empty()) {
-    auto contKey = std::make_pair(token.fileName(), token.containerName());
-    auto cont = m_read_containers.find(contKey);
-    if (cont == m_read_containers.end()) {
-      auto file = m_files.find(token.fileName());
-      if (file == m_files.end()) {
-        file =
-          m_files.insert({token.fileName(), createFile(token.technology(), token.fileName(), 'i')})
-            .first;
-        for (auto const& [key, value] :
-             get_file_table(settings, token.technology(), token.fileName())) {
-          file->second->setAttribute(key, value);
-        }
-      }
-      cont = m_read_containers
-               .insert({contKey, createReadContainer(token.technology(), token.containerName())})
-               .first;
-      for (auto const& [key, value] :
-           get_container_table(settings, token.technology(), token.containerName())) {
-        cont->second->setAttribute(key, value);
+  // The id strings are needed here, in row order; no lookup table is involved.
+  auto result = read_rows<std::string>(*container(token, settings));
+  if (result.empty()) {
+    throw std::runtime_error("Unable to enumerate indices from container: " +
+                             token.containerName());
+  }
+  return result;
+}
+
+std::vector<IndexCell> StorageReader::listIndexCells(
+  Token const& token, form::experimental::config::tech_setting_config const& settings)
+{
+  std::vector<IndexCell> result;
+  auto const& table = indexTable(token, settings);
+  if (!table.cells.empty()) {
+    result.reserve(table.cells.size());
+    for (auto const& cell : table.cells) {
+      if (cell.empty()) {
+        result.emplace_back();
+      } else {
+        result.push_back({table.paths.at(cell.front()), {std::next(cell.begin()), cell.end()}});
       }
-      cont->second->setFile(file->second);
     }
+    return result;
+  }
 
-    auto const& type = typeid(std::string);
-    int entry = 0;
-    void const* rawData = nullptr;
-    while (cont->second->read(entry, &rawData, type)) {
-      std::unique_ptr<std::string const> data(static_cast<std::string const*>(rawData));
-      m_indexMaps[token.containerName()].insert(std::make_pair(*data, entry));
-      entry++;
+  // The file predates cell containers: parse the id strings.
+  std::map<std::vector<std::string>, std::shared_ptr<std::vector<std::string> const>> paths;
+  for (auto const& id : listIndices(token, settings)) {
+    auto const components = structured_index_components(id);
+    if (!components) {
+      result.emplace_back();
+      continue;
     }
-
-    if (m_indexMaps[token.containerName()].empty()) {
-      throw std::runtime_error("Unable to enumerate indices from container: " +
-                               token.containerName());
+    std::vector<std::string> layers;
+    IndexCell cell;
+    for (auto const& [layer, number] : *components) {
+      layers.push_back(layer);
+      cell.numbers.push_back(static_cast<std::uint64_t>(number));
     }
-  }
-
-  std::vector<std::pair<int, std::string>> ordered;
-  ordered.reserve(m_indexMaps[token.containerName()].size());
-  for (auto const& [index_string, entry] : m_indexMaps[token.containerName()]) {
-    ordered.emplace_back(entry, index_string);
-  }
-  std::ranges::sort(ordered,
-                    [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
-
-  std::vector<std::string> result;
-  result.reserve(ordered.size());
-  for (auto const& [_, index_string] : ordered) {
-    result.push_back(index_string);
+    auto& shared_layers = paths[layers];
+    if (!shared_layers) {
+      shared_layers = std::make_shared<std::vector<std::string> const>(std::move(layers));
+    }
+    cell.layers = shared_layers;
+    result.push_back(std::move(cell));
   }
   return result;
 }
@@ -366,28 +424,16 @@ void StorageReader::readContainer(Token const& token,
                                   std::type_info const& type,
                                   form::experimental::config::tech_setting_config const& settings)
 {
-  auto contKey = std::make_pair(token.fileName(), token.containerName());
-  auto cont = m_read_containers.find(contKey);
-  if (cont == m_read_containers.end()) {
-    auto file = m_files.find(token.fileName());
-    if (file == m_files.end()) {
-      file =
-        m_files.insert({token.fileName(), createFile(token.technology(), token.fileName(), 'i')})
-          .first;
-      for (auto const& [key, value] :
-           get_file_table(settings, token.technology(), token.fileName())) {
-        file->second->setAttribute(key, value);
-      }
-    }
-    cont = m_read_containers
-             .insert({contKey, createReadContainer(token.technology(), token.containerName())})
-             .first;
-    cont->second->setFile(file->second);
-    for (auto const& [key, value] :
-         get_container_table(settings, token.technology(), token.containerName())) {
-      cont->second->setAttribute(key, value);
-    }
-  }
   // TODO: Token::id() is a 64-bit row; the read container interface still takes an int entry. Narrow explicitly here (exact for all realistic row counts). Widening the read path to 64-bit is a follow-up PR.
-  cont->second->read(static_cast<int>(token.id()), data, type);
+  container(token, settings)->read(static_cast<int>(token.id()), data, type);
+}
+
+int StorageReader::readContainerBulk(
+  Token const& token,
+  int count,
+  void* buffer,
+  std::type_info const& type,
+  form::experimental::config::tech_setting_config const& settings)
+{
+  return container(token, settings)->readBulk(static_cast<int>(token.id()), count, buffer, type);
 }
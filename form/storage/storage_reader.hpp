@@ -6,14 +6,20 @@
 #include "istorage.hpp"
 #include "storage_utils.hpp"
 
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility> // for std::pair
+#include <vector>
 
 namespace form::detail::experimental {
 
+  // All member functions may be called concurrently.  Files, containers and index tables are
+  // created on first use under m_mutex; the reads themselves happen outside the lock, and
+  // concurrent reads from one container are the container's responsibility.
   class StorageReader : public IStorageReader {
   public:
     StorageReader() = default;
@@ -29,18 +35,50 @@ namespace form::detail::experimental {
                form::experimental::config::tech_setting_config const& settings) override;
     std::vector<std::string> listIndices(
       Token const& token, form::experimental::config::tech_setting_config const& settings) override;
+    std::vector<IndexCell> listIndexCells(
+      Token const& token, form::experimental::config::tech_setting_config const& settings) override;
     void readContainer(Token const& token,
                        void const** data,
                        std::type_info const& type,
                        form::experimental::config::tech_setting_config const& settings) override;
+    int readContainerBulk(Token const& token,
+                          int count,
+                          void* buffer,
+                          std::type_info const& type,
+                          form::experimental::config::tech_setting_config const& settings) override;
 
   private:
+    using key_row_t = std::pair<std::uint64_t, int>;
+
+    // Row lookup for one index container.  Rows are found by binary search over the sorted
+    // (key, row) pairs of the index's key container, and a row found is told apart from one
+    // whose id merely shares the key through the row's cell.  The id strings themselves are
+    // only loaded for files without usable keys, and for the rows of ids that are not cells.
+    struct index_table {
+      std::vector<key_row_t> keys;
+      std::map<std::string, int> rows;
+      // The indexCell() of each row, or nothing for files without a usable cell container
+      std::vector<std::vector<std::uint64_t>> cells;
+      // The layers of each layerPathKey() in 'cells'
+      std::map<std::uint64_t, std::shared_ptr<std::vector<std::string> const>> paths;
+    };
+
+    std::shared_ptr<IStorage_Read_Container> container(
+      Token const& token, form::experimental::config::tech_setting_config const& settings);
+    // Requires m_mutex to be held exclusively
+    std::shared_ptr<IStorage_Read_Container> openContainer(
+      Token const& token, form::experimental::config::tech_setting_config const& settings);
+    // Built once per index container; the returned table is never modified afterwards
+    index_table const& indexTable(Token const& token,
+                                  form::experimental::config::tech_setting_config const& settings);
+
+    std::shared_mutex m_mutex;
     std::map<std::string, std::shared_ptr<IStorage_File>> m_files;
     std::unordered_map<std::pair<std::string, std::string>,
                        std::shared_ptr<IStorage_Read_Container>,
                        pair_hash>
       m_read_containers;
-    std::map<std::string, std::map<std::string, int>> m_indexMaps;
+    std::map<std::string, index_table> m_indexTables;
   };
 
 } // namespace form::detail::experimental
@@ -0,0 +1,130 @@
+// Copyright (C) 2025 ...
+
+#ifndef FORM_STORAGE_STORAGE_TYPES_HPP
+#define FORM_STORAGE_STORAGE_TYPES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace form::detail::experimental {
+
+  // How objects of one C++ type are stored by a backend that writes raw bytes rather than using
+  // a dictionary.  Handle is the backend's own description of the stored elements, e.g. a type
+  // code written to disk or an HDF5 memory type.
+  template <typename Handle>
+  struct StoredType {
+    std::type_info const* type;
+    char const* name; // the spelling of the C++ type
+    Handle handle;
+    std::size_t element_size;
+    bool variable; // vector/string: stored as offsets + elements
+
+    // The bytes stored for an object: the object itself, or the elements of a sequence
+    std::span<std::byte const> (*bytes)(void const* object);
+    // A new object (to be owned by the caller) holding the given bytes
+    void* (*create)(std::span<std::byte const> bytes);
+  };
+
+  namespace stored_types {
+    template <typename T>
+    std::span<std::byte const> scalarBytes(void const* object)
+    {
+      return std::as_bytes(std::span{static_cast<T const*>(object), 1});
+    }
+
+    template <typename T>
+    void* createScalar(std::span<std::byte const> bytes)
+    {
+      auto* result = new T{};
+      std::memcpy(result, bytes.data(), sizeof(T));
+      return result;
+    }
+
+    template <typename C>
+    std::span<std::byte const> sequenceBytes(void const* object)
+    {
+      auto const& sequence = *static_cast<C const*>(object);
+      return std::as_bytes(std::span{sequence.data(), sequence.size()});
+    }
+
+    template <typename C>
+    void* createSequence(std::span<std::byte const> bytes)
+    {
+      auto* result = new C;
+      result->resize(bytes.size() / sizeof(typename C::value_type));
+      if (!bytes.empty()) {
+        std::memcpy(result->data(), bytes.data(), bytes.size());
+      }
+      return result;
+    }
+  }
+
+  // The types such a backend can store: the fundamental types, std::vector of each of them
+  // except bool (std::vector<bool> has no contiguous storage), and std::string.  The backend's
+  // handle of each type T is handle_of(std::type_identity<T>{}).
+  template <typename Handle, typename HandleOf>
+  std::vector<StoredType<Handle>> makeStoredTypes(HandleOf const& handle_of)
+  {
+    using namespace stored_types;
+    std::vector<StoredType<Handle>> result;
+    auto scalar = [&]<typename T>(std::type_identity<T> type, char const* name) {
+      result.push_back(
+        {&typeid(T), name, handle_of(type), sizeof(T), false, &scalarBytes<T>, &createScalar<T>});
+    };
+    auto sequence = [&]<typename C>(std::type_identity<C> type, char const* name) {
+      result.push_back({&typeid(C),
+                        name,
+                        handle_of(type),
+                        sizeof(typename C::value_type),
+                        true,
+                        &sequenceBytes<C>,
+                        &createSequence<C>});
+    };
+    auto scalarAndVector = [&]<typename T>(
+                             std::type_identity<T> type, char const* name, char const* vector_name) {
+      scalar(type, name);
+      sequence(std::type_identity<std::vector<T>>{}, vector_name);
+    };
+
+    scalar(std::type_identity<bool>{}, "bool");
+    scalarAndVector(std::type_identity<char>{}, "char", "std::vector<char>");
+    scalarAndVector(std::type_identity<signed char>{}, "signed char", "std::vector<signed char>");
+    scalarAndVector(
+      std::type_identity<unsigned char>{}, "unsigned char", "std::vector<unsigned char>");
+    scalarAndVector(std::type_identity<short>{}, "short", "std::vector<short>");
+    scalarAndVector(
+      std::type_identity<unsigned short>{}, "unsigned short", "std::vector<unsigned short>");
+    scalarAndVector(std::type_identity<int>{}, "int", "std::vector<int>");
+    scalarAndVector(std::type_identity<unsigned int>{}, "unsigned int", "std::vector<unsigned int>");
+    scalarAndVector(std::type_identity<long>{}, "long", "std::vector<long>");
+    scalarAndVector(
+      std::type_identity<unsigned long>{}, "unsigned long", "std::vector<unsigned long>");
+    scalarAndVector(std::type_identity<long long>{}, "long long", "std::vector<long long>");
+    scalarAndVector(std::type_identity<unsigned long long>{},
+                    "unsigned long long",
+                    "std::vector<unsigned long long>");
+    scalarAndVector(std::type_identity<float>{}, "float", "std::vector<float>");
+    scalarAndVector(std::type_identity<double>{}, "double", "std::vector<double>");
+    sequence(std::type_identity<std::string>{}, "std::string");
+    return result;
+  }
+
+  // The stored type of a C++ type, or nullptr if the type cannot be stored
+  template <typename Handle>
+  StoredType<Handle> const* findStoredType(std::vector<StoredType<Handle>> const& types,
+                                           std::type_info const& type)
+  {
+    auto it = std::ranges::find_if(
+      types, [&type](StoredType<Handle> const& t) { return *t.type == type; });
+    return it != types.end() ? &*it : nullptr;
+  }
+
+} // namespace form::detail::experimental
+
+#endif // FORM_STORAGE_STORAGE_TYPES_HPP
@@ -22,6 +22,8 @@ std::uint64_t Storage_Write_Container::fill(void const* /* data*/) { return kInv
 
 void Storage_Write_Container::commit() {}
 
+void Storage_Write_Container::flush() {}
+
 void Storage_Write_Container::setAttribute(std::string const& /*name*/,
                                            std::string const& /*value*/)
 {
@@ -22,6 +22,7 @@ namespace form::detail::experimental {
     void setupWrite(std::type_info const& type = typeid(void)) override;
     std::uint64_t fill(void const* data) override;
     void commit() override;
+    void flush() override;
 
     void setAttribute(std::string const& name, std::string const& value) override;
 
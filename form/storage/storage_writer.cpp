@@ -7,6 +7,8 @@
 
 #include "storage/factories.hpp"
 
+#include <ranges>
+
 using namespace form::detail::experimental;
 
 namespace {
@@ -51,15 +53,18 @@ namespace form::detail::experimental {
   }
 }
 
-void StorageWriter::createContainers(
+std::map<Placement const*, IStorage_Write_Container*> StorageWriter::createContainers(
   std::map<std::unique_ptr<Placement>, std::type_info const*> const& containers,
   form::experimental::config::tech_setting_config const& settings)
 {
+  std::map<Placement const*, IStorage_Write_Container*> result;
   for (auto const& [plcmnt, type] : containers) {
     // Use file+container as composite key
     auto contKey = std::make_pair(plcmnt->fileName(), plcmnt->containerName());
     auto cont = m_write_containers.find(contKey);
-    if (cont == m_write_containers.end()) {
+    if (cont != m_write_containers.end()) {
+      result.emplace(plcmnt.get(), cont->second.get());
+    } else {
       // Ensure the file exists
       auto file = m_files.find(plcmnt->fileName());
       if (file == m_files.end()) {
@@ -99,8 +104,10 @@ void StorageWriter::createContainers(
       }
       container->setFile(file->second);
       container->setupWrite(*type);
+      result.emplace(plcmnt.get(), container.get());
     }
   }
+  return result;
 }
 
 std::uint64_t StorageWriter::fillContainer(Placement const& plcmnt,
@@ -124,3 +131,10 @@ void StorageWriter::commitContainers(Placement const& plcmnt)
   auto cont = m_write_containers.find(contKey);
   cont->second->commit();
 }
+
+void StorageWriter::flushContainers()
+{
+  for (auto const& container : m_write_containers | std::views::values) {
+    container->flush();
+  }
+}
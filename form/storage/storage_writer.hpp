@@ -20,13 +20,14 @@ namespace form::detail::experimental {
     ~StorageWriter() override = default;
 
     using table_t = form::experimental::config::tech_setting_config::table_t;
-    void createContainers(
+    std::map<Placement const*, IStorage_Write_Container*> createContainers(
       std::map<std::unique_ptr<Placement>, std::type_info const*> const& containers,
       form::experimental::config::tech_setting_config const& settings) override;
     std::uint64_t fillContainer(Placement const& plcmnt,
                                 void const* data,
                                 std::type_info const& type) override;
     void commitContainers(Placement const& plcmnt) override;
+    void flushContainers() override;
 
   private:
     std::map<std::string, std::shared_ptr<IStorage_File>> m_files;
@@ -54,10 +54,14 @@ namespace phlex::detail {
   template <typename T>
   concept is_observer_like = at_least_one_input_parameter<T> && returns<T, void>;
 
+  // An output that must keep a store beyond the call (e.g. to write it asynchronously) takes the
+  // store's shared pointer instead of a reference to it.
   template <typename T>
   concept is_output_like =
     std::is_member_function_pointer_v<T> &&
-    expects_input_parameters<T, phlex::experimental::product_store const&> && returns<T, void>;
+    (expects_input_parameters<T, phlex::experimental::product_store const&> ||
+     expects_input_parameters<T, phlex::experimental::product_store_const_ptr const&>) &&
+    returns<T, void>;
 
   template <typename T>
   concept is_provider_like =
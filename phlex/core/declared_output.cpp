@@ -7,10 +7,12 @@ namespace phlex::detail {
                                    std::size_t concurrency,
                                    std::vector<std::string> predicates,
                                    tbb::flow::graph& g,
-                                   internal::output_function_t&& ft) :
+                                   internal::output_function_t&& ft,
+                                   std::function<void()> end_of_job) :
     consumer{std::move(name), std::move(predicates)},
+    end_of_job_{std::move(end_of_job)},
     node_{g, concurrency, [this, f = std::move(ft)](message const& msg) -> tbb::flow::continue_msg {
-            f(*msg.store);
+            f(msg.store);
             ++calls_;
             return {};
           }}
@@ -18,4 +20,11 @@ namespace phlex::detail {
   }
 
   tbb::flow::receiver<message>& declared_output::port() noexcept { return node_; }
+
+  void declared_output::end_of_job()
+  {
+    if (end_of_job_) {
+      end_of_job_();
+    }
+  }
 }
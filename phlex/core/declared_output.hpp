@@ -20,20 +20,27 @@
 
 namespace phlex::detail {
   namespace internal {
-    using output_function_t = std::function<void(phlex::experimental::product_store const&)>;
+    using output_function_t =
+      std::function<void(phlex::experimental::product_store_const_ptr const&)>;
   }
   class PHLEX_CORE_EXPORT declared_output : public consumer {
   public:
+    // The optional end_of_job function is called once all stores have been delivered, so that
+    // the output can finish work it deferred (e.g. asynchronous writes).  An exception thrown
+    // from it fails the job.
     declared_output(phlex::experimental::algorithm_name name,
                     std::size_t concurrency,
                     std::vector<std::string> predicates,
                     tbb::flow::graph& g,
-                    internal::output_function_t&& ft);
+                    internal::output_function_t&& ft,
+                    std::function<void()> end_of_job = {});
 
     tbb::flow::receiver<message>& port() noexcept;
     std::size_t num_calls() const { return calls_; }
+    void end_of_job();
 
   private:
+    std::function<void()> end_of_job_;
     tbb::flow::function_node<message> node_;
     std::atomic<std::size_t> calls_;
   };
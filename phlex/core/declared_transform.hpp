@@ -88,7 +88,7 @@ namespace phlex::detail {
 
           auto result = call(ft, messages, std::make_index_sequence<num_inputs>{});
           ++calls_;
-          ++product_count_[store->index()->layer_hash()];
+          ++product_count_[store->index()->layer_id()];
 
           products new_products{num_outputs};
           new_products.add_all(output_, std::move(result));
@@ -145,7 +145,7 @@ namespace phlex::detail {
     join_or_none_t<num_inputs> join_;
     tbb::flow::function_node<messages_t<num_inputs>, message> transform_;
     std::atomic<std::size_t> calls_;
-    tbb::concurrent_unordered_map<std::size_t, std::atomic<std::size_t>> product_count_;
+    tbb::concurrent_unordered_map<layer_id_t, std::atomic<std::size_t>> product_count_;
   };
 
 }
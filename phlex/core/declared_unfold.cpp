@@ -1,6 +1,5 @@
 #include "phlex/core/declared_unfold.hpp"
 #include "phlex/model/handle.hpp"
-#include "phlex/utilities/hashing.hpp"
 
 #include "fmt/std.h"
 #include "spdlog/spdlog.h"
@@ -12,16 +11,14 @@ namespace phlex::detail {
                        std::string const& child_layer_name) :
     parent_{std::const_pointer_cast<phlex::experimental::product_store>(parent)},
     node_name_{std::move(node_name)},
-    child_layer_name_{child_layer_name},
-    child_layer_hash_{hash(parent->index()->layer_hash(),
-                           phlex::experimental::identifier{child_layer_name_}.hash())}
+    child_layer_{layer_registry::instance().child_of(parent->index()->layer(), child_layer_name)}
   {
   }
 
   phlex::experimental::product_store_const_ptr generator::make_child(std::size_t const i,
                                                                      products new_products)
   {
-    auto child_index = parent_->index()->make_child(child_layer_name_, i);
+    auto child_index = parent_->index()->make_child(std::string_view(child_layer_.name()), i);
     ++child_count_;
     return std::make_shared<phlex::experimental::product_store>(
       child_index, node_name_, std::move(new_products));
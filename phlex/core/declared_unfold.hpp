@@ -41,17 +41,16 @@ namespace phlex::detail {
                        phlex::experimental::algorithm_name node_name,
                        std::string const& child_layer_name);
 
-    std::size_t child_layer_hash() const { return child_layer_hash_; }
+    layer_id_t child_layer() const { return child_layer_.id(); }
     std::size_t child_count() const { return child_count_; }
     phlex::experimental::product_store_const_ptr make_child(std::size_t i, products new_products);
 
   private:
     phlex::experimental::product_store_ptr parent_;
     phlex::experimental::algorithm_name node_name_;
-    // References declared_unfold::child_layer_, which outlives this short-lived object.
+    // References a registered layer, which lives for the duration of the process.
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-    std::string const& child_layer_name_;
-    std::size_t child_layer_hash_;
+    registered_layer const& child_layer_;
     std::size_t child_count_ = 0;
   };
 
@@ -115,7 +114,7 @@ namespace phlex::detail {
                 call(
                   p, ufold, store->index(), gen, messages, std::make_index_sequence<num_inputs>{});
                 std::get<2>(outputs).try_put({.index = store->index(),
-                                              .layer_hash = gen.child_layer_hash(),
+                                              .layer = gen.child_layer(),
                                               .count = gen.child_count()});
               }}
     {
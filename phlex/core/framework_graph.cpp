@@ -56,7 +56,7 @@ namespace phlex::detail {
     // multi-input unfold contributes the same child layer under each of its input layers,
     // which is over-approximate but harmless — only the most-derived input actually parents
     // children at runtime, and the extra synthetic paths are never reached by
-    // counting_layer_hashes_under for any real fold.  The per-input-layer count lets
+    // counting_layers_under for any real fold.  The per-input-layer count lets
     // flush_gates wait for a flush message from every unfold that consumes a given layer
     // before evaluating done().
     index_router::unfold_data unfold_layers(declared_unfolds const& unfolds)
@@ -196,6 +196,10 @@ namespace phlex::detail {
     // Now back out of all remaining layers
     index_router_.drain(cell_tracker_.report_and_evict_ready_flushes(nullptr));
     graph_.wait_for_all();
+
+    for (auto const& output : nodes_.outputs | std::views::values) {
+      output->end_of_job();
+    }
   }
 
   void framework_graph::throw_if_registration_errors() const
@@ -255,5 +259,8 @@ namespace phlex::detail {
                            std::move(provider_input_ports),
                            fold_partition_ports(nodes_.folds),
                            multilayer_join_index_ports);
+
+    // All layers known to the router have now been registered.
+    hierarchy_.reserve_layers(layer_registry::instance().size());
   }
 }
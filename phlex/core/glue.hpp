@@ -13,6 +13,7 @@
 #include "oneapi/tbb/flow_graph.h"
 
 #include <cassert>
+#include <concepts>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -144,12 +145,22 @@ namespace phlex::detail {
 
     auto output(std::string_view name, is_output_like auto f, concurrency c = concurrency::serial)
     {
-      return output_api{nodes_.registrar_for<declared_output_ptr>(errors_),
-                        config_,
-                        name,
-                        graph_,
-                        delegate(bound_obj_, f),
-                        c};
+      auto g = delegate(bound_obj_, f);
+      internal::output_function_t ft;
+      if constexpr (std::invocable<decltype(g)&, phlex::experimental::product_store_const_ptr>) {
+        ft = std::move(g);
+      } else {
+        ft = [g = std::move(g)](phlex::experimental::product_store_const_ptr const& store) {
+          g(*store);
+        };
+      }
+      return bound_output_api<T>{bound_obj_,
+                                 nodes_.registrar_for<declared_output_ptr>(errors_),
+                                 config_,
+                                 name,
+                                 graph_,
+                                 std::move(ft),
+                                 c};
     }
 
     template <std::derived_from<source> Source, typename... Args>
@@ -30,7 +30,7 @@ namespace phlex::detail {
   // The flush-side metadata for the same `named_index_port` — namely the `counting_layer` name
   // used to look up `committed_counts_` entries at flush time, and the downstream `flush_port`
   // that receives `indexed_end_token`s — lives in a paired `flush_spec` (see below).  The two are
-  // stored side-by-side in `join_node_slots` so that `multilayer_slots_for` can pair them up
+  // stored side-by-side in `join_node_slots` so that `resolve_multilayer_slots` can pair them up
   // while resolving end-token entries for a routed partition index.
   namespace internal {
     class multilayer_slot {
@@ -76,7 +76,7 @@ namespace phlex::detail {
 
     bool multilayer_slot::is_parent_of(data_cell_index_ptr const& index) const
     {
-      return index->parent(layer_) != nullptr;
+      return index->layer().nearest_ancestor(layer_) != nullptr;
     }
   }
 
@@ -92,8 +92,8 @@ namespace phlex::detail {
                            }},
     unfold_flush_receiver_{
       g, tbb::flow::unlimited, [this](unfold_flush const& input) -> tbb::flow::continue_msg {
-        auto const& [index, layer_hash, count] = input;
-        apply_expected_count(*gate_for(index), layer_hash, count);
+        auto const& [index, layer, count] = input;
+        apply_expected_count(*gate_for(index), layer, count);
         flush_if_done(index);
         return {};
       }}
@@ -124,8 +124,10 @@ namespace phlex::detail {
   // input of another) are fully expanded, but cap expansion depth at
   // `max(initial_depth) + layer_pairs.size()`.  Any candidate that exceeds this bound indicates
   // a cyclic/misconfigured unfold pair chain; we fail fast with a diagnostic naming the offending
-  // pair(s).  After sorting, populate is_lowest_layer_hashes_ for every path so that
-  // index_is_lowest_layer() can give a definitive answer without a heuristic fallback.
+  // pair(s).  After sorting, register every path with the layer registry (assigning each a dense
+  // layer id), size the per-layer routing table, and record for every path whether it is a
+  // lowest layer so that index_is_lowest_layer() can give a definitive answer without a
+  // heuristic fallback.
   void index_router::establish_layer_hierarchy(std::vector<layer_path> layer_paths_from_driver,
                                                std::vector<unfold_layer_pair> const& layer_pairs)
   {
@@ -179,17 +181,24 @@ namespace phlex::detail {
 
     std::ranges::sort(sorted_layer_paths_);
 
+    auto& registry = layer_registry::instance();
+    auto const layer_ids = sorted_layer_paths_ |
+                           std::views::transform([&registry](layer_path const& path) {
+                             return registry.layer_for(path).id();
+                           }) |
+                           std::ranges::to<std::vector>();
+    layer_routes_.resize(registry.size());
+
     // In sorted order, a path can only be a prefix of paths that follow it.
     for (std::size_t i = 0; i < sorted_layer_paths_.size(); ++i) {
-      auto const layer_hash = sorted_layer_paths_[i].hash();
       bool const is_lowest_layer =
         i + 1 == sorted_layer_paths_.size() or
         not sorted_layer_paths_[i].is_strict_prefix_of(sorted_layer_paths_[i + 1]);
-      // Record every known layer, both lowest and non-lowest.  Pre-populating the lowest entries
+      // Record every known layer, both lowest and non-lowest.  Recording the lowest entries
       // lets index_is_lowest_layer() return a definitive answer without falling back to the
       // unfold-name-based heuristic, which is important now that the augmentation above already
       // accounts for unfold-produced layers.
-      is_lowest_layer_hashes_.emplace(layer_hash, is_lowest_layer);
+      layer_routes_[layer_ids[i]].is_lowest_layer = is_lowest_layer;
     }
   }
 
@@ -263,12 +272,12 @@ namespace phlex::detail {
                                           bool const is_lowest_layer,
                                           std::size_t const message_id)
   {
-    if (auto index_set_node = index_set_node_for(index)) {
-      index_set_node->try_put({.index = index, .msg_id = message_id});
+    auto const& routes = routes_for(index);
+    if (routes.index_set_node) {
+      routes.index_set_node->try_put({.index = index, .msg_id = message_id});
     }
 
-    auto [message_slots, end_token_entries] = multilayer_slots_for(index);
-    for (auto const& slot : *message_slots) {
+    for (auto const& slot : routes.message_slots) {
       slot->put_message(index, message_id);
     }
 
@@ -278,13 +287,13 @@ namespace phlex::detail {
       return index;
     }
 
-    gate_for(index)->set_flush_callback(
-      [end_token_entries = std::move(end_token_entries)](flush_gate const& fc) {
-        for (auto const& entry : *end_token_entries) {
-          auto const count = fc.committed_count_for_layer(entry.counting_layer_hash);
-          entry.flush_port->try_put({.index = fc.index(), .count = count});
-        }
-      });
+    // The routes for a layer live as long as the router, which outlives every flush gate.
+    gate_for(index)->set_flush_callback([&end_tokens = routes.end_tokens](flush_gate const& fc) {
+      for (auto const& entry : end_tokens) {
+        auto const count = fc.committed_count_for_layer(entry.counting_layer);
+        entry.flush_port->try_put({.index = fc.index(), .count = count});
+      }
+    });
 
     flush_if_done(index);
 
@@ -293,32 +302,44 @@ namespace phlex::detail {
 
   void index_router::drain(index_flushes const& flushes) { update_flush_counts(flushes); }
 
-  bool index_router::index_is_lowest_layer(data_cell_index_ptr const& index)
+  bool index_router::index_is_lowest_layer(data_cell_index_ptr const& index) const
   {
-    auto it = is_lowest_layer_hashes_.find(index->layer_hash());
-    if (it != is_lowest_layer_hashes_.end()) {
-      return it->second;
-    }
+    return is_lowest_layer(index->layer_id());
+  }
 
-    // Unknown layer hash: establish_layers() augments sorted_layer_paths_ with every (driver path,
-    // unfold-produced descendant) so a hash absent from is_lowest_layer_hashes_ corresponds to a
-    // layer the router was never told about.  Treating it as lowest is the safe default — skips
-    // the rollup/expected-count bookkeeping that requires path knowledge — and matches the prior
-    // behavior for unfold output layers.
-    return is_lowest_layer_hashes_.emplace(index->layer_hash(), true).first->second;
+  bool index_router::is_lowest_layer(layer_id_t const layer) const
+  {
+    // Unknown layer: establish_layer_hierarchy() registers every (driver path, unfold-produced
+    // descendant), so a layer without recorded routes is one the router was never told about.
+    // Treating it as lowest is the safe default — skips the rollup/expected-count bookkeeping
+    // that requires path knowledge — and matches the prior behavior for unfold output layers.
+    auto const* routes = layer_routes_.find(layer);
+    return routes ? routes->is_lowest_layer : true;
   }
 
-  internal::index_set_node_ptr index_router::index_set_node_for(data_cell_index_ptr const& index)
+  internal::layer_routes const& index_router::routes_for(data_cell_index_ptr const& index)
   {
-    auto const layer_hash = index->layer_hash();
-    if (auto it = index_set_node_cache_.find(layer_hash); it != index_set_node_cache_.end()) {
-      return it->second;
+    auto& routes = layer_routes_[index->layer_id()];
+    if (routes.resolved.load(std::memory_order_acquire)) {
+      return routes;
     }
 
+    // Slow path: the first index from this layer resolves the routes while any concurrent
+    // arrivals from the same layer wait.
+    std::lock_guard lock{routes.resolve_mutex};
+    if (not routes.resolved.load(std::memory_order_relaxed)) {
+      resolve_routes(routes, index);
+      routes.resolved.store(true, std::memory_order_release);
+    }
+    return routes;
+  }
+
+  void index_router::resolve_routes(internal::layer_routes& routes,
+                                    data_cell_index_ptr const& index)
+  {
     layer_path const layerish_path{{index->layer_name()}};
-    auto broadcaster = index_set_node_for(layerish_path);
-    index_set_node_cache_.insert({layer_hash, broadcaster});
-    return broadcaster;
+    routes.index_set_node = index_set_node_for(layerish_path);
+    resolve_multilayer_slots(routes, index);
   }
 
   auto index_router::index_set_node_for(layer_path const& layer_path)
@@ -346,29 +367,12 @@ namespace phlex::detail {
     throw std::runtime_error(msg);
   }
 
-  std::pair<internal::multilayer_slots_ptr, internal::end_token_entries_ptr>
-  index_router::multilayer_slots_for(data_cell_index_ptr const& index)
+  void index_router::resolve_multilayer_slots(internal::layer_routes& routes,
+                                              data_cell_index_ptr const& index) const
   {
-    auto const layer_hash = index->layer_hash();
-
-    // Fast path: shared lock allows concurrent reads of cached entries.
-    {
-      multilayer_slot_cache_const_accessor acc;
-      if (multilayer_slot_cache_.find(acc, layer_hash)) {
-        return {acc->second.message_slots, acc->second.end_token_entries};
-      }
-    }
-
-    // Slow path: exclusive lock serializes concurrent cache misses for the same layer.
-    multilayer_slot_cache_accessor acc;
-    auto const inserted = multilayer_slot_cache_.insert(acc, layer_hash);
-    if (not inserted) {
-      return {acc->second.message_slots, acc->second.end_token_entries};
-    }
-
-    auto const layer_path = index->layer_path();
+    auto const& layer_path = index->layer_path();
     internal::multilayer_slots message_slots;
-    internal::end_token_entries end_token_entries;
+    internal::end_token_entries end_tokens;
 
     // For each multi-layer join node, determine which slots are relevant to this index.
     // Message entries:   All slots from a node are added if (1) at least one slot exactly matches
@@ -376,12 +380,12 @@ namespace phlex::detail {
     //                    layers of the current index.
     // End-token entries: For each slot that exactly matches the current layer, consult the slot's
     //                    paired flush_spec to materialize one entry per path-aware counting-layer
-    //                    descendant hash.  When the flush_spec's counting layer equals the slot's
+    //                    descendant.  When the flush_spec's counting layer equals the slot's
     //                    routing layer (the common case), this resolves to exactly the routed
-    //                    index's own layer_hash.  When they differ (a fold's partition slot), it
+    //                    index's own layer.  When they differ (a fold's partition slot), it
     //                    resolves to one entry per descendant of `layer_path` whose trailing layer
     //                    name equals the counting layer.
-    for (auto& [node_name, node_slots] : multilayer_join_slots_) {
+    for (auto const& [node_name, node_slots] : multilayer_join_slots_) {
       auto const& slots = node_slots.slots;
       auto const& flush_specs = node_slots.flush_specs;
       assert(slots.size() == flush_specs.size());
@@ -398,18 +402,16 @@ namespace phlex::detail {
         if (slot->matches_exactly(layer_path)) {
           has_exact_match = true;
           if (flush.counting_layer == slot->layer()) {
-            // Counting layer is the routing layer: the routed index's own layer_hash is the unique
-            // counting hash.
-            end_token_entries.push_back(
-              {.counting_layer_hash = layer_hash, .flush_port = flush.flush_port});
+            // Counting layer is the routing layer: the routed index's own layer is the unique
+            // counting layer.
+            end_tokens.push_back(
+              {.counting_layer = index->layer_id(), .flush_port = flush.flush_port});
           } else {
             // Counting layer differs (fold partition slot).  Enumerate all descendant paths under
             // the routed partition path whose trailing name equals the counting layer; emit one
             // entry per descendant.
-            auto const hashes = counting_layer_hashes_under(layer_path, flush.counting_layer);
-            for (auto const& h : hashes) {
-              end_token_entries.push_back(
-                {.counting_layer_hash = h, .flush_port = flush.flush_port});
+            for (auto const layer : counting_layers_under(layer_path, flush.counting_layer)) {
+              end_tokens.push_back({.counting_layer = layer, .flush_port = flush.flush_port});
             }
           }
           matching_slots.push_back(slot);
@@ -429,17 +431,15 @@ namespace phlex::detail {
       }
     }
 
-    acc->second.message_slots =
-      std::make_shared<internal::multilayer_slots const>(std::move(message_slots));
-    acc->second.end_token_entries =
-      std::make_shared<internal::end_token_entries const>(std::move(end_token_entries));
-    return {acc->second.message_slots, acc->second.end_token_entries};
+    routes.message_slots = std::move(message_slots);
+    routes.end_tokens = std::move(end_tokens);
   }
 
-  std::vector<std::size_t> index_router::counting_layer_hashes_under(
+  std::vector<layer_id_t> index_router::counting_layers_under(
     layer_path const& partition_layer_path, identifier const& counting_layer_name) const
   {
-    std::vector<std::size_t> result;
+    auto& registry = layer_registry::instance();
+    std::vector<layer_id_t> result;
     for (auto const& candidate : sorted_layer_paths_) {
       // candidate must be a strict descendant of the partition layer path
       if (not partition_layer_path.is_strict_prefix_of(candidate)) {
@@ -449,7 +449,7 @@ namespace phlex::detail {
       if (not candidate.ends_with(counting_layer_name)) {
         continue;
       }
-      result.push_back(candidate.hash());
+      result.push_back(registry.layer_for(candidate).id());
     }
     return result;
   }
@@ -491,15 +491,15 @@ namespace phlex::detail {
   {
     for (auto const& [index, flush_counts] : flushes) {
       auto gate = gate_for(index);
-      for (auto const& [child_layer_hash, count] : *flush_counts) {
-        apply_expected_count(*gate, child_layer_hash, count.load());
+      for (auto const& [child_layer, count] : *flush_counts) {
+        apply_expected_count(*gate, child_layer, count);
       }
       flush_if_done(index);
     }
   }
 
   void index_router::apply_expected_count(flush_gate& gate,
-                                          data_cell_index::hash_type const child_layer_hash,
+                                          layer_id_t const child_layer,
                                           std::size_t const count)
   {
     // Non-lowest children contribute to the parent's readiness via rollup (roll_up_child() called
@@ -512,16 +512,10 @@ namespace phlex::detail {
     // positive received count while the pending counter is still at its pre-bump value (which may
     // be at or below zero from earlier rollup notifications) and erroneously declare the tracker
     // ready.
-    if (not is_lowest_layer_hash(child_layer_hash)) {
+    if (not is_lowest_layer(child_layer)) {
       gate.expect_child_rollups(count);
     }
-    gate.update_expected_count(child_layer_hash, count);
-  }
-
-  bool index_router::is_lowest_layer_hash(std::size_t const layer_hash) const
-  {
-    auto it = is_lowest_layer_hashes_.find(layer_hash);
-    return it != is_lowest_layer_hashes_.end() ? it->second : true;
+    gate.update_expected_count(child_layer, count);
   }
 
   flush_gate_ptr index_router::gate_for(data_cell_index_ptr const& index)
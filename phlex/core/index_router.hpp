@@ -9,13 +9,16 @@
 #include "phlex/model/flush_gate.hpp"
 #include "phlex/model/flush_messages.hpp"
 #include "phlex/model/identifier.hpp"
+#include "phlex/model/layer_registry.hpp"
 
 #include "oneapi/tbb/concurrent_hash_map.h"
 #include "oneapi/tbb/concurrent_unordered_map.h"
 #include "oneapi/tbb/flow_graph.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -32,14 +35,13 @@ namespace phlex::detail {
     // about counting layers or flush ports.
     class multilayer_slot;
     using multilayer_slots = std::vector<std::shared_ptr<multilayer_slot>>;
-    using multilayer_slots_ptr = std::shared_ptr<multilayer_slots const>;
 
     // The flush-side metadata for one registered named_index_port, paired positionally
     // with the corresponding multilayer_slot in join_node_slots (below).  When the
     // paired slot exactly matches a routed partition index, the router materializes one
     // end_token_entry per descendant of the routed path whose trailing layer name equals
     // `counting_layer`; the entry's count is later drawn from the gate's
-    // committed_counts_ at the resolved hash and forwarded to `flush_port`.
+    // committed_counts_ at the resolved layer and forwarded to `flush_port`.
     struct flush_spec {
       phlex::experimental::identifier counting_layer;
       tbb::flow::receiver<indexed_end_token>* flush_port;
@@ -47,7 +49,7 @@ namespace phlex::detail {
 
     // Per multi-layer join node: the slots, and the flush metadata paired positionally
     // with each slot (slots[i] corresponds to flush_specs[i]).  Stored together so
-    // that multilayer_slots_for can iterate the two in lockstep.
+    // that resolve_multilayer_slots can iterate the two in lockstep.
     struct join_node_slots {
       multilayer_slots slots;
       std::vector<flush_spec> flush_specs;
@@ -58,11 +60,35 @@ namespace phlex::detail {
     // The router materializes one entry per `(slot, counting-layer descendant path)`
     // pair when resolving end tokens for a routed partition index.
     struct end_token_entry {
-      std::size_t counting_layer_hash;
+      layer_id_t counting_layer;
       tbb::flow::receiver<indexed_end_token>* flush_port;
     };
     using end_token_entries = std::vector<end_token_entry>;
-    using end_token_entries_ptr = std::shared_ptr<end_token_entries const>;
+
+    // Everything the router needs to know about a layer in order to route one of its indices.
+    // One layer_routes object exists per registered layer (see layer_table), so that the
+    // per-index routing decision is a plain array lookup.  The routing targets are resolved
+    // lazily, the first time an index from the layer is routed; is_lowest_layer is fixed
+    // when the router is finalized.
+    //
+    //   - message_slots:     one entry per slot template whose routing layer covers this
+    //                        layer (either an exact match or a parent layer).
+    //   - end_tokens:        one entry per (slot template, counting-layer descendant path).
+    //                        For non-fold cases the counting layer equals the routing
+    //                        layer, so a slot at this layer contributes a single entry
+    //                        whose counting_layer is this layer.  For a fold's partition
+    //                        slot the routing layer is the partition (e.g. "job") while the
+    //                        counting layer is the fold's input data layer (e.g. "event"),
+    //                        so the slot may contribute multiple entries — one per
+    //                        "event"-named descendant of the partition path.
+    struct layer_routes {
+      bool is_lowest_layer{true};
+      std::atomic<bool> resolved{false};
+      std::mutex resolve_mutex;
+      index_set_node_ptr index_set_node;
+      multilayer_slots message_slots;
+      end_token_entries end_tokens;
+    };
   }
 
   class PHLEX_CORE_EXPORT index_router {
@@ -90,8 +116,8 @@ namespace phlex::detail {
 
     // Pairs an unfold's input layer name with the child layer name it produces.  These
     // pairs let establish_layers() extend the static layer hierarchy with the dynamic
-    // paths that unfolds introduce at runtime, so that downstream path-aware hash
-    // resolution (e.g. counting_layer_hashes_under) can discover unfold-produced layers.
+    // paths that unfolds introduce at runtime, so that downstream path-aware layer
+    // resolution (e.g. counting_layers_under) can discover unfold-produced layers.
     struct unfold_layer_pair {
       phlex::experimental::identifier input;
       phlex::experimental::identifier output;
@@ -138,13 +164,12 @@ namespace phlex::detail {
     data_cell_index_ptr route(data_cell_index_ptr const& index,
                               bool is_lowest_layer,
                               std::size_t message_id);
-    bool index_is_lowest_layer(data_cell_index_ptr const& index);
-    // Hash-only lookup, intended for classifying child layer hashes that arrive in flush
-    // messages (where only the hash is available, not a data_cell_index).  Returns the
-    // cached classification when known; defaults to lowest for unknown hashes, which is
-    // correct for unfold outputs (the only source of unknown hashes) and consistent with
-    // index_is_lowest_layer()'s fall-through default.
-    bool is_lowest_layer_hash(std::size_t layer_hash) const;
+    bool index_is_lowest_layer(data_cell_index_ptr const& index) const;
+    // Layer-only lookup, intended for classifying child layers that arrive in flush messages
+    // (where only the layer id is available, not a data_cell_index).  Layers unknown to the
+    // router default to lowest, which is correct for unfold outputs (the only source of
+    // unknown layers).
+    bool is_lowest_layer(layer_id_t layer) const;
 
     // finalize() helpers — each owns one initialization step.
     void establish_layer_hierarchy(
@@ -156,22 +181,20 @@ namespace phlex::detail {
     void build_multilayer_join_slots(
       tbb::flow::graph& g, std::map<std::string, named_index_ports> const& multilayer_join_ports);
     internal::index_set_node_ptr index_set_node_for(phlex::experimental::layer_path const& layer);
-    internal::index_set_node_ptr index_set_node_for(data_cell_index_ptr const& index);
-    std::pair<internal::multilayer_slots_ptr, internal::end_token_entries_ptr> multilayer_slots_for(
-      data_cell_index_ptr const& index);
+    internal::layer_routes const& routes_for(data_cell_index_ptr const& index);
+    void resolve_routes(internal::layer_routes& routes, data_cell_index_ptr const& index);
+    void resolve_multilayer_slots(internal::layer_routes& routes,
+                                  data_cell_index_ptr const& index) const;
     void update_flush_counts(index_flushes const& flushes);
-    void apply_expected_count(flush_gate& gate,
-                              data_cell_index::hash_type child_layer_hash,
-                              std::size_t count);
+    void apply_expected_count(flush_gate& gate, layer_id_t child_layer, std::size_t count);
     flush_gate_ptr gate_for(data_cell_index_ptr const& index);
     void flush_if_done(data_cell_index_ptr index);
 
-    // Returns one path-aware layer_hash per static-hierarchy layer path whose trailing
-    // segment equals `counting_layer_name` and whose path lies strictly under
-    // `partition_layer_path`.  Used by `multilayer_slots_for` to materialize one
-    // end_token_entry per descendant counting-layer path when a slot's counting layer
-    // differs from its routing layer.
-    std::vector<std::size_t> counting_layer_hashes_under(
+    // Returns one layer per static-hierarchy layer path whose trailing segment equals
+    // `counting_layer_name` and whose path lies strictly under `partition_layer_path`.  Used
+    // by `resolve_multilayer_slots` to materialize one end_token_entry per descendant
+    // counting-layer path when a slot's counting layer differs from its routing layer.
+    std::vector<layer_id_t> counting_layers_under(
       phlex::experimental::layer_path const& partition_layer_path,
       phlex::experimental::identifier const& counting_layer_name) const;
 
@@ -188,21 +211,16 @@ namespace phlex::detail {
     tbb::flow::function_node<index_message, data_cell_index_ptr> unfold_index_receiver_;
     tbb::flow::function_node<unfold_flush> unfold_flush_receiver_;
     std::atomic<std::size_t> received_indices_;
-    tbb::concurrent_unordered_map<std::size_t, bool> is_lowest_layer_hashes_;
     // Layer paths from the driver, sorted lexicographically.  Used to resolve a slot's
-    // counting-layer name into the set of path-aware layer hashes that the flush gate
-    // will populate, when the counting layer differs from the routing layer.
+    // counting-layer name into the set of path-aware layers that the flush gate will
+    // populate, when the counting layer differs from the routing layer.
     std::vector<phlex::experimental::layer_path> sorted_layer_paths_;
 
     // ==========================================================================================
     // Routing to provider nodes
-    // The following maps are used to route data-cell indices to provider nodes.
-    // The first map is from layer name to the corresponding index-set node.
+    // Map from layer name to the corresponding index-set node.
     tbb::concurrent_unordered_map<phlex::experimental::identifier, internal::index_set_node_ptr>
       index_set_nodes_;
-    // The second map is a cache from a layer hash to an index-set node, to avoid
-    // repeated lookups for the same layer.
-    tbb::concurrent_unordered_map<std::size_t, internal::index_set_node_ptr> index_set_node_cache_;
 
     // ==========================================================================================
     // Routing to multi-layer join nodes
@@ -210,30 +228,9 @@ namespace phlex::detail {
     tbb::concurrent_unordered_map<phlex::experimental::identifier, internal::join_node_slots>
       multilayer_join_slots_;
 
-    // This struct lets multilayer_slots_for return message slots and end-token entries
-    // together, instead of passing concurrent_hash_map accessors as output parameters.
-    // The two are populated independently:
-    //   - message_slots:    one entry per slot template whose routing layer covers this
-    //                       routed index (either an exact match or a parent layer).
-    //   - end_token_entries:one entry per (slot template, counting-layer descendant path).
-    //                       For non-fold cases the counting layer equals the routing
-    //                       layer, so a slot at the routed index's layer contributes a
-    //                       single entry whose counting_layer_hash is the routed index's
-    //                       own layer_hash.  For a fold's partition slot the routing layer
-    //                       is the partition (e.g. "job") while the counting layer is the
-    //                       fold's input data layer (e.g. "event"), so the slot may
-    //                       contribute multiple entries — one per "event"-named
-    //                       descendant of the partition path.
-    struct multilayer_slot_cache_entry {
-      internal::multilayer_slots_ptr message_slots;
-      internal::end_token_entries_ptr end_token_entries;
-    };
-    // Cache from layer hash to matched message/end-token slots for that layer.
-    using multilayer_slot_cache_t =
-      tbb::concurrent_hash_map<std::size_t, multilayer_slot_cache_entry>;
-    using multilayer_slot_cache_accessor = multilayer_slot_cache_t::accessor;
-    using multilayer_slot_cache_const_accessor = multilayer_slot_cache_t::const_accessor;
-    multilayer_slot_cache_t multilayer_slot_cache_;
+    // ==========================================================================================
+    // Per-layer routing decisions, indexed by layer id
+    layer_table<internal::layer_routes> layer_routes_;
 
     // ==========================================================================================
     // Flush gates (data-cell index hash is the key)
@@ -27,11 +27,11 @@ namespace phlex::detail {
       auto const& store = msg.store;
       // TODO: This needs to be replaced with a properly engineered solution
       auto all_products = std::ranges::subrange(store->begin(), store->end()) | views::keys;
-      auto products =
-        all_products |
-        views::filter([this](product_specification const& spec) { return query.match(spec); }) |
-        std::ranges::to<std::vector>();
-      if (products.empty()) {
+      auto products = all_products | views::filter([this](product_specification const& spec) {
+                        return query.match(spec);
+                      });
+      auto it = std::ranges::begin(products);
+      if (it == std::ranges::end(products)) {
         throw std::runtime_error(fmt::format(
           "No products found matching the query {}\n Store (id {} from {}) contains:\n{}",
           query,
@@ -39,12 +39,16 @@ namespace phlex::detail {
           store->source().to_string(),
           bulleted_list(all_products, /*indent=*/4)));
       }
-      if (products.size() > 1) {
+      // The handle refers to the specification stored in the product store, so it must not be
+      // copied here.
+      product_specification const& match = *it;
+      if (std::ranges::next(it) != std::ranges::end(products)) {
+        auto const matches = products | std::ranges::to<std::vector>();
         throw std::runtime_error(fmt::format("Multiple products found matching the query {}:\n{}",
                                              query,
-                                             bulleted_list(products, /*indent=*/4)));
+                                             bulleted_list(matches, /*indent=*/4)));
       }
-      return store->get_handle<handle_arg_t>(products[0]);
+      return store->get_handle<handle_arg_t>(match);
     }
   };
 
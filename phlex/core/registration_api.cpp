@@ -19,8 +19,12 @@ namespace phlex::detail {
       reg_.set_predicates(internal::maybe_predicates(config));
     }
     reg_.set_creator([this](auto predicates, auto const& /* output_product_suffixes */) {
-      return std::make_unique<declared_output>(
-        std::move(name_), concurrency_.value, std::move(predicates), graph_, std::move(ft_));
+      return std::make_unique<declared_output>(std::move(name_),
+                                               concurrency_.value,
+                                               std::move(predicates),
+                                               graph_,
+                                               std::move(ft_),
+                                               std::move(end_of_job_));
     });
   }
 
@@ -30,4 +34,10 @@ namespace phlex::detail {
       reg_.set_predicates(std::move(predicates));
     }
   }
+
+  output_api& output_api::end_of_job(std::function<void()> f)
+  {
+    end_of_job_ = std::move(f);
+    return *this;
+  }
 }
@@ -341,14 +341,39 @@ namespace phlex::detail {
       experimental_when({std::forward<decltype(names)>(names)...});
     }
 
+    // Registers a function to be called once the output has been handed every store of the
+    // job, e.g. to complete deferred writes.  An exception thrown from it fails the job.
+    output_api& end_of_job(std::function<void()> f);
+
   private:
     phlex::experimental::algorithm_name name_;
     // Non-owning reference to the TBB graph; this class is a short-lived registration builder.
     tbb::flow::graph& graph_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
     internal::output_function_t ft_;
     concurrency concurrency_;
+    std::function<void()> end_of_job_;
     registrar<declared_output_ptr> reg_;
   };
+
+  // The output API of an output bound to an object of type T, whose member function may then be
+  // registered as the output's end-of-job function:
+  //
+  //   g.make<MyOutput>().output("save", &MyOutput::save).end_of_job(&MyOutput::finish);
+  template <typename T>
+  class bound_output_api : public output_api {
+  public:
+    template <typename... Args>
+    explicit bound_output_api(std::shared_ptr<T> bound_obj, Args&&... args) :
+      output_api{std::forward<Args>(args)...}, bound_obj_{std::move(bound_obj)}
+    {
+    }
+
+    using output_api::end_of_job;
+    output_api& end_of_job(void (T::*f)()) { return end_of_job(delegate(bound_obj_, f)); }
+
+  private:
+    std::shared_ptr<T> bound_obj_;
+  };
 }
 
 #endif // PHLEX_CORE_REGISTRATION_API_HPP
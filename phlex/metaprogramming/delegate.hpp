@@ -5,28 +5,58 @@
 
 #include <functional>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace phlex::detail {
+  // Holds a callable whose call operator is not const (e.g. a mutable lambda) so that it can
+  // be invoked through a const reference, as the nodes do.
+  template <typename F, typename Args = function_parameter_types<F>>
+  class mutable_callable;
+
+  template <typename F, typename... Args>
+  class mutable_callable<F, std::tuple<Args...>> {
+  public:
+    explicit mutable_callable(F f) : f_{std::move(f)} {}
+
+    return_type<F> operator()(Args... args) const { return f_(std::forward<Args>(args)...); }
+
+  private:
+    mutable F f_;
+  };
+
+  // The 'delegate' overload set returns the algorithm as a concrete callable type, which the
+  // nodes store by value.  Unlike a type-erased std::function, calls can then be inlined into
+  // the node body.
+
   // The first overload is used for closure objects and free functions
   // The clang-tidy warning that 'auto f' should become 'auto const& f' is a false positive.
   // NOLINTNEXTLINE(performance-unnecessary-value-param)
-  auto delegate(std::shared_ptr<void_tag> const&, auto f) { return std::function{std::move(f)}; }
+  auto delegate(std::shared_ptr<void_tag> const&, auto f)
+  {
+    using F = decltype(f);
+    if constexpr (std::is_class_v<F> and not ct::is_const_member_v<F>) {
+      return mutable_callable<F>{std::move(f)};
+    } else {
+      return f;
+    }
+  }
 
   template <typename R, typename T, typename... Args>
   auto delegate(std::shared_ptr<T> obj, R (T::*f)(Args...))
   {
-    return std::function{[t = std::move(obj), f](Args... args) mutable -> R {
+    return [t = std::move(obj), f](Args... args) -> R {
       return std::invoke(f, *t, std::forward<Args>(args)...);
-    }};
+    };
   }
 
   template <typename R, typename T, typename... Args>
   auto delegate(std::shared_ptr<T> obj, R (T::*f)(Args...) const)
   {
-    return std::function{[t = std::move(obj), f](Args... args) mutable -> R {
+    return [t = std::move(obj), f](Args... args) -> R {
       return std::invoke(f, *t, std::forward<Args>(args)...);
-    }};
+    };
   }
 
   template <typename Bound, typename Algorithm>
@@ -0,0 +1,86 @@
+#ifndef PHLEX_MODEL_ARRAY_VIEW_HPP
+#define PHLEX_MODEL_ARRAY_VIEW_HPP
+
+// ==================================================================================
+// The type array_view<T> is a read-only, C-contiguous, n-dimensional array whose
+// buffer is owned elsewhere.  The owner is held through a type-erased shared
+// pointer, so the buffer may be, for example, a std::vector<T> or a numpy array
+// produced by a Python algorithm, in which case no copy into C++ memory is made.
+//
+// Copies share the buffer.  The shape is that of the original array; size() is the
+// total number of elements, which are accessed in row-major order.
+// ==================================================================================
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace phlex::experimental {
+  template <typename T>
+  class array_view {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T const*;
+    using const_iterator = T const*;
+
+    array_view() = default;
+
+    // Views 'data' (with the given shape), which must remain valid for as long as 'owner'
+    // is alive
+    array_view(std::shared_ptr<void const> owner, T const* data, std::vector<std::size_t> shape) :
+      owner_{std::move(owner)},
+      data_{data},
+      size_{std::accumulate(shape.begin(), shape.end(), std::size_t{1}, std::multiplies<>{})},
+      shape_{std::move(shape)}
+    {
+    }
+
+    // Takes ownership of a one-dimensional vector
+    explicit array_view(std::vector<T> values)
+    {
+      auto owner = std::make_shared<std::vector<T> const>(std::move(values));
+      data_ = owner->data();
+      size_ = owner->size();
+      shape_ = {size_};
+      owner_ = std::move(owner);
+    }
+
+    T const* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    std::vector<std::size_t> const& shape() const noexcept { return shape_; }
+    std::size_t ndim() const noexcept { return shape_.size(); }
+
+    T const& operator[](std::size_t i) const { return data_[i]; }
+    T const& at(std::size_t i) const
+    {
+      if (i >= size_) {
+        throw std::out_of_range("array_view index out of range");
+      }
+      return data_[i];
+    }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    std::span<T const> span() const noexcept { return {data_, size_}; }
+
+    // Keeps the buffer alive independently of this view
+    std::shared_ptr<void const> const& owner() const noexcept { return owner_; }
+
+  private:
+    std::shared_ptr<void const> owner_;
+    T const* data_{nullptr};
+    std::size_t size_{0};
+    std::vector<std::size_t> shape_;
+  };
+}
+
+#endif // PHLEX_MODEL_ARRAY_VIEW_HPP
@@ -1,8 +1,116 @@
 #include "phlex/model/data_cell_counts.hpp"
 
+#include <memory>
+
 namespace phlex::detail {
-  void data_cell_counts::emplace(std::size_t layer_hash, std::size_t value)
+  data_cell_counts::~data_cell_counts() { delete overflow_.load(); }
+
+  std::atomic<std::size_t>& data_cell_counts::counter_for(layer_id_t const layer)
+  {
+    for (auto& s : slots_) {
+      auto current = s.layer.load(std::memory_order_acquire);
+      if (current == no_layer and
+          s.layer.compare_exchange_strong(current, layer, std::memory_order_acq_rel)) {
+        return s.count;
+      }
+      // Either the slot was already claimed, or another thread claimed it first (in which case
+      // 'current' now holds the layer it was claimed for).
+      if (current == layer) {
+        return s.count;
+      }
+    }
+    return overflow()[layer];
+  }
+
+  data_cell_counts::overflow_map& data_cell_counts::overflow()
+  {
+    auto* map = overflow_.load(std::memory_order_acquire);
+    if (map != nullptr) {
+      return *map;
+    }
+    auto fresh = std::make_unique<overflow_map>();
+    if (overflow_.compare_exchange_strong(map, fresh.get(), std::memory_order_acq_rel)) {
+      map = fresh.release();
+    }
+    return *map;
+  }
+
+  data_cell_counts::const_iterator data_cell_counts::begin() const { return const_iterator{this}; }
+
+  std::size_t data_cell_counts::size() const
+  {
+    std::size_t result{};
+    for (auto const& s : slots_) {
+      if (s.layer.load(std::memory_order_acquire) == no_layer) {
+        return result;
+      }
+      ++result;
+    }
+    auto const* map = overflow_.load(std::memory_order_acquire);
+    return map != nullptr ? result + map->size() : result;
+  }
+
+  std::size_t data_cell_counts::count(layer_id_t const layer) const
+  {
+    for (auto const& s : slots_) {
+      auto const current = s.layer.load(std::memory_order_acquire);
+      if (current == no_layer) {
+        return 0;
+      }
+      if (current == layer) {
+        return s.count.load();
+      }
+    }
+    auto const* map = overflow_.load(std::memory_order_acquire);
+    if (map == nullptr) {
+      return 0;
+    }
+    auto it = map->find(layer);
+    return it != map->end() ? it->second.load() : 0;
+  }
+
+  // ==========================================================================================
+  data_cell_counts::const_iterator::const_iterator(data_cell_counts const* counts) :
+    counts_{counts}, slot_{0}
+  {
+    settle();
+  }
+
+  auto data_cell_counts::const_iterator::operator*() const -> value_type
+  {
+    if (slot_ < inline_capacity) {
+      auto const& s = counts_->slots_[slot_];
+      return {s.layer.load(std::memory_order_acquire), s.count.load()};
+    }
+    return {it_->first, it_->second.load()};
+  }
+
+  auto data_cell_counts::const_iterator::operator++() -> const_iterator&
+  {
+    if (slot_ < inline_capacity) {
+      ++slot_;
+      settle();
+    } else {
+      ++it_;
+    }
+    return *this;
+  }
+
+  bool data_cell_counts::const_iterator::operator==(std::default_sentinel_t) const noexcept
+  {
+    return slot_ == inline_capacity and (overflow_ == nullptr or it_ == overflow_->cend());
+  }
+
+  void data_cell_counts::const_iterator::settle()
   {
-    map_.emplace(layer_hash, value);
+    if (slot_ < inline_capacity and
+        counts_->slots_[slot_].layer.load(std::memory_order_acquire) != no_layer) {
+      return;
+    }
+    slot_ = inline_capacity;
+    overflow_ = counts_->overflow_.load(std::memory_order_acquire);
+    if (overflow_ != nullptr) {
+      it_ = overflow_->cbegin();
+    }
   }
 }
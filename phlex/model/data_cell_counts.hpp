@@ -1,35 +1,105 @@
 #ifndef PHLEX_MODEL_DATA_CELL_COUNTS_HPP
 #define PHLEX_MODEL_DATA_CELL_COUNTS_HPP
 
+// =========================================================================================
+// data_cell_counts records, for one parent data cell, how many child data cells have been
+// seen in each child layer.  A parent typically has children in only one or two layers, so
+// the counts are stored inline in a small fixed-capacity array of (layer, count) slots.
+// Only when more than inline_capacity distinct layers are recorded is an overflow map
+// allocated for the remainder.
+//
+// Counts may be updated concurrently from multiple threads.  A slot is claimed for a layer
+// by atomically replacing its no_layer sentinel; slots are claimed in order and are never
+// released, so a lookup may stop at the first unclaimed slot.
+//
+// Iterating yields (layer, count) pairs by value.
+// =========================================================================================
+
 #include "phlex/phlex_model_export.hpp"
 
+#include "phlex/model/layer_registry.hpp"
+
 #include "oneapi/tbb/concurrent_unordered_map.h"
 
+#include <array>
 #include <atomic>
 #include <cstddef>
-#include <memory>
+#include <iterator>
+#include <limits>
+#include <utility>
 
 namespace phlex::detail {
   class PHLEX_MODEL_EXPORT data_cell_counts {
+    using overflow_map = tbb::concurrent_unordered_map<layer_id_t, std::atomic<std::size_t>>;
+
   public:
-    void emplace(std::size_t layer_hash, std::size_t value);
+    static constexpr std::size_t inline_capacity = 4;
+
+    class const_iterator;
+
+    data_cell_counts() = default;
+    ~data_cell_counts();
+    data_cell_counts(data_cell_counts const&) = delete;
+    data_cell_counts& operator=(data_cell_counts const&) = delete;
+    data_cell_counts(data_cell_counts&&) = delete;
+    data_cell_counts& operator=(data_cell_counts&&) = delete;
+
+    void increment(layer_id_t layer) { ++counter_for(layer); }
+    void add_to(layer_id_t layer, std::size_t value) { counter_for(layer) += value; }
+
+    const_iterator begin() const;
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+    // Number of distinct layers with recorded counts
+    std::size_t size() const;
+
+    std::size_t count(layer_id_t layer) const;
 
-    void increment(std::size_t layer_hash) { ++map_[layer_hash]; }
-    void add_to(std::size_t layer_hash, std::size_t value) { map_[layer_hash] += value; }
+  private:
+    static constexpr layer_id_t no_layer = std::numeric_limits<layer_id_t>::max();
+
+    struct slot {
+      std::atomic<layer_id_t> layer{no_layer};
+      std::atomic<std::size_t> count{};
+    };
 
-    auto begin() const { return map_.begin(); }
-    auto end() const { return map_.end(); }
+    std::atomic<std::size_t>& counter_for(layer_id_t layer);
+    overflow_map& overflow();
 
-    auto size() const { return map_.size(); }
+    std::array<slot, inline_capacity> slots_{};
+    std::atomic<overflow_map*> overflow_{nullptr};
+  };
+
+  class PHLEX_MODEL_EXPORT data_cell_counts::const_iterator {
+  public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = std::pair<layer_id_t, std::size_t>;
+    using difference_type = std::ptrdiff_t;
 
-    std::size_t count(std::size_t layer_hash) const
+    const_iterator() = default;
+
+    value_type operator*() const;
+    const_iterator& operator++();
+    const_iterator operator++(int)
     {
-      auto it = map_.find(layer_hash);
-      return it != map_.end() ? it->second.load() : 0;
+      auto result = *this;
+      ++*this;
+      return result;
     }
 
+    bool operator==(std::default_sentinel_t) const noexcept;
+
   private:
-    tbb::concurrent_unordered_map<std::size_t, std::atomic<std::size_t>> map_;
+    friend class data_cell_counts;
+    explicit const_iterator(data_cell_counts const* counts);
+
+    // Moves on to the overflow map once the claimed inline slots have been exhausted.
+    void settle();
+
+    data_cell_counts const* counts_{nullptr};
+    std::size_t slot_{inline_capacity};
+    overflow_map const* overflow_{nullptr};
+    overflow_map::const_iterator it_{};
   };
 }
 
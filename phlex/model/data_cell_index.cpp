@@ -33,17 +33,15 @@ namespace {
 
 namespace phlex {
 
-  data_cell_index::data_cell_index() : layer_name_{"job"}, layer_hash_{layer_name_.hash()} {}
+  data_cell_index::data_cell_index() : layer_{&detail::layer_registry::instance().job()} {}
 
   data_cell_index::data_cell_index(data_cell_index_ptr parent,
                                    std::size_t i,
-                                   experimental::identifier layer_name) :
+                                   detail::registered_layer const& layer) :
     parent_{std::move(parent)},
     number_{i},
-    layer_name_{std::move(layer_name)},
-    layer_hash_{phlex::detail::hash(parent_->layer_hash_, layer_name_.hash())},
-    depth_{parent_->depth_ + 1},
-    hash_{phlex::detail::hash(parent_->hash_, number_, layer_hash_)}
+    layer_{&layer},
+    hash_{phlex::detail::hash(parent_->hash_, number_, layer_->hash())}
   {
     // FIXME: Should it be an error to create an ID with an empty name?
   }
@@ -56,47 +54,44 @@ namespace phlex {
 
   experimental::identifier const& data_cell_index::layer_name() const noexcept
   {
-    return layer_name_;
+    return layer_->name();
   }
 
-  experimental::layer_path data_cell_index::layer_path() const
-  {
-    // We know how deep we are so we can pre-allocate and fill in reverse
-    std::vector<experimental::identifier> layers(depth_ + 1);
-    auto const* ptr = this;
-    for (auto& layer : std::views::reverse(layers)) {
-      assert(ptr);
-      layer = ptr->layer_name();
-      ptr = ptr->parent_.get();
-    }
-    return experimental::layer_path{std::move(layers)};
-  }
+  experimental::layer_path const& data_cell_index::layer_path() const { return layer_->path(); }
 
-  std::size_t data_cell_index::depth() const noexcept { return depth_; }
+  std::size_t data_cell_index::depth() const noexcept { return layer_->depth(); }
 
-  data_cell_index_ptr data_cell_index::make_child(std::string child_layer_name,
+  data_cell_index_ptr data_cell_index::make_child(std::string_view const child_layer_name,
                                                   std::size_t const data_cell_number) const
   {
-    return data_cell_index_ptr{new data_cell_index{
-      shared_from_this(), data_cell_number, experimental::identifier{std::move(child_layer_name)}}};
+    auto const& child_layer =
+      detail::layer_registry::instance().child_of(*layer_, child_layer_name);
+    return data_cell_index_ptr{
+      new data_cell_index{shared_from_this(), data_cell_number, child_layer}};
   }
 
   bool data_cell_index::has_parent() const noexcept { return static_cast<bool>(parent_); }
 
   std::size_t data_cell_index::number() const { return number_; }
   std::size_t data_cell_index::hash() const noexcept { return hash_; }
-  std::size_t data_cell_index::layer_hash() const noexcept { return layer_hash_; }
+  std::size_t data_cell_index::layer_hash() const noexcept { return layer_->hash(); }
+  detail::layer_id_t data_cell_index::layer_id() const noexcept { return layer_->id(); }
+  detail::registered_layer const& data_cell_index::layer() const noexcept { return *layer_; }
 
   bool data_cell_index::operator==(data_cell_index const& other) const
   {
-    if (depth_ != other.depth_) {
+    if (layer_->depth() != other.layer_->depth()) {
       return false;
     }
-    auto const same_numbers = number_ == other.number_;
-    if (not parent_) {
-      return same_numbers;
+    // Indices of equal depth reach the job index (whose parent is null) at the same time, and
+    // the comparison can stop as soon as the two chains share an ancestor.
+    for (auto const *lhs = this, *rhs = &other; lhs != rhs;
+         lhs = lhs->parent_.get(), rhs = rhs->parent_.get()) {
+      if (lhs->number_ != rhs->number_) {
+        return false;
+      }
     }
-    return *parent_ == *other.parent_ && same_numbers;
+    return true;
   }
 
   bool data_cell_index::operator<(data_cell_index const& other) const
@@ -110,14 +105,17 @@ namespace phlex {
 
   data_cell_index_ptr data_cell_index::parent(experimental::identifier const& layer_name) const
   {
-    data_cell_index_ptr parent = parent_;
-    while (parent) {
-      if (parent->layer_name_ == layer_name) {
-        return parent;
-      }
-      parent = parent->parent_;
+    auto const* ancestor_layer = layer_->nearest_ancestor(layer_name);
+    if (ancestor_layer == nullptr) {
+      return nullptr;
+    }
+
+    // Step up to the index one layer below the ancestor, whose parent is the ancestor itself.
+    auto const* index = this;
+    for (auto n = layer_->depth() - ancestor_layer->depth(); n > 1; --n) {
+      index = index->parent_.get();
     }
-    return nullptr;
+    return index->parent_;
   }
 
   std::string data_cell_index::to_string() const
@@ -140,10 +138,10 @@ namespace phlex {
 
   std::string data_cell_index::to_string_this_layer() const
   {
-    if (layer_name_.empty()) {
+    if (layer_->name().empty()) {
       return std::to_string(number_);
     }
-    return fmt::format("{}:{}", layer_name_, number_);
+    return fmt::format("{}:{}", layer_->name(), number_);
   }
 
   std::ostream& operator<<(std::ostream& os, data_cell_index const& id)
@@ -6,6 +6,7 @@
 #include "phlex/model/fwd.hpp"
 #include "phlex/model/identifier.hpp"
 #include "phlex/model/layer_path.hpp"
+#include "phlex/model/layer_registry.hpp"
 
 #include <cstddef>
 #include <initializer_list>
@@ -22,16 +23,20 @@ namespace phlex {
     static data_cell_index_ptr job();
 
     using hash_type = std::size_t;
-    data_cell_index_ptr make_child(std::string layer_name, std::size_t data_cell_number) const;
+    data_cell_index_ptr make_child(std::string_view layer_name, std::size_t data_cell_number) const;
     experimental::identifier const& layer_name() const noexcept;
-    experimental::layer_path layer_path() const;
+    experimental::layer_path const& layer_path() const;
     std::size_t depth() const noexcept;
+    // Returns the nearest ancestor in the layer `layer_name`.  The ancestor's depth is taken
+    // from the registered layer, so no layer names are compared along the parent chain.
     data_cell_index_ptr parent(experimental::identifier const& layer_name) const;
     data_cell_index_ptr parent() const noexcept;
     bool has_parent() const noexcept;
     std::size_t number() const;
     std::size_t hash() const noexcept;
     std::size_t layer_hash() const noexcept;
+    detail::layer_id_t layer_id() const noexcept;
+    detail::registered_layer const& layer() const noexcept;
     bool operator==(data_cell_index const& other) const;
     bool operator<(data_cell_index const& other) const;
 
@@ -44,12 +49,10 @@ namespace phlex {
     data_cell_index();
     explicit data_cell_index(data_cell_index_ptr parent,
                              std::size_t i,
-                             experimental::identifier layer_name);
+                             detail::registered_layer const& layer);
     data_cell_index_ptr parent_{nullptr};
     std::size_t number_{-1ull};
-    experimental::identifier layer_name_;
-    std::size_t layer_hash_;
-    std::size_t depth_{};
+    detail::registered_layer const* layer_;
     hash_type hash_{0};
   };
 
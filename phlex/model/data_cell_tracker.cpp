@@ -10,7 +10,7 @@ namespace {
   auto make_data_cell_counts(phlex::data_cell_index_ptr const& index)
   {
     auto result = std::make_shared<phlex::detail::data_cell_counts>();
-    result->emplace(index->layer_hash(), 1);
+    result->increment(index->layer_id());
     return result;
   }
 }
@@ -24,8 +24,8 @@ namespace phlex::detail {
     spdlog::warn("Cached pending flushes at destruction:");
     for (auto const& [index, flush_counts] : pending_flushes_ | std::views::values) {
       spdlog::warn("  Index: {}", index->to_string());
-      for (auto const& [layer_hash, count] : *flush_counts) {
-        spdlog::warn("    {} = {}", layer_hash, count.load());
+      for (auto const& [layer, count] : *flush_counts) {
+        spdlog::warn("    {} = {}", layer_registry::instance().layer(layer).path(), count);
       }
     }
   }
@@ -136,6 +136,6 @@ namespace phlex::detail {
     auto it = pending_flushes_.find(parent->hash());
     // This is only called for siblings, so the parent count must already exist in the cache.
     assert(it != pending_flushes_.end());
-    it->second.counts->increment(child->layer_hash());
+    it->second.counts->increment(child->layer_id());
   }
 }
@@ -19,22 +19,17 @@ namespace phlex::detail {
 
   data_layer_hierarchy::~data_layer_hierarchy() { print(); }
 
+  void data_layer_hierarchy::reserve_layers(std::size_t const n) { counts_.resize(n); }
+
   void data_layer_hierarchy::increment_count(data_cell_index_ptr const& id)
   {
-    if (auto it = layers_.find(id->layer_hash()); it != layers_.cend()) {
-      ++it->second->count;
-      return;
-    }
+    ++counts_[id->layer_id()];
+  }
 
-    auto const parent_hash = id->has_parent() ? id->parent()->layer_hash() : -1ull;
-    // Warning: It can happen that two threads get to this location at the same time.  To
-    // guard against overwriting the value of "count", we use the returned iterator "it",
-    // which will either refer to the new node in the map, or to the already-emplaced
-    // node.  We then increment the count.
-    auto [it, _] = layers_.emplace(
-      id->layer_hash(),
-      std::make_shared<layer_entry>(id->layer_name(), id->layer_path(), parent_hash));
-    ++it->second->count;
+  std::size_t data_layer_hierarchy::count(layer_id_t const layer) const
+  {
+    auto const* counter = counts_.find(layer);
+    return counter ? counter->load() : 0;
   }
 
   std::size_t data_layer_hierarchy::count_for(phlex::experimental::layer_path const& layer,
@@ -42,12 +37,18 @@ namespace phlex::detail {
   {
     // The assumption is that specified layer is a portion of a layer path
     // sufficient to uniquely identify a layer
-    std::vector<layer_entry const*> candidates;
-    for (auto const& [_, entry] : layers_) {
-      if (entry->layer_path.ends_with(layer)) {
-        candidates.push_back(entry.get());
+    auto const& registry = layer_registry::instance();
+    std::vector<std::pair<phlex::experimental::layer_path, std::size_t>> candidates;
+    counts_.for_each([&](layer_id_t const id, std::atomic<std::size_t> const& seen) {
+      auto const n = seen.load();
+      if (n == 0) {
+        return;
       }
-    }
+      auto const& path = registry.layer(id).path();
+      if (path.ends_with(layer)) {
+        candidates.emplace_back(path, n);
+      }
+    });
 
     if (candidates.empty()) {
       return missing_ok ? 0ull
@@ -60,22 +61,18 @@ namespace phlex::detail {
         fmt::format("The following data layers match the specification {}:\n\n{}"
                     "\n\nPlease specify the full layer path to disambiguate between them.",
                     layer,
-                    bulleted_list(candidates | std::views::transform([](auto const* entry) {
-                                    return entry->layer_path;
-                                  }),
-                                  /*indent=*/0));
+                    bulleted_list(candidates | std::views::keys, /*indent=*/0));
       throw std::runtime_error(msg);
     }
 
-    return candidates[0]->count.load();
+    return candidates[0].second;
   }
 
   void data_layer_hierarchy::print() const { spdlog::info("{}", graph_layout()); }
 
-  std::string data_layer_hierarchy::pretty_recurse(
-    std::map<std::string, hash_name_pairs> const& tree,
-    std::string const& name,
-    std::string const& indent) const
+  std::string data_layer_hierarchy::pretty_recurse(std::map<std::string, id_name_pairs> const& tree,
+                                                   std::string const& name,
+                                                   std::string const& indent) const
   {
     auto it = tree.find(name);
     if (it == cend(tree)) {
@@ -84,12 +81,11 @@ namespace phlex::detail {
 
     std::string result;
     std::size_t const n = it->second.size();
-    for (std::size_t i = 0; auto const& [child_name, child_hash] : it->second) {
+    for (std::size_t i = 0; auto const& [child_name, child_id] : it->second) {
       bool const at_end = ++i == n;
       auto child_prefix = !at_end ? indent + " ├ " : indent + " └ ";
-      auto const& entry = *layers_.at(child_hash);
       result += "\n" + indent + " │ ";
-      result += fmt::format("\n{}{}: {}", child_prefix, maybe_name(child_name), entry.count.load());
+      result += fmt::format("\n{}{}: {}", child_prefix, maybe_name(child_name), count(child_id));
 
       auto new_indent = indent;
       new_indent += at_end ? "   " : " │ ";
@@ -100,18 +96,24 @@ namespace phlex::detail {
 
   std::string data_layer_hierarchy::graph_layout() const
   {
-    if (empty(layers_)) {
-      return {};
-    }
-
-    std::map<std::string, std::vector<hash_name_pair>> tree;
-    for (auto const& [layer_hash, layer_entry] : layers_) {
-      auto parent_hash = layer_entry->parent_hash;
-      if (parent_hash == -1ull) {
-        continue;
+    auto const& registry = layer_registry::instance();
+    bool any_seen = false;
+    std::map<std::string, std::vector<id_name_pair>> tree;
+    counts_.for_each([&](layer_id_t const id, std::atomic<std::size_t> const& seen) {
+      if (seen.load() == 0) {
+        return;
       }
-      auto const& parent_name = fmt::to_string(layers_.at(parent_hash)->name);
-      tree[parent_name].emplace_back(fmt::to_string(layer_entry->name), layer_hash);
+      any_seen = true;
+      auto const& layer = registry.layer(id);
+      if (layer.parent() == nullptr) {
+        return;
+      }
+      auto const& parent_name = fmt::to_string(layer.parent()->name());
+      tree[parent_name].emplace_back(fmt::to_string(layer.name()), id);
+    });
+
+    if (not any_seen) {
+      return {};
     }
 
     auto const* const initial_indent = "  ";
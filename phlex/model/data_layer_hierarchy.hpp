@@ -6,9 +6,9 @@
 #include "phlex/model/data_cell_index.hpp"
 #include "phlex/model/fwd.hpp"
 #include "phlex/model/layer_path.hpp"
+#include "phlex/model/layer_registry.hpp"
 
-#include "oneapi/tbb/concurrent_unordered_map.h"
-
+#include <atomic>
 #include <map>
 #include <memory>
 #include <utility>
@@ -25,6 +25,11 @@ namespace phlex::detail {
     data_layer_hierarchy(data_layer_hierarchy&&) = delete;
     data_layer_hierarchy& operator=(data_layer_hierarchy&&) = delete;
 
+    // Sizes the per-layer counters for the n layers registered so far.  Layers registered
+    // afterwards are still counted, but through a slower fallback.  Must be called before any
+    // counts are recorded.
+    void reserve_layers(std::size_t n);
+
     void increment_count(data_cell_index_ptr const& id);
     std::size_t count_for(phlex::experimental::layer_path const& layer,
                           bool missing_ok = false) const;
@@ -34,27 +39,16 @@ namespace phlex::detail {
   private:
     std::string graph_layout() const;
 
-    using hash_name_pair = std::pair<std::string, std::size_t>;
-    using hash_name_pairs = std::vector<hash_name_pair>;
-    std::string pretty_recurse(std::map<std::string, hash_name_pairs> const& tree,
+    using id_name_pair = std::pair<std::string, layer_id_t>;
+    using id_name_pairs = std::vector<id_name_pair>;
+    std::string pretty_recurse(std::map<std::string, id_name_pairs> const& tree,
                                std::string const& parent_name,
                                std::string const& indent = {}) const;
 
-    struct layer_entry {
-      layer_entry(phlex::experimental::identifier n,
-                  phlex::experimental::layer_path path,
-                  std::size_t par_hash) :
-        name{std::move(n)}, layer_path{std::move(path)}, parent_hash{par_hash}
-      {
-      }
-
-      phlex::experimental::identifier name;
-      phlex::experimental::layer_path layer_path;
-      std::size_t parent_hash;
-      std::atomic<std::size_t> count;
-    };
-
-    tbb::concurrent_unordered_map<std::size_t, std::shared_ptr<layer_entry>> layers_;
+    std::size_t count(layer_id_t layer) const;
+
+    // Number of data cells seen per layer.  A layer has been seen if its count is nonzero.
+    layer_table<std::atomic<std::size_t>> counts_;
   };
 
 }
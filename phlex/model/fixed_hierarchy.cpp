@@ -84,7 +84,10 @@ namespace phlex {
     return data_cell_cursor{child, *hierarchy_, *driver_};
   }
 
-  experimental::layer_path data_cell_cursor::layer_path() const { return index_->layer_path(); }
+  experimental::layer_path const& data_cell_cursor::layer_path() const
+  {
+    return index_->layer_path();
+  }
 
   // ================================================================================
   // data_cell_yielder implementation
@@ -26,7 +26,7 @@ namespace phlex {
     // data-cell index to the underlying driver, returning a data_cell_cursor for the child.
     data_cell_cursor yield_child(std::string const& layer_name, std::size_t number) const;
 
-    experimental::layer_path layer_path() const;
+    experimental::layer_path const& layer_path() const;
 
   private:
     friend class fixed_hierarchy;
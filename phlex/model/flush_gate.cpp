@@ -22,23 +22,21 @@ namespace phlex::detail {
     return std::ranges::fold_left(committed_counts_ | std::views::values, 0uz, std::plus{});
   }
 
-  signed_size_t flush_gate::committed_count_for_layer(
-    data_cell_index::hash_type const layer_hash) const
+  signed_size_t flush_gate::committed_count_for_layer(layer_id_t const layer) const
   {
-    return checked_signed_size(committed_counts_.count(layer_hash));
+    return checked_signed_size(committed_counts_.count(layer));
   }
 
-  void flush_gate::update_expected_count(data_cell_index::hash_type const layer_hash,
-                                         std::size_t const count)
+  void flush_gate::update_expected_count(layer_id_t const layer, std::size_t const count)
   {
-    expected_counts_.add_to(layer_hash, count);
+    expected_counts_.add_to(layer, count);
     ++received_flush_count_;
   }
 
   void flush_gate::roll_up_child(data_cell_counts const& child_committed_counts)
   {
-    for (auto const& [layer_hash, count] : child_committed_counts) {
-      committed_counts_.add_to(layer_hash, count);
+    for (auto const& [layer, count] : child_committed_counts) {
+      committed_counts_.add_to(layer, count);
     }
     --pending_child_rollups_;
   }
@@ -85,8 +83,8 @@ namespace phlex::detail {
 
   void flush_gate::commit()
   {
-    for (auto const& [layer_hash, count] : expected_counts_) {
-      committed_counts_.add_to(layer_hash, count.load());
+    for (auto const& [layer, count] : expected_counts_) {
+      committed_counts_.add_to(layer, count);
     }
 
     // At some point, we might consider clearing the expected_counts_ map to free memory,
@@ -58,12 +58,12 @@ namespace phlex::detail {
     data_cell_index_ptr index() const { return index_; }
     std::size_t expected_total_count() const;
     std::size_t committed_total_count() const;
-    signed_size_t committed_count_for_layer(data_cell_index::hash_type layer_hash) const;
+    signed_size_t committed_count_for_layer(layer_id_t layer) const;
     data_cell_counts const& committed_counts() const { return committed_counts_; }
 
     // Merges an expected child count into the accumulated expected counts.  Each call
     // represents one flush message arriving (e.g. one unfold completing for this index).
-    void update_expected_count(data_cell_index::hash_type layer_hash, std::size_t count);
+    void update_expected_count(layer_id_t layer, std::size_t count);
 
     // Records that a non-lowest direct child has rolled up: merges its committed_counts
     // into this gate's and decrements the pending-rollups balance.  The two steps are
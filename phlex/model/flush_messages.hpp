@@ -20,11 +20,11 @@ namespace phlex::detail {
   using index_flushes = std::vector<index_flush>;
 
   // A simpler flush message sent by an unfold to the index_router.  Unlike index_flush, which
-  // carries a map of child counts, unfold_flush carries a single (layer_hash, count) pair
+  // carries a map of child counts, unfold_flush carries a single (layer, count) pair
   // because each unfold produces children in exactly one child layer.
   struct PHLEX_MODEL_EXPORT unfold_flush {
     data_cell_index_ptr index;
-    data_cell_index::hash_type layer_hash{};
+    layer_id_t layer{};
     std::size_t count{};
   };
 
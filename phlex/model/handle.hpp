@@ -58,16 +58,13 @@ namespace phlex {
     };
 
     // The 'product' parameter is not 'const_reference' to avoid avoid implicit type conversions.
+    // The handle refers to (rather than copies) the product, the data-cell index and the product
+    // specification, all of which must outlive it.
     explicit handle(std::same_as<T> auto const& product,
                     data_cell_index const& id,
                     detail::product_specification const& key,
                     std::optional<experimental::identifier> stage = {}) :
-      product_{&product},
-      id_{&id},
-      creator_plugin_{key.plugin()},
-      creator_algorithm_{key.algorithm()},
-      suffix_(key.suffix()),
-      stage_(std::move(stage))
+      product_{&product}, id_{&id}, spec_{&key}, stage_(std::move(stage))
     {
     }
 
@@ -94,9 +91,9 @@ namespace phlex {
     // Product specification information
     algorithm_name_view creator() const noexcept
     {
-      return {std::string_view(creator_plugin_), std::string_view(creator_algorithm_)};
+      return {std::string_view(spec_->plugin()), std::string_view(spec_->algorithm())};
     }
-    std::string_view suffix() const noexcept { return std::string_view(suffix_); }
+    std::string_view suffix() const noexcept { return std::string_view(spec_->suffix()); }
     std::string_view layer() const noexcept { return std::string_view(id_->layer_name()); }
     std::string_view stage() const noexcept
     {
@@ -116,12 +113,9 @@ namespace phlex {
     }
 
   private:
-    const_pointer product_;           // Non-null, by construction
-    class data_cell_index const* id_; // Non-null, by construction
-    experimental::identifier creator_plugin_;
-    experimental::identifier creator_algorithm_;
-    experimental::identifier suffix_;
-    detail::type_id type_;
+    const_pointer product_;                      // Non-null, by construction
+    class data_cell_index const* id_;            // Non-null, by construction
+    detail::product_specification const* spec_; // Non-null, by construction
     std::optional<experimental::identifier> stage_;
 
     // Utilities for stage name access until configuration supports these
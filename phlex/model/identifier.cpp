@@ -1,35 +1,80 @@
 #include "identifier.hpp"
 
+#include "oneapi/tbb/concurrent_unordered_map.h"
+
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/xxhash.hpp>
 
+#include <memory>
+
 namespace phlex::experimental {
-  identifier::identifier(std::string_view str) : content_(str), hash_(hash_string(content_)) {}
-  identifier::identifier(std::string&& str) : content_(std::move(str)), hash_(hash_string(content_))
+  identifier::identifier(std::string_view str) : entry_{intern(str)} {}
+  identifier::identifier(std::string&& str) : entry_{intern(str)} {}
+
+  auto identifier::intern(std::string_view const str) -> interned const*
+  {
+    if (str.empty()) {
+      return empty_entry();
+    }
+
+    // The key refers to the content of the interned entry it is stored with, and carries the
+    // precomputed hash so that the string is hashed only once per lookup.
+    struct key {
+      std::string_view content;
+      std::uint64_t hash;
+      bool operator==(key const& other) const noexcept { return content == other.content; }
+    };
+    struct key_hash {
+      std::size_t operator()(key const& k) const noexcept { return k.hash; }
+    };
+    using table_t = tbb::concurrent_unordered_map<key, std::unique_ptr<interned const>, key_hash>;
+
+    // Append-only and intentionally never destroyed, so that identifiers remain usable during
+    // static destruction.  Its size is bounded by the number of distinct names in the job.
+    static auto* const table = new table_t;
+
+    auto const hash = hash_string(str);
+    if (auto it = table->find(key{str, hash}); it != table->end()) {
+      return it->second.get();
+    }
+
+    // Another thread may intern the same string concurrently, in which case our entry is
+    // discarded and theirs is returned.
+    auto entry = std::make_unique<interned const>(interned{std::string(str), hash});
+    key const entry_key{entry->content, hash};
+    return table->emplace(entry_key, std::move(entry)).first->second.get();
+  }
+
+  auto identifier::empty_entry() noexcept -> interned const*
   {
+    static interned const entry{{}, hash_string("")};
+    return &entry;
   }
 
-  identifier::operator std::string_view() const noexcept { return std::string_view(content_); }
+  identifier::operator std::string_view() const noexcept
+  {
+    return std::string_view(entry_->content);
+  }
   bool identifier::operator==(identifier const& rhs) const noexcept
   {
-    if (hash_ == rhs.hash_) {
-      return content_ == rhs.content_;
-    }
-    return false;
+    return entry_ == rhs.entry_;
   }
   std::strong_ordering identifier::operator<=>(identifier const& rhs) const noexcept
   {
-    std::strong_ordering hash_cmp = hash_ <=> rhs.hash_;
+    if (entry_ == rhs.entry_) {
+      return std::strong_ordering::equal;
+    }
+    std::strong_ordering hash_cmp = entry_->hash <=> rhs.entry_->hash;
     if (hash_cmp == 0) {
-      return content_ <=> rhs.content_;
+      return entry_->content <=> rhs.entry_->content;
     }
     return hash_cmp;
   }
 
-  bool operator==(identifier const& lhs, identifier_query rhs) { return lhs.hash_ == rhs.hash; }
+  bool operator==(identifier const& lhs, identifier_query rhs) { return lhs.hash() == rhs.hash; }
   std::strong_ordering operator<=>(identifier const& lhs, identifier_query rhs)
   {
-    return lhs.hash_ <=> rhs.hash;
+    return lhs.hash() <=> rhs.hash;
   }
 
   identifier literals::operator""_id(char const* lit, std::size_t len)
@@ -25,8 +25,14 @@ namespace phlex::experimental {
     bool operator()(identifier const& id) const noexcept;
   };
 
-  /// Carries around the string itself (as a shared_ptr to string to make copies lighter)
-  /// along with a precomputed hash used for all comparisons
+  /// Refers to an immutable, process-wide interned copy of the string together with its
+  /// precomputed hash.  Each distinct string is interned exactly once, so copying an identifier
+  /// copies a single pointer, and equality is a pointer comparison.
+  ///
+  /// The intern table is append-only: entries are never removed, so the memory it holds grows
+  /// with the number of distinct strings ever turned into identifiers.  Identifiers are meant
+  /// for the bounded set of names known from the configuration and the registered algorithms
+  /// (algorithm names, layers, product suffixes, ...); do not create them from per-event data.
   class PHLEX_MODEL_EXPORT identifier {
   public:
     static constexpr std::uint64_t hash_string(std::string_view str)
@@ -65,22 +71,30 @@ namespace phlex::experimental {
     std::strong_ordering operator<=>(identifier const& rhs) const noexcept;
 
     // check if empty
-    bool empty() const noexcept { return content_.empty(); }
+    bool empty() const noexcept { return entry_->content.empty(); }
     // get hash
-    std::size_t hash() const noexcept { return hash_; }
+    std::size_t hash() const noexcept { return entry_->hash; }
 
     // transitional access to contained string
-    std::string const& trans_get_string() const noexcept { return content_; }
+    std::string const& trans_get_string() const noexcept { return entry_->content; }
 
     // Comparison operators with _id queries
     friend PHLEX_MODEL_EXPORT bool operator==(identifier const& lhs, identifier_query rhs);
     friend PHLEX_MODEL_EXPORT std::strong_ordering operator<=>(identifier const& lhs,
                                                                identifier_query rhs);
-    friend std::hash<identifier>;
 
   private:
-    std::string content_;
-    std::uint64_t hash_{hash_string("")};
+    struct interned {
+      std::string content;
+      std::uint64_t hash;
+    };
+
+    // Returns the unique interned entry for str, creating it if necessary.  The table is
+    // append-only; entries are never destroyed.  Thread-safe.
+    static interned const* intern(std::string_view str);
+    static interned const* empty_entry() noexcept;
+
+    interned const* entry_{empty_entry()};
   };
 
   // Identifier UDL
@@ -102,7 +116,7 @@ template <>
 struct std::hash<phlex::experimental::identifier> {
   std::size_t operator()(phlex::experimental::identifier const& id) const noexcept
   {
-    return id.hash_;
+    return id.hash();
   }
 };
 
@@ -48,6 +48,10 @@ namespace phlex::experimental {
     /// used by hash() and hashes().
     std::size_t depth() const noexcept;
 
+    /// Iterate over the stored path segments
+    auto begin() const noexcept { return layer_path_.begin(); }
+    auto end() const noexcept { return layer_path_.end(); }
+
   private:
     std::vector<identifier> layer_path_;
     void validate() const;
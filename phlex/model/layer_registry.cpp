@@ -0,0 +1,125 @@
+#include "phlex/model/layer_registry.hpp"
+#include "phlex/utilities/hashing.hpp"
+
+#include "fmt/format.h"
+
+#include <ranges>
+#include <stdexcept>
+
+namespace phlex::detail {
+
+  registered_layer::registered_layer(experimental::identifier name,
+                                     registered_layer const* parent,
+                                     layer_id_t const id) :
+    name_{std::move(name)},
+    parent_{parent},
+    id_{id},
+    hash_{parent_ ? phlex::detail::hash(parent_->hash_, name_.hash()) : name_.hash()},
+    depth_{parent_ ? parent_->depth_ + 1 : 0}
+  {
+    if (parent_) {
+      ancestors_.reserve(depth_);
+      ancestors_.assign_range(parent_->ancestors_);
+      ancestors_.push_back(parent_);
+    }
+  }
+
+  experimental::layer_path const& registered_layer::path() const
+  {
+    // The path is not formed eagerly because layer_path validation may reject names that are
+    // otherwise acceptable for a data-cell index (e.g. a nested layer named "job").
+    std::call_once(path_once_, [this] {
+      std::vector<experimental::identifier> layers;
+      layers.reserve(depth_ + 1);
+      for (auto const* ancestor : ancestors_) {
+        layers.push_back(ancestor->name_);
+      }
+      layers.push_back(name_);
+      path_.emplace(std::move(layers));
+    });
+    return *path_;
+  }
+
+  registered_layer const* registered_layer::nearest_ancestor(
+    experimental::identifier const& name) const noexcept
+  {
+    for (auto const* ancestor : ancestors_ | std::views::reverse) {
+      if (ancestor->name_ == name) {
+        return ancestor;
+      }
+    }
+    return nullptr;
+  }
+
+  registered_layer const* registered_layer::find_child(std::uint64_t const name_hash,
+                                                       std::string_view const name) const noexcept
+  {
+    for (auto const* child = first_child_.load(std::memory_order_acquire); child != nullptr;
+         child = child->next_sibling_) {
+      if (child->name_.hash() == name_hash and std::string_view(child->name_) == name) {
+        return child;
+      }
+    }
+    return nullptr;
+  }
+
+  // ==========================================================================================
+  layer_registry& layer_registry::instance()
+  {
+    static layer_registry registry;
+    return registry;
+  }
+
+  layer_registry::layer_registry()
+  {
+    entries_.push_back(std::unique_ptr<registered_layer>(new registered_layer{"job", nullptr, 0}));
+    job_ = entries_.front().get();
+  }
+
+  registered_layer const& layer_registry::child_of(registered_layer const& parent,
+                                                   std::string_view const name)
+  {
+    auto const name_hash = experimental::identifier::hash_string(name);
+    if (auto const* child = parent.find_child(name_hash, name)) {
+      return *child;
+    }
+
+    // Slow path: register the new layer.  Another thread may have registered it between the
+    // lock-free lookup above and acquiring the lock, so we must check again.
+    std::lock_guard lock{mutex_};
+    if (auto const* child = parent.find_child(name_hash, name)) {
+      return *child;
+    }
+
+    auto const id = static_cast<layer_id_t>(entries_.size());
+    auto& child = entries_.emplace_back(std::unique_ptr<registered_layer>(
+      new registered_layer{experimental::identifier{name}, &parent, id}));
+    child->next_sibling_ = parent.first_child_.load(std::memory_order_relaxed);
+    parent.first_child_.store(child.get(), std::memory_order_release);
+    return *child;
+  }
+
+  registered_layer const& layer_registry::layer_for(experimental::layer_path const& path)
+  {
+    auto const* layer = job_;
+    for (auto const& name : path | std::views::drop(path.is_complete() ? 1 : 0)) {
+      layer = &child_of(*layer, std::string_view(name));
+    }
+    return *layer;
+  }
+
+  registered_layer const& layer_registry::layer(layer_id_t const id) const
+  {
+    std::lock_guard lock{mutex_};
+    if (id >= entries_.size()) {
+      throw std::out_of_range(fmt::format("No data layer has been registered with id {}", id));
+    }
+    return *entries_[id];
+  }
+
+  std::size_t layer_registry::size() const
+  {
+    std::lock_guard lock{mutex_};
+    return entries_.size();
+  }
+}
@@ -0,0 +1,174 @@
+#ifndef PHLEX_MODEL_LAYER_REGISTRY_HPP
+#define PHLEX_MODEL_LAYER_REGISTRY_HPP
+
+// =========================================================================================
+// layer_registry
+//
+// Every distinct data layer (identified by its full path from the job layer, e.g.
+// /job/run/spill) is registered exactly once per process and assigned a dense integer
+// ordinal (its layer id).  The job layer always has id 0.  Each data_cell_index refers to
+// the registered_layer for its layer, so per-layer state elsewhere in the framework (the
+// index router, the data-cell tracker, the hierarchy counters) can be kept in plain arrays
+// indexed by layer id instead of hash maps keyed by layer hash.
+//
+// The index router registers every layer path it knows about (including those introduced
+// by unfolds) when the graph is finalized, so that per-layer arrays can be sized up front.
+// Layers that are first encountered afterwards are registered on demand and receive the
+// next available id; see layer_table for how per-layer storage accommodates them.
+//
+// Registered layers are immutable (apart from their list of children) and are never
+// destroyed, so references to them remain valid for the lifetime of the process.  Looking
+// up an already-registered child layer is lock-free.
+// =========================================================================================
+
+#include "phlex/phlex_model_export.hpp"
+
+#include "phlex/model/identifier.hpp"
+#include "phlex/model/layer_path.hpp"
+
+#include "oneapi/tbb/concurrent_unordered_map.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace phlex::detail {
+  using layer_id_t = std::uint32_t;
+
+  class PHLEX_MODEL_EXPORT registered_layer {
+  public:
+    experimental::identifier const& name() const noexcept { return name_; }
+    registered_layer const* parent() const noexcept { return parent_; }
+    layer_id_t id() const noexcept { return id_; }
+    // Path-aware layer hash, equal to the hash of the corresponding complete layer_path.
+    std::size_t hash() const noexcept { return hash_; }
+    // Number of layers below the job layer (the job layer has depth 0).
+    std::size_t depth() const noexcept { return depth_; }
+
+    // The complete path of this layer, computed on first use.
+    experimental::layer_path const& path() const;
+
+    // The ancestor at the given depth, which must be less than depth().
+    registered_layer const& ancestor(std::size_t depth) const noexcept
+    {
+      return *ancestors_[depth];
+    }
+
+    // The nearest (strict) ancestor named `name`, or nullptr if there is none.
+    registered_layer const* nearest_ancestor(experimental::identifier const& name) const noexcept;
+
+  private:
+    friend class layer_registry;
+    registered_layer(experimental::identifier name, registered_layer const* parent, layer_id_t id);
+
+    registered_layer const* find_child(std::uint64_t name_hash,
+                                       std::string_view name) const noexcept;
+
+    experimental::identifier name_;
+    registered_layer const* parent_;
+    layer_id_t id_;
+    std::size_t hash_;
+    std::size_t depth_;
+    // Strict ancestors indexed by depth (ancestors_[0] is the job layer).
+    std::vector<registered_layer const*> ancestors_;
+    mutable std::once_flag path_once_;
+    mutable std::optional<experimental::layer_path> path_;
+
+    // Singly-linked list of child layers.  New children are prepended (under the registry's
+    // mutex) and published with a release store so that readers can traverse the list
+    // without locking.
+    mutable std::atomic<registered_layer const*> first_child_{nullptr};
+    registered_layer const* next_sibling_{nullptr};
+  };
+
+  class PHLEX_MODEL_EXPORT layer_registry {
+  public:
+    static layer_registry& instance();
+
+    layer_registry(layer_registry const&) = delete;
+    layer_registry(layer_registry&&) = delete;
+    layer_registry& operator=(layer_registry const&) = delete;
+    layer_registry& operator=(layer_registry&&) = delete;
+
+    registered_layer const& job() const noexcept { return *job_; }
+
+    // Returns the layer named `name` directly beneath `parent`, registering it if necessary.
+    registered_layer const& child_of(registered_layer const& parent, std::string_view name);
+
+    // Returns the layer corresponding to `path`, registering it (and any missing ancestors) if
+    // necessary.  Incomplete paths are treated as having an implicit job root.
+    registered_layer const& layer_for(experimental::layer_path const& path);
+
+    registered_layer const& layer(layer_id_t id) const;
+
+    // Number of layers registered so far; every registered layer has an id less than this.
+    std::size_t size() const;
+
+  private:
+    layer_registry();
+    ~layer_registry() = default;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<registered_layer>> entries_;
+    registered_layer const* job_;
+  };
+
+  // =========================================================================================
+  // Per-layer storage indexed by layer id.  The dense portion is sized once all known layers
+  // have been registered (typically when the graph is finalized) and is accessed without
+  // hashing or locking.  Layers registered after that point fall back to a concurrent map.
+  //
+  // resize() discards all existing elements and must not be called concurrently with any
+  // other member function.
+  template <typename T>
+  class layer_table {
+  public:
+    void resize(std::size_t n)
+    {
+      dense_ = std::vector<T>(n);
+      overflow_.clear();
+    }
+
+    T& operator[](layer_id_t const id)
+    {
+      if (id < dense_.size()) {
+        return dense_[id];
+      }
+      if (auto it = overflow_.find(id); it != overflow_.end()) {
+        return *it->second;
+      }
+      return *overflow_.emplace(id, std::make_unique<T>()).first->second;
+    }
+
+    T const* find(layer_id_t const id) const
+    {
+      if (id < dense_.size()) {
+        return &dense_[id];
+      }
+      auto it = overflow_.find(id);
+      return it != overflow_.end() ? it->second.get() : nullptr;
+    }
+
+    template <typename F>
+    void for_each(F f) const
+    {
+      for (layer_id_t id = 0; auto const& element : dense_) {
+        f(id++, element);
+      }
+      for (auto const& [id, element] : overflow_) {
+        f(id, *element);
+      }
+    }
+
+  private:
+    std::vector<T> dense_;
+    tbb::concurrent_unordered_map<layer_id_t, std::unique_ptr<T>> overflow_;
+  };
+}
+
+#endif // PHLEX_MODEL_LAYER_REGISTRY_HPP
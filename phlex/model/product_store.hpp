@@ -118,7 +118,8 @@ namespace phlex::experimental {
   [[nodiscard]] handle<T> product_store::get_handle(
     phlex::detail::product_specification const& key) const
   {
-    return handle<T>{products_.get<T>(key), *id_, key, stage_};
+    auto const& [stored_key, product] = products_.get_with_specification<T>(key);
+    return handle<T>{product, *id_, stored_key, stage_};
   }
 
   template <typename T>
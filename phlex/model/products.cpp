@@ -17,7 +17,8 @@ namespace phlex::detail {
   products::size_type products::size() const noexcept { return products_.size(); }
   bool products::empty() const noexcept { return products_.empty(); }
 
-  product_base const* products::find_product(product_specification const& spec) const
+  auto products::find_product(product_specification const& spec) const
+    -> collection_t::value_type const&
   {
     auto it =
       std::ranges::find(products_, spec, [](auto const& p) -> auto const& { return p.first; });
@@ -25,7 +26,7 @@ namespace phlex::detail {
       throw std::runtime_error(
         fmt::format("No product exists with the specification '{}'.", spec.to_string()));
     }
-    return it->second.get();
+    return *it;
   }
 
   void products::throw_mismatched_type(product_specification const& spec,
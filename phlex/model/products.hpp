@@ -87,10 +87,19 @@ namespace phlex::detail {
     template <typename T>
     T const& get(product_specification const& spec) const
     {
-      auto const* available_product = find_product(spec);
+      return get_with_specification<T>(spec).second;
+    }
+
+    // Also returns the stored specification of the product, which (unlike 'spec') remains valid
+    // for as long as the product does.
+    template <typename T>
+    std::pair<product_specification const&, T const&> get_with_specification(
+      product_specification const& spec) const
+    {
+      auto const& [stored_spec, available_product] = find_product(spec);
 
-      if (auto const* desired_product = dynamic_cast<product<T> const*>(available_product)) {
-        return desired_product->obj;
+      if (auto const* desired_product = dynamic_cast<product<T> const*>(available_product.get())) {
+        return {stored_spec, desired_product->obj};
       }
 
       throw_mismatched_type(spec, typeid(T).name(), available_product->type().name());
@@ -102,7 +111,7 @@ namespace phlex::detail {
     bool empty() const noexcept;
 
   private:
-    product_base const* find_product(product_specification const& spec) const;
+    collection_t::value_type const& find_product(product_specification const& spec) const;
     static void throw_mismatched_type [[noreturn]] (product_specification const& spec,
                                                     char const* requested_type,
                                                     char const* available_type);
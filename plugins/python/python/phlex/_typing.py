@@ -67,6 +67,24 @@ if has_numba:
         }
     )
 
+    from numba.extending import models, register_model
+
+    class ArrayPointer(nb_types.CPointer):
+        """Numba type of a cfunc argument pointing to the data of an array input.
+
+        A cfunc receives an array as two arguments: this pointer, followed by the
+        number of elements as an ``intp``, e.g. ``float64(ArrayPointer(float64), intp)``.
+        Plain ``CPointer`` arguments are rejected, as they do not say whether they
+        point to an array.
+        """
+
+        def __init__(self, dtype):
+            super().__init__(dtype)
+            self.name = f"ArrayPointer({dtype})"
+
+    register_model(ArrayPointer)(models.PointerModel)
+    __all__.append("ArrayPointer")
+
 # ctypes types that don't map cleanly to intN_t / uintN_t
 _CTYPES_SPECIAL: dict[type, str] = {}
 for _attr, _cpp in [
@@ -182,6 +200,12 @@ def normalize_type(tp: Any, globalns: Dict | None = None, localns: Dict | None =
     if tp is type(None):
         return "None"
 
+    # arrays in Numba cfunc signatures, passed as a pointer followed by their size
+    if has_numba and isinstance(tp, nb_types.CPointer):
+        if not isinstance(tp, ArrayPointer):
+            raise TypeError("Pointers are ambiguous; declare an array with phlex.ArrayPointer")
+        return "ndarray[" + normalize_type(tp.dtype, globalns, localns) + "]"
+
     # clean up generic aliases, such as typing.List[int], list[int], etc.
     if origin is not None:
         args = typing.get_args(tp)
@@ -5,6 +5,8 @@
 // using Cling or even Numba's llvmlite.
 
 #include "dyncall.hpp"
+
+#include <array>
 #include <stdexcept>
 
 #include <ffi.h>
@@ -135,3 +137,49 @@ void phlex::experimental::dyncall(void* fn, dcarg& result, dcargs_t& args, int v
   ffi_call(&cif, (void (*)())fn, result.value_ptr(), p.get());
   // NOLINTEND
 }
+
+struct phlex::experimental::dyncall_signature::cif_data {
+  ffi_cif cif;
+  std::vector<ffi_type*> types;
+};
+
+phlex::experimental::dyncall_signature::dyncall_signature(dcarg const& result,
+                                                          dcargs_t const& args)
+{
+  if (args.size() > max_args) {
+    throw std::invalid_argument("too many arguments for a prepared dynamic call");
+  }
+
+  auto data = std::make_shared<cif_data>();
+  data->types.reserve(args.size());
+  for (auto const& a : args) {
+    data->types.push_back(get_ffi_type(a));
+  }
+
+  // the cif refers to the types vector, which is owned alongside it and never resized
+  if (ffi_prep_cif(&data->cif,
+                   FFI_DEFAULT_ABI,
+                   static_cast<unsigned int>(data->types.size()),
+                   get_ffi_type(result),
+                   data->types.data()) != FFI_OK) {
+    throw std::runtime_error("ffi prep failed");
+  }
+  m_cif = std::move(data);
+}
+
+void phlex::experimental::dyncall_signature::call(void* fn,
+                                                  dcarg& result,
+                                                  std::span<dcarg> args) const
+{
+  if (args.size() != m_cif->types.size()) {
+    throw std::invalid_argument("argument count does not match the prepared signature");
+  }
+
+  std::array<void*, max_args> values{};
+  for (std::size_t i = 0; i < args.size(); ++i) {
+    values[i] = args[i].value_ptr();
+  }
+
+  // NOLINTNEXTLINE - libffi takes a generic function pointer
+  ffi_call(const_cast<ffi_cif*>(&m_cif->cif), (void (*)())fn, result.value_ptr(), values.data());
+}
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -93,6 +94,23 @@ namespace phlex::experimental {
 
   void dyncall(void* fn, dcarg& result, dcargs_t& args, int var_offset = -1);
 
+  // Call interface of a fixed (non-variadic) C signature, prepared once from prototype
+  // arguments so that repeated calls skip the per-call setup of dyncall(). Copies share the
+  // prepared interface, and calls may be made concurrently.
+  class dyncall_signature {
+  public:
+    static constexpr std::size_t max_args = 16;
+
+    dyncall_signature(dcarg const& result, dcargs_t const& args);
+
+    // args must match the prototype arguments in number and type
+    void call(void* fn, dcarg& result, std::span<dcarg> args) const;
+
+  private:
+    struct cif_data;
+    std::shared_ptr<cif_data const> m_cif;
+  };
+
 } // phlex::experimental
 
 #endif // PLUGINS_PYTHON_SRC_DYNCALL_HPP
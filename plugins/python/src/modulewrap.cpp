@@ -1,6 +1,8 @@
 #include "dyncall.hpp"
+#include "vectorcall.hpp"
 #include "wrap.hpp"
 
+#include "phlex/model/array_view.hpp"
 #include "phlex/model/data_cell_index.hpp"
 
 #include <fmt/format.h>
@@ -8,8 +10,14 @@
 
 #include <algorithm>
 #include <array>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
@@ -39,9 +47,22 @@
 //                   name:    <name>
 //                   output:  <output>
 //
-// For now, each input will have its own converter, even if multiple nodes
-// need that same input translated. This simplifies memory management, but
-// can cause a performance bottleneck (since all require the GIL).
+// Input converters are shared: algorithms of the same module that need the
+// same product in the same representation take it from the converter node
+// inserted for the first of them, named after that algorithm. Each product is
+// thus converted (under the GIL) only once per data cell, and all Python
+// consumers receive the same object, which is why arrays are read-only.
+//
+// Python algorithms are called directly through the vectorcall protocol
+// (see vectorcall.hpp), with the __call__ of callable instances resolved once.
+//
+// Numba cfuncs are the exception: they are native code, so their converters
+// merely repackage the C++ products as (generic) call arguments and the
+// function is called through its address. None of those steps takes the GIL.
+//
+// Batched algorithms (registered with a "batch" size) use the same native
+// converters: their calls are collected into batches, which are then handed
+// to the Python callable as arrays under a single acquisition of the GIL.
 
 // This is dumb, but for now, because all templates need to be instantiated, only
 // support up to a fixed compile-time maximum number of arguments. An alternative
@@ -62,6 +83,8 @@ using phlex::product_selector;
 struct phlex::experimental::py_phlex_module {
   PyObject_HEAD
   phlex_module_t const* ph_module;
+  // names of the inserted input converter nodes, keyed by input product and converter
+  std::map<std::pair<std::string, void (*)()>, std::string> input_converters;
 };
 // clang-format on
 
@@ -69,10 +92,19 @@ PyObject* phlex::experimental::wrap_module(phlex_module_t const& module_)
 {
   py_phlex_module* pymod = PyObject_New(py_phlex_module, &PhlexModule_Type);
   pymod->ph_module = &module_;
+  using converter_map_t = decltype(pymod->input_converters);
+  new (&pymod->input_converters) converter_map_t{};
 
   return reinterpret_cast<PyObject*>(pymod);
 }
 
+static void md_dealloc(py_phlex_module* pymod)
+{
+  using converter_map_t = decltype(pymod->input_converters);
+  pymod->input_converters.~converter_map_t();
+  Py_TYPE(pymod)->tp_free(reinterpret_cast<PyObject*>(pymod));
+}
+
 // Simple phlex source wrapper
 // clang-format off
 struct phlex::experimental::py_phlex_source {
@@ -103,15 +135,40 @@ namespace {
     return fmt::format("{}_arg{}_py", algname, arg);
   }
 
-  inline dcarg lifeline_transform(dcarg arg)
+  inline PyObject* lifeline_transform(PyObject* pyobj)
   {
-    PyObject* pyobj = arg.get<PyObject*>();
     if (pyobj && PyObject_TypeCheck(pyobj, &PhlexLifeline_Type)) {
-      return dcarg{reinterpret_cast<py_lifeline_t*>(pyobj)->m_view};
+      return reinterpret_cast<py_lifeline_t*>(pyobj)->m_view;
     }
-    return arg;
+    return pyobj;
   }
 
+  // shared owner of a reference to a Python object; the reference is released under the
+  // GIL, unless the interpreter is already gone (in which case there is nothing to release)
+  std::shared_ptr<void const> py_owner(PyObject* pyobj) // steals reference
+  {
+    return std::shared_ptr<void const>(pyobj, [](void const* p) {
+      if (Py_IsInitialized()) {
+        PyGILRAII gil;
+        Py_DECREF(static_cast<PyObject*>(const_cast<void*>(p)));
+      }
+    });
+  }
+
+  // owned reference to a Python object, as handed from an input converter to the Python
+  // algorithms; converted inputs are shared by all consumers, so the reference is only
+  // released with the last copy
+  class py_ref {
+  public:
+    py_ref() = default;
+    explicit py_ref(PyObject* pyobj) : m_owner{pyobj ? py_owner(pyobj) : nullptr} {} // steals
+
+    PyObject* get() const { return static_cast<PyObject*>(const_cast<void*>(m_owner.get())); }
+
+  private:
+    std::shared_ptr<void const> m_owner;
+  };
+
   // callable objects managing the callback
   struct py_callback_base {
     PyObject* m_callable; // owned
@@ -159,73 +216,113 @@ namespace {
 
   template <typename RT, size_t... Is>
   struct py_callback_impl<RT, std::index_sequence<Is...>> : public py_callback_base {
-    py_callback_impl(PyObject* callable) :
-      py_callback_base(callable, reinterpret_cast<void*>(PyObject_CallFunctionObjArgs))
+    py_callback_impl(PyObject* callable) : py_callback_base(callable, nullptr)
     {
+      PyGILRAII gil;
+      m_call = resolve_call(callable);
     }
 
-    RT operator()(type_repeater<dcarg, Is>... args)
+    RT operator()(type_repeater<py_ref const&, Is>... args)
     {
-      dcargs_t argsv;
-      argsv.reserve(sizeof...(Is) + 2);
-      argsv.emplace_back(m_callable);
-      (argsv.push_back(lifeline_transform(args)), ...);
-      argsv.emplace_back(nullptr);
-
       PyGILRAII gil;
 
-      dcarg result{nullptr};
-      dyncall(m_ccallback, result, argsv, 1);
+      PyObject* result = vectorcall(m_callable, m_call, lifeline_transform(args.get())...);
 
       std::string error_msg;
-      if (!result.get<PyObject*>()) {
+      if (!result) {
         if (!msg_from_py_error(error_msg)) {
           error_msg = "Unknown python error";
         }
       }
 
-      decref_all(args...);
-
       if (!error_msg.empty()) {
         throw std::runtime_error(error_msg);
       }
 
       if constexpr (!std::is_void_v<RT>) {
-        return result;
+        return dcarg{result};
       } else {
-        Py_DECREF(result.get<PyObject*>());
+        Py_DECREF(result);
       }
     }
 
   private:
-    template <typename... Args>
-    void decref_all(Args... args)
+    // __call__ of a callable instance, resolved once (see vectorcall.hpp), or nullptr;
+    // like the callable, never released
+    PyObject* m_call{nullptr};
+  };
+
+  // Argument for a direct call into JIT-compiled code: either a fundamental value, or
+  // an array passed as a data pointer followed by its number of elements (as declared by
+  // a Numba signature such as "float64(ArrayPointer(float64), intp)"). The owner of an
+  // array's buffer is kept alive for as long as the argument exists.
+  struct jit_arg {
+    dcarg m_value;
+    dcarg m_size; // void unless m_value points to array data
+    std::shared_ptr<void const> m_source;
+
+    jit_arg() = default;
+    explicit jit_arg(dcarg value) : m_value(value) {}
+    template <typename T>
+    explicit jit_arg(array_view<T> const& v) :
+      m_value(const_cast<void*>(static_cast<void const*>(v.data()))),
+      m_size(static_cast<ph_long_t>(v.size())),
+      m_source(v.owner())
     {
-      // helper to decrement reference counts of N arguments
-      (Py_DECREF(reinterpret_cast<PyObject*>(std::get<void*>(args.m_value))), ...);
     }
+
+    bool is_array() const { return !std::holds_alternative<std::monostate>(m_size.m_value); }
   };
 
+  // prototype native arguments for the (normalized) input types of a JIT-compiled function
+  dcargs_t jit_prototypes(std::vector<std::string> const& input_types)
+  {
+    dcargs_t result;
+    for (auto const& type : input_types) {
+      if (type.starts_with("ndarray")) {
+        result.emplace_back(static_cast<void*>(nullptr));
+        result.emplace_back(static_cast<ph_long_t>(0));
+      } else {
+        result.push_back(dcarg::from_str(type));
+      }
+    }
+    return result;
+  }
+
   template <typename RT, typename Sq>
   struct jit_callback_impl;
 
   template <typename RT, size_t... Is>
   struct jit_callback_impl<RT, std::index_sequence<Is...>> : public py_callback_base {
-    dcarg m_rtype; // dynamic call return type
-
-    jit_callback_impl(PyObject* callable, void* cb, std::string const& stype) :
-      py_callback_base(callable, cb), m_rtype(dcarg::from_str(stype))
+    dcarg m_rtype;                 // dynamic call return type
+    dyncall_signature m_signature; // prepared once, shared between copies
+
+    jit_callback_impl(PyObject* callable,
+                      void* cb,
+                      std::string const& stype,
+                      std::vector<std::string> const& input_types) :
+      py_callback_base(callable, cb),
+      m_rtype(dcarg::from_str(stype)),
+      m_signature(m_rtype, jit_prototypes(input_types))
     {
     }
 
-    RT operator()(type_repeater<dcarg, Is>... args)
+    RT operator()(type_repeater<jit_arg const&, Is>... args)
     {
-      dcarg result{m_rtype};
-      dcargs_t argsv;
-      argsv.reserve(sizeof...(Is));
-      (argsv.push_back(args), ...);
+      // an array takes two native arguments, its data pointer and its size
+      std::array<dcarg, 2 * sizeof...(Is)> argsv;
+      std::size_t nargs = 0;
+      auto marshal = [&argsv, &nargs](jit_arg const& arg) {
+        argsv[nargs++] = arg.m_value;
+        if (arg.is_array()) {
+          argsv[nargs++] = arg.m_size;
+        }
+      };
+      (marshal(args), ...);
 
-      dyncall(m_ccallback, result, argsv);
+      // no GIL needed: the callee is native code that does not touch Python objects
+      dcarg result{m_rtype};
+      m_signature.call(m_ccallback, result, std::span{argsv}.first(nargs));
       // TODO: error reporting?
 
       if constexpr (!std::is_void_v<RT>) {
@@ -450,9 +547,28 @@ namespace {
           output_types.push_back(annotation_as_text(ret));
           for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(args); ++i) {
             PyObject* item = PyTuple_GET_ITEM(args, i);
-            input_types.push_back(annotation_as_text(item));
+            std::string type = annotation_as_text(item);
+            if (type.empty() && PyErr_Occurred()) {
+              break;
+            }
+
+            // a C function receives an array, declared with phlex.ArrayPointer, as a
+            // pointer followed by its size, which together take a single (array) input
+            if (type.starts_with("ndarray")) {
+              if (i + 1 == PyTuple_GET_SIZE(args) ||
+                  annotation_as_text(PyTuple_GET_ITEM(args, i + 1)) != "int64_t") {
+                if (!PyErr_Occurred()) {
+                  PyErr_SetString(PyExc_TypeError,
+                                  "an ArrayPointer argument must be followed by the array size "
+                                  "as an intp argument");
+                }
+                break;
+              }
+              ++i;
+            }
+            input_types.push_back(std::move(type));
           }
-          conversion_ok = true;
+          conversion_ok = !PyErr_Occurred();
         } else {
           PyErr_Clear();
         }
@@ -510,6 +626,10 @@ namespace {
 
   bool pylong_as_bool(PyObject* pyobject)
   {
+    // accept numpy booleans, e.g. the elements of a boolean array
+    if (PyArray_IsScalar(pyobject, Bool)) {
+      return PyObject_IsTrue(pyobject) == 1;
+    }
     // range-checking python integer to C++ bool conversion
     long l = PyLong_AsLong(pyobject);
     // fail to pass float -> bool; the problem is rounding (0.1 -> 0 -> False)
@@ -582,13 +702,13 @@ namespace {
 // for expressions, but causes havoc with C++ signatures. We suppress this warning for the block
 // because the use of continuations makes per-line suppression impossible.
 #define BASIC_CONVERTER(name, cpptype, topy, frompy)                                               \
-  static dcarg name##_to_py(cpptype a)                                                             \
+  static py_ref name##_to_py(cpptype a)                                                            \
   {                                                                                                \
     PyGILRAII gil;                                                                                 \
-    return dcarg{topy(a)};                                                                         \
+    return py_ref{topy(a)};                                                                        \
   }                                                                                                \
                                                                                                    \
-  static dcarg name##_to_dcarg(cpptype a) { return dcarg{a}; }                                     \
+  static jit_arg name##_to_jit(cpptype a) { return jit_arg{dcarg{a}}; }                            \
                                                                                                    \
   static cpptype py_to_##name(dcarg a)                                                             \
   {                                                                                                \
@@ -611,8 +731,7 @@ namespace {
     cpptype operator()(data_cell_index const& id)                                                  \
     {                                                                                              \
       PyGILRAII gil;                                                                               \
-      PyObject* arg0 = wrap_dci(id);                                                               \
-      dcarg res = this->py_callback<dcarg, 1>::operator()(dcarg{arg0}); /* decrefs arg0 */         \
+      dcarg res = this->py_callback<dcarg, 1>::operator()(py_ref{wrap_dci(id)});                   \
       PyObject* pyres = res.get<PyObject*>();                                                      \
       cpptype cres = frompy(pyres);                                                                \
       std::string msg;                                                                             \
@@ -634,24 +753,26 @@ namespace {
   BASIC_CONVERTER(double, double, PyFloat_FromDouble, PyFloat_AsDouble)
 
 #define VECTOR_CONVERTER(name, cpptype, nptype)                                                    \
-  static dcarg name##_to_py(std::shared_ptr<std::vector<cpptype>> const& v)                        \
+  static py_ref name##_to_py(array_view<cpptype> const& v)                                         \
   {                                                                                                \
     PyGILRAII gil;                                                                                 \
                                                                                                    \
-    if (!v) {                                                                                      \
+    if (!v.owner()) {                                                                              \
       Py_INCREF(Py_None);                                                                          \
-      return dcarg{Py_None};                                                                       \
+      return py_ref{Py_None};                                                                      \
     }                                                                                              \
                                                                                                    \
-    /* use a numpy view with the shared pointer tied up in a lifeline object (note: this */        \
-    /* is just a demonstrator; alternatives are still being considered) */                         \
-    std::array<npy_intp, 1> dims{static_cast<npy_intp>(v->size())};                                \
+    /* use a numpy view of the same shape, with the owner of the buffer tied up in a */            \
+    /* lifeline object (note: this is just a demonstrator; alternatives are still being */         \
+    /* considered) */                                                                              \
+    std::vector<npy_intp> dims(v.shape().begin(), v.shape().end());                                \
                                                                                                    \
-    PyObject* np_view = PyArray_SimpleNewFromData(1,           /* 1-D array */                     \
-                                                  dims.data(), /* dimension sizes */               \
-                                                  nptype,      /* numpy C type */                  \
-                                                  (v->data())  /* raw buffer */                    \
-    );                                                                                             \
+    PyObject* np_view =                                                                            \
+      PyArray_SimpleNewFromData(static_cast<int>(dims.size()), /* number of dimensions */          \
+                                dims.data(),                   /* dimension sizes */               \
+                                nptype,                        /* numpy C type */                  \
+                                const_cast<cpptype*>(v.data()) /* raw buffer */                    \
+      );                                                                                           \
                                                                                                    \
     if (!np_view) {                                                                                \
       throw std::runtime_error("failed to allocate numpy view object");                            \
@@ -669,11 +790,13 @@ namespace {
       Py_DECREF(np_view);                                                                          \
       throw std::runtime_error("failed to allocate lifeline object");                              \
     }                                                                                              \
-    pyll->m_source = v;                                                                            \
+    pyll->m_source = std::const_pointer_cast<void>(v.owner());                                     \
     pyll->m_view = np_view; /* steals reference */                                                 \
                                                                                                    \
-    return dcarg{pyll};                                                                            \
-  }
+    return py_ref{reinterpret_cast<PyObject*>(pyll)};                                              \
+  }                                                                                                \
+                                                                                                   \
+  static jit_arg name##_to_jit(array_view<cpptype> const& v) { return jit_arg{v}; }
 
   VECTOR_CONVERTER(vint, std::int32_t, NPY_INT32)
   VECTOR_CONVERTER(vuint, std::uint32_t, NPY_UINT32)
@@ -683,31 +806,46 @@ namespace {
   VECTOR_CONVERTER(vdouble, double, NPY_DOUBLE)
 
 #define NUMPY_ARRAY_CONVERTER(name, cpptype, nptype, frompy)                                       \
-  static std::shared_ptr<std::vector<cpptype>> py_to_##name(dcarg a)                               \
+  static array_view<cpptype> py_to_##name(dcarg a)                                                 \
   {                                                                                                \
     PyGILRAII gil;                                                                                 \
                                                                                                    \
-    auto vec = std::make_shared<std::vector<cpptype>>();                                           \
     PyObject* pyobj = a.get<PyObject*>();                                                          \
                                                                                                    \
-    /* TODO: because of unresolved ownership issues, copy the full array contents */               \
     if (PyArray_Check(pyobj)) {                                                                    \
-      PyArrayObject* arr = reinterpret_cast<PyArrayObject*>(pyobj);                                \
+      /* a C-contiguous array of the declared type is viewed without copying; anything */          \
+      /* else is first converted into one, following numpy's safe casting rules */                 \
+      PyObject* arr = PyArray_FromAny(                                                             \
+        pyobj, PyArray_DescrFromType(nptype), 0, 0, NPY_ARRAY_CARRAY_RO, nullptr);                 \
+      Py_DECREF(pyobj);                                                                            \
+      if (!arr) {                                                                                  \
+        std::string msg;                                                                           \
+        msg_from_py_error(msg, true);                                                              \
+        throw std::runtime_error("Array conversion error for type " #name ": " + msg);             \
+      }                                                                                            \
                                                                                                    \
-      /* TODO: flattening the array here seems to be the only workable solution */                 \
-      npy_intp* dims = PyArray_DIMS(arr);                                                          \
-      int nd = PyArray_NDIM(arr);                                                                  \
-      size_t total = 1;                                                                            \
-      for (int i = 0; i < nd; ++i)                                                                 \
-        total *= static_cast<size_t>(dims[i]);                                                     \
+      /* the product is immutable, so it is held through a read-only view, which keeps the */      \
+      /* array alive as its base; the array itself may be the algorithm's and is left as is */     \
+      PyObject* view = PyArray_View(reinterpret_cast<PyArrayObject*>(arr), nullptr, nullptr);      \
+      Py_DECREF(arr);                                                                              \
+      if (!view) {                                                                                 \
+        std::string msg;                                                                           \
+        msg_from_py_error(msg, true);                                                              \
+        throw std::runtime_error("Array view error for type " #name ": " + msg);                   \
+      }                                                                                            \
+      auto* parr = reinterpret_cast<PyArrayObject*>(view);                                         \
+      PyArray_CLEARFLAGS(parr, NPY_ARRAY_WRITEABLE);                                               \
+                                                                                                   \
+      npy_intp const* dims = PyArray_DIMS(parr);                                                   \
+      std::vector<std::size_t> shape(dims, dims + PyArray_NDIM(parr));                             \
+      return array_view<cpptype>{                                                                  \
+        py_owner(view), static_cast<cpptype const*>(PyArray_DATA(parr)), std::move(shape)};        \
+    }                                                                                              \
                                                                                                    \
-      /* copy the array info; note that this assumes C continuity */                               \
-      auto* raw = static_cast<cpptype*>(PyArray_DATA(arr));                                        \
-      vec->reserve(total);                                                                         \
-      vec->insert(vec->end(), raw, raw + total);                                                   \
-    } else if (PyList_Check(pyobj)) {                                                              \
+    std::vector<cpptype> vec;                                                                      \
+    if (PyList_Check(pyobj)) {                                                                     \
       Py_ssize_t total = PyList_Size(pyobj);                                                       \
-      vec->reserve(total);                                                                         \
+      vec.reserve(total);                                                                          \
       for (Py_ssize_t i = 0; i < total; ++i) {                                                     \
         PyObject* item = PyList_GetItem(pyobj, i);                                                 \
         auto value = static_cast<cpptype>(frompy(item));                                           \
@@ -716,7 +854,7 @@ namespace {
           Py_DECREF(pyobj);                                                                        \
           throw std::runtime_error("List conversion error for type " #name ": " + msg);            \
         }                                                                                          \
-        vec->push_back(value);                                                                     \
+        vec.push_back(value);                                                                      \
       }                                                                                            \
     } else {                                                                                       \
       std::string msg;                                                                             \
@@ -726,16 +864,15 @@ namespace {
     }                                                                                              \
                                                                                                    \
     Py_DECREF(pyobj);                                                                              \
-    return vec;                                                                                    \
+    return array_view<cpptype>{std::move(vec)};                                                    \
   }                                                                                                \
                                                                                                    \
   struct provider_cb_##name : public py_callback<dcarg, 1> {                                       \
     using py_callback<dcarg, 1>::py_callback;                                                      \
-    std::shared_ptr<std::vector<cpptype>> operator()(data_cell_index const& id)                    \
+    array_view<cpptype> operator()(data_cell_index const& id)                                      \
     {                                                                                              \
       PyGILRAII gil;                                                                               \
-      PyObject* arg0 = wrap_dci(id);                                                               \
-      dcarg pyres = this->py_callback<dcarg, 1>::operator()(dcarg{arg0}); /* decrefs arg0 */       \
+      dcarg pyres = this->py_callback<dcarg, 1>::operator()(py_ref{wrap_dci(id)});                 \
       auto cres = py_to_##name(pyres);                                    /* decrefs pyres */      \
       return cres;                                                                                 \
     }                                                                                              \
@@ -749,6 +886,241 @@ namespace {
   NUMPY_ARRAY_CONVERTER(vfloat, float, NPY_FLOAT, PyFloat_AsDouble)
   NUMPY_ARRAY_CONVERTER(vdouble, double, NPY_DOUBLE, PyFloat_AsDouble)
 
+  // fundamental types, which batched algorithms are restricted to
+  int fundamental_nptype(std::string const& type)
+  {
+    if (type == "bool") {
+      return NPY_BOOL;
+    }
+    if (type == "int32_t") {
+      return NPY_INT32;
+    }
+    if (type == "uint32_t") {
+      return NPY_UINT32;
+    }
+    if (type == "int64_t") {
+      return NPY_INT64;
+    }
+    if (type == "uint64_t") {
+      return NPY_UINT64;
+    }
+    if (type == "float") {
+      return NPY_FLOAT;
+    }
+    if (type == "double") {
+      return NPY_DOUBLE;
+    }
+    return NPY_NOTYPE;
+  }
+
+  // conversion of a Python result to the native representation of its (fundamental)
+  // type, as expected by the native output converters; steals the reference
+  dcarg py_to_dcarg(PyObject* pyobj, std::string const& type)
+  {
+    if (type == "bool") {
+      return dcarg{py_to_bool(dcarg{pyobj})};
+    }
+    if (type == "int32_t") {
+      return dcarg{py_to_int(dcarg{pyobj})};
+    }
+    if (type == "uint32_t") {
+      return dcarg{py_to_uint(dcarg{pyobj})};
+    }
+    if (type == "int64_t") {
+      return dcarg{py_to_long(dcarg{pyobj})};
+    }
+    if (type == "uint64_t") {
+      return dcarg{py_to_ulong(dcarg{pyobj})};
+    }
+    if (type == "float") {
+      return dcarg{py_to_float(dcarg{pyobj})};
+    }
+    if (type == "double") {
+      return dcarg{py_to_double(dcarg{pyobj})};
+    }
+    Py_DECREF(pyobj);
+    throw std::invalid_argument("unsupported batched result type: " + type);
+  }
+
+  // A call of a batched algorithm, waiting to be made as part of a batch
+  struct batch_request {
+    std::span<jit_arg const* const> m_args;
+    dcarg m_result{};
+    std::exception_ptr m_error{};
+    bool m_done = false;
+  };
+
+  // Combines the calls of an algorithm that arrive while a batch is being processed: the
+  // first caller to find no batch in progress processes (up to m_max_size of) the pending
+  // requests, on behalf of all their callers. Those are blocked in the meantime, as they
+  // would otherwise be blocked on the GIL.
+  class batcher {
+  public:
+    explicit batcher(std::size_t max_size) : m_max_size(max_size) {}
+
+    template <typename F>
+    void submit(batch_request& request, F&& process)
+    {
+      std::unique_lock lock{m_mutex};
+      m_pending.push_back(&request);
+      while (!request.m_done) {
+        if (m_busy) {
+          m_batch_done.wait(lock);
+          continue;
+        }
+
+        m_busy = true;
+        auto const size = std::min(m_pending.size(), m_max_size);
+        std::vector<batch_request*> batch(m_pending.begin(), m_pending.begin() + size);
+        m_pending.erase(m_pending.begin(), m_pending.begin() + size);
+        lock.unlock();
+
+        process(std::span{batch}); // does not throw; errors are set on the requests
+
+        lock.lock();
+        for (auto* r : batch) {
+          r->m_done = true;
+        }
+        m_busy = false;
+        m_batch_done.notify_all();
+      }
+    }
+
+  private:
+    std::size_t m_max_size;
+    std::mutex m_mutex;
+    std::condition_variable m_batch_done;
+    std::vector<batch_request*> m_pending;
+    bool m_busy = false;
+  };
+
+  template <typename RT, typename Sq>
+  struct batch_callback_impl;
+
+  // Python callable invoked for a batch of cells at once, under a single acquisition of the
+  // GIL: each argument is a numpy array holding the values of all cells in the batch, and
+  // the result (if any) must be a sequence with one entry per cell. The inputs arrive in
+  // their native representation, and the results are returned in theirs, so that neither
+  // conversion takes the GIL on its own.
+  template <typename RT, size_t... Is>
+  struct batch_callback_impl<RT, std::index_sequence<Is...>> : public py_callback_base {
+    std::vector<int> m_input_nptypes;
+    std::string m_output_type;
+    std::shared_ptr<batcher> m_batcher; // shared between copies
+
+    batch_callback_impl(PyObject* callable,
+                        std::size_t batch_size,
+                        std::string const& output_type,
+                        std::vector<std::string> const& input_types) :
+      py_callback_base(callable, nullptr),
+      m_output_type(output_type),
+      m_batcher(std::make_shared<batcher>(batch_size))
+    {
+      std::ranges::transform(input_types, std::back_inserter(m_input_nptypes), fundamental_nptype);
+      PyGILRAII gil;
+      m_call = resolve_call(callable);
+    }
+
+    RT operator()(type_repeater<jit_arg const&, Is>... args)
+    {
+      std::array<jit_arg const*, sizeof...(Is)> argsv{&args...};
+      batch_request request{.m_args = argsv};
+      m_batcher->submit(request, [this](std::span<batch_request*> batch) { process(batch); });
+
+      if (request.m_error) {
+        std::rethrow_exception(request.m_error);
+      }
+      if constexpr (!std::is_void_v<RT>) {
+        return request.m_result;
+      }
+    }
+
+  private:
+    void process(std::span<batch_request*> batch)
+    {
+      PyGILRAII gil;
+
+      try {
+        call(batch);
+      } catch (...) {
+        for (auto* r : batch) {
+          r->m_error = std::current_exception();
+        }
+      }
+    }
+
+    void call(std::span<batch_request*> batch)
+    {
+      auto const nbatch = static_cast<npy_intp>(batch.size());
+
+      // stack the values of each input into an array
+      std::array<PyObject*, sizeof...(Is)> pyargs{};
+      for (std::size_t i = 0; i != pyargs.size(); ++i) {
+        pyargs[i] = PyArray_SimpleNew(1, &nbatch, m_input_nptypes[i]);
+        if (!pyargs[i]) {
+          std::ranges::for_each(pyargs, [](PyObject* a) { Py_XDECREF(a); });
+          throw std::runtime_error("failed to allocate batched input array");
+        }
+        auto* parr = reinterpret_cast<PyArrayObject*>(pyargs[i]);
+        for (npy_intp k = 0; k != nbatch; ++k) {
+          std::visit(
+            [ptr = PyArray_GETPTR1(parr, k)](auto const& value) {
+              if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(value)>>) {
+                std::memcpy(ptr, &value, sizeof(value));
+              }
+            },
+            batch[k]->m_args[i]->m_value.m_value);
+        }
+      }
+
+      PyObject* result = vectorcall(m_callable, m_call, pyargs[Is]...);
+      std::ranges::for_each(pyargs, [](PyObject* a) { Py_DECREF(a); });
+
+      std::string error_msg;
+      if (!result) {
+        if (!msg_from_py_error(error_msg)) {
+          error_msg = "Unknown python error";
+        }
+        throw std::runtime_error(error_msg);
+      }
+
+      if constexpr (!std::is_void_v<RT>) {
+        PyObject* results = PySequence_Fast(result, "batched result is not a sequence");
+        Py_DECREF(result);
+        if (!results) {
+          msg_from_py_error(error_msg, true);
+          throw std::runtime_error(error_msg);
+        }
+        if (PySequence_Fast_GET_SIZE(results) != nbatch) {
+          Py_DECREF(results);
+          throw std::runtime_error(
+            fmt::format("batched result has the wrong length (expected {})", nbatch));
+        }
+
+        PyObject** items = PySequence_Fast_ITEMS(results);
+        try {
+          for (npy_intp k = 0; k != nbatch; ++k) {
+            Py_INCREF(items[k]);
+            batch[k]->m_result = py_to_dcarg(items[k], m_output_type);
+          }
+        } catch (...) {
+          Py_DECREF(results);
+          throw;
+        }
+        Py_DECREF(results);
+      } else {
+        Py_DECREF(result);
+      }
+    }
+
+    // __call__ of a callable instance, resolved once (see vectorcall.hpp), or nullptr;
+    // like the callable, never released
+    PyObject* m_call{nullptr};
+  };
+
+  template <typename RT, size_t N>
+  using batch_callback = batch_callback_impl<RT, std::make_index_sequence<N>>;
+
   // helper for inserting converter nodes
   template <typename R, typename... Args>
   void insert_converter(py_phlex_module* mod,
@@ -763,6 +1135,25 @@ namespace {
       .output_product_suffixes(output);
   }
 
+  // helper for inserting input converter nodes, which are shared by all algorithms of the
+  // module that apply the same converter to the same product; returns the name of the node
+  // that provides the converted product
+  template <typename R, typename... Args>
+  std::string const& insert_input_converter(py_phlex_module* mod,
+                                            std::string const& name,
+                                            R (*converter)(Args...),
+                                            product_selector const& pq_in,
+                                            std::string const& output,
+                                            concurrency nconcur)
+  {
+    auto key = std::make_pair(pq_in.to_string(), reinterpret_cast<void (*)()>(converter));
+    auto [it, inserted] = mod->input_converters.try_emplace(std::move(key), name);
+    if (inserted) {
+      insert_converter(mod, name, converter, pq_in, output, nconcur);
+    }
+    return it->second;
+  }
+
 } // unnamed namespace
 
 static PyObject* parse_args(PyObject* args,
@@ -772,7 +1163,8 @@ static PyObject* parse_args(PyObject* args,
                             std::vector<std::string>& input_types,
                             std::vector<std::string>& output_suffixes,
                             std::vector<std::string>& output_types,
-                            concurrency& nconcur)
+                            concurrency& nconcur,
+                            std::size_t& batch_size)
 {
   // Helper function to extract the common names and identifiers needed to insert
   // any node. (The observer does not require outputs, but they still need to be
@@ -786,19 +1178,34 @@ static PyObject* parse_args(PyObject* args,
   static char kw2[] = "output_product_suffixes";
   static char kw3[] = "concurrency";
   static char kw4[] = "name";
-  static char* kwnames[] = {kw0, kw1, kw2, kw3, kw4, nullptr};
+  static char kw5[] = "batch";
+  static char* kwnames[] = {kw0, kw1, kw2, kw3, kw4, kw5, nullptr};
   // NOLINTEND(modernize-avoid-c-arrays)
 #else
-  static std::array<char const*, 6> const kwnames{
-    "callable", "input_family", "output_product_suffixes", "concurrency", "name", nullptr};
+  static std::array<char const*, 7> const kwnames{"callable",
+                                                  "input_family",
+                                                  "output_product_suffixes",
+                                                  "concurrency",
+                                                  "name",
+                                                  "batch",
+                                                  nullptr};
 #endif
   PyObject* callable = nullptr;
   PyObject* input = nullptr;
   PyObject* output = nullptr;
   PyObject* pyname = nullptr;
   int nconcur_ = -1;
-  if (!PyArg_ParseTupleAndKeywords(
-        args, kwds, "OO|OiO", std::data(kwnames), &callable, &input, &output, &nconcur_, &pyname)) {
+  int batch_ = 0;
+  if (!PyArg_ParseTupleAndKeywords(args,
+                                   kwds,
+                                   "OO|OiOi",
+                                   std::data(kwnames),
+                                   &callable,
+                                   &input,
+                                   &output,
+                                   &nconcur_,
+                                   &pyname,
+                                   &batch_)) {
     // error already set by argument parser
     return nullptr;
   }
@@ -808,8 +1215,29 @@ static PyObject* parse_args(PyObject* args,
     return nullptr;
   }
 
-  // set concurrency, or the default of serial if not set
-  nconcur = nconcur_ > 0 ? concurrency(nconcur_) : concurrency::serial;
+  // batching only applies to Python callables, as native calls have no interpreter
+  // overhead to amortize
+  if (batch_ < 0) {
+    PyErr_SetString(PyExc_ValueError, "batch size can not be negative");
+    return nullptr;
+  }
+  bool const is_cfunc = is_numba_cfunc(callable);
+  if (is_cfunc && batch_) {
+    PyErr_SetString(PyExc_TypeError, "Numba cfuncs can not be batched");
+    return nullptr;
+  }
+  batch_size = static_cast<std::size_t>(batch_);
+
+  // set concurrency, or the default if not set: serial for Python callables, which
+  // are bound by the GIL, and unlimited for Numba cfuncs, which are called without it;
+  // batches are formed from concurrent calls, so enough of them are allowed to fill one
+  if (nconcur_ > 0) {
+    nconcur = concurrency(nconcur_);
+  } else if (is_cfunc) {
+    nconcur = concurrency::unlimited;
+  } else {
+    nconcur = batch_size ? concurrency(batch_size) : concurrency::serial;
+  }
 
   // retrieve function name
   if (!pyname) {
@@ -902,9 +1330,12 @@ static bool insert_input_converters(py_phlex_module* mod,
                                     std::vector<product_selector> const& input_selectors,
                                     std::vector<std::string> const& input_types,
                                     bool ispy,
-                                    concurrency nc)
+                                    concurrency nc,
+                                    std::vector<std::string>& converter_names)
 {
-  // insert input converter nodes into the graph
+  // insert input converter nodes into the graph, unless already available
+  converter_names.clear();
+  converter_names.reserve(input_selectors.size());
   for (auto const [i, inp_pq, inp_type] :
        std::views::zip(std::views::iota(size_t{}), input_selectors, input_types)) {
     // TODO: this seems overly verbose and inefficient, but the function needs
@@ -914,20 +1345,29 @@ static bool insert_input_converters(py_phlex_module* mod,
     std::string output =
       "py_" + (inp_pq.suffix ? std::string{static_cast<std::string_view>(*inp_pq.suffix)} : "");
 
+    // converters to Python objects for Python callables, or to native call arguments
+    auto insert = [&](auto to_py, auto to_jit) {
+      if (ispy) {
+        converter_names.push_back(insert_input_converter(mod, pyname, to_py, inp_pq, output, nc));
+      } else {
+        converter_names.push_back(insert_input_converter(mod, pyname, to_jit, inp_pq, output, nc));
+      }
+    };
+
     if (inp_type == "bool") {
-      insert_converter(mod, pyname, ispy ? bool_to_py : bool_to_dcarg, inp_pq, output, nc);
+      insert(bool_to_py, bool_to_jit);
     } else if (inp_type == "int32_t") {
-      insert_converter(mod, pyname, ispy ? int_to_py : int_to_dcarg, inp_pq, output, nc);
+      insert(int_to_py, int_to_jit);
     } else if (inp_type == "uint32_t") {
-      insert_converter(mod, pyname, ispy ? uint_to_py : uint_to_dcarg, inp_pq, output, nc);
+      insert(uint_to_py, uint_to_jit);
     } else if (inp_type == "int64_t") {
-      insert_converter(mod, pyname, ispy ? long_to_py : long_to_dcarg, inp_pq, output, nc);
+      insert(long_to_py, long_to_jit);
     } else if (inp_type == "uint64_t") {
-      insert_converter(mod, pyname, ispy ? ulong_to_py : ulong_to_dcarg, inp_pq, output, nc);
+      insert(ulong_to_py, ulong_to_jit);
     } else if (inp_type == "float") {
-      insert_converter(mod, pyname, ispy ? float_to_py : float_to_dcarg, inp_pq, output, nc);
+      insert(float_to_py, float_to_jit);
     } else if (inp_type == "double") {
-      insert_converter(mod, pyname, ispy ? double_to_py : double_to_dcarg, inp_pq, output, nc);
+      insert(double_to_py, double_to_jit);
     } else if (inp_type.starts_with("ndarray") || inp_type.starts_with("list")) {
       // TODO: these are hard-coded std::vector <-> numpy array mappings, which is
       // way too simplistic for real use. It only exists for demonstration purposes,
@@ -938,17 +1378,17 @@ static bool insert_input_converters(py_phlex_module* mod,
         return false;
       }
       if (*dtype == "[int32_t]") {
-        insert_converter(mod, pyname, vint_to_py, inp_pq, output, nc);
+        insert(vint_to_py, vint_to_jit);
       } else if (*dtype == "[uint32_t]") {
-        insert_converter(mod, pyname, vuint_to_py, inp_pq, output, nc);
+        insert(vuint_to_py, vuint_to_jit);
       } else if (*dtype == "[int64_t]") {
-        insert_converter(mod, pyname, vlong_to_py, inp_pq, output, nc);
+        insert(vlong_to_py, vlong_to_jit);
       } else if (*dtype == "[uint64_t]") {
-        insert_converter(mod, pyname, vulong_to_py, inp_pq, output, nc);
+        insert(vulong_to_py, vulong_to_jit);
       } else if (*dtype == "[float]") {
-        insert_converter(mod, pyname, vfloat_to_py, inp_pq, output, nc);
+        insert(vfloat_to_py, vfloat_to_jit);
       } else if (*dtype == "[double]") {
-        insert_converter(mod, pyname, vdouble_to_py, inp_pq, output, nc);
+        insert(vdouble_to_py, vdouble_to_jit);
       } else {
         PyErr_Format(PyExc_TypeError, "unsupported collection input type \"%s\"", inp_type.c_str());
         return false;
@@ -1036,6 +1476,25 @@ static bool unroll_switch(size_t rt_size, Cf&& func)
   }(std::make_index_sequence<N>{});
 }
 
+// Batched algorithms receive arrays of, and return sequences of, fundamental values.
+static bool check_batched(std::string const& cname,
+                          std::vector<std::string> const& input_types,
+                          std::vector<std::string> const& output_types)
+{
+  for (auto const& types : {input_types, output_types}) {
+    for (auto const& type : types) {
+      if (fundamental_nptype(type) == NPY_NOTYPE) {
+        PyErr_Format(PyExc_TypeError,
+                     "batched algorithm %s has unsupported type \"%s\"",
+                     cname.c_str(),
+                     type.c_str());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 static PyObject* md_transform(py_phlex_module* mod, PyObject* args, PyObject* kwds)
 {
   // Register a python algorithm by adding the necessary intermediate converter
@@ -1047,8 +1506,16 @@ static PyObject* md_transform(py_phlex_module* mod, PyObject* args, PyObject* kw
   std::vector<std::string> output_suffixes;
   std::vector<std::string> output_types;
   concurrency nconcur(-1);
-  PyObject* callable = parse_args(
-    args, kwds, cname, input_selectors, input_types, output_suffixes, output_types, nconcur);
+  std::size_t batch_size = 0;
+  PyObject* callable = parse_args(args,
+                                  kwds,
+                                  cname,
+                                  input_selectors,
+                                  input_types,
+                                  output_suffixes,
+                                  output_types,
+                                  nconcur,
+                                  batch_size);
 
   if (!callable) {
     return nullptr; // error already set
@@ -1093,7 +1560,17 @@ static PyObject* md_transform(py_phlex_module* mod, PyObject* args, PyObject* kw
     }
   }
 
-  if (!insert_input_converters(mod, cname, input_selectors, input_types, !ccallf, nconcur)) {
+  if (batch_size && !check_batched(cname, input_types, output_types)) {
+    Py_DECREF(callable);
+    return nullptr;
+  }
+
+  // Numba cfuncs and batched algorithms take inputs, and return outputs, natively
+  bool const native = ccallf || batch_size;
+
+  std::vector<std::string> converter_names;
+  if (!insert_input_converters(
+        mod, cname, input_selectors, input_types, !native, nconcur, converter_names)) {
     Py_DECREF(callable);
     return nullptr; // error already set
   }
@@ -1107,41 +1584,22 @@ static PyObject* md_transform(py_phlex_module* mod, PyObject* args, PyObject* kw
   std::string pyoutput = output_suffixes[0] + "_py";
   std::string const& out_type = output_types[0];
 
-  // TODO: the following makes the AI happy, but should be removed shortly once
-  // vector support is added for Numba (WIP; release is cut first)
-  // LCOV_EXCL_START
-  auto is_collection_type = [](std::string const& type) {
-    return type.starts_with("ndarray") || type.starts_with("list");
-  };
-  if (ccallf) {
-    for (auto const& input_type : input_types) {
-      if (is_collection_type(input_type)) {
-        PyErr_Format(PyExc_TypeError,
-                     "Numba transform %s has unsupported collection input type \"%s\"",
-                     cname.c_str(),
-                     input_type.c_str());
-        Py_DECREF(callable);
-        return nullptr;
-      }
-    }
-    if (is_collection_type(out_type)) {
-      PyErr_Format(PyExc_TypeError,
-                   "Numba transform %s has unsupported collection output type \"%s\"",
-                   cname.c_str(),
-                   out_type.c_str());
-      Py_DECREF(callable);
-      return nullptr;
-    }
+  // a C function can take arrays as a pointer and a size, but has no way of returning one
+  if (ccallf && (out_type.starts_with("ndarray") || out_type.starts_with("list"))) {
+    PyErr_Format(PyExc_TypeError,
+                 "Numba transform %s has unsupported collection output type \"%s\"",
+                 cname.c_str(),
+                 out_type.c_str());
+    Py_DECREF(callable);
+    return nullptr;
   }
-  // LCOV_EXCL_STOP
-  // end TODO
 
   auto transform_N_args = [&]<size_t... Is>(std::index_sequence<Is...>) {
     constexpr size_t N = sizeof...(Is);
 
     auto make_product_selector = [&](size_t i) {
       auto pq = input_selectors[i];
-      std::string c = input_converter_name(cname, i);
+      std::string const& c = converter_names[i];
       std::string suff =
         "py_" + (pq.suffix ? std::string{static_cast<std::string_view>(*pq.suffix)} : "");
 
@@ -1156,7 +1614,10 @@ static PyObject* md_transform(py_phlex_module* mod, PyObject* args, PyObject* kw
     };
 
     if (ccallf) {
-      jit_callback<dcarg, N> cb{callable, ccallf, out_type};
+      jit_callback<dcarg, N> cb{callable, ccallf, out_type, input_types};
+      insert_tranform_for_callback(cb);
+    } else if (batch_size) {
+      batch_callback<dcarg, N> cb{callable, batch_size, out_type, input_types};
       insert_tranform_for_callback(cb);
     } else {
       py_callback<dcarg, N> cb{callable};
@@ -1175,7 +1636,7 @@ static PyObject* md_transform(py_phlex_module* mod, PyObject* args, PyObject* kw
                                  .layer = identifier(output_layer),
                                  .suffix = identifier(pyoutput)};
   std::string const& output = output_suffixes[0];
-  if (!insert_output_converter(mod, cname, out_pq, out_type, output, !ccallf, nconcur)) {
+  if (!insert_output_converter(mod, cname, out_pq, out_type, output, !native, nconcur)) {
     Py_DECREF(callable);
     return nullptr; // error already set
   }
@@ -1195,8 +1656,16 @@ static PyObject* md_observe(py_phlex_module* mod, PyObject* args, PyObject* kwds
   std::vector<std::string> output_suffixes;
   std::vector<std::string> output_types;
   concurrency nconcur(-1);
-  PyObject* callable = parse_args(
-    args, kwds, cname, input_selectors, input_types, output_suffixes, output_types, nconcur);
+  std::size_t batch_size = 0;
+  PyObject* callable = parse_args(args,
+                                  kwds,
+                                  cname,
+                                  input_selectors,
+                                  input_types,
+                                  output_suffixes,
+                                  output_types,
+                                  nconcur,
+                                  batch_size);
 
   if (!callable) {
     return nullptr; // error already set
@@ -1224,7 +1693,19 @@ static PyObject* md_observe(py_phlex_module* mod, PyObject* args, PyObject* kwds
     return nullptr;
   }
 
-  if (!insert_input_converters(mod, cname, input_selectors, input_types, !ccallf, nconcur)) {
+  if (batch_size && !check_batched(cname, input_types, output_types)) {
+    Py_DECREF(callable);
+    return nullptr;
+  }
+
+  std::vector<std::string> converter_names;
+  if (!insert_input_converters(mod,
+                               cname,
+                               input_selectors,
+                               input_types,
+                               !ccallf && !batch_size,
+                               nconcur,
+                               converter_names)) {
     Py_DECREF(callable);
     return nullptr; // error already set
   }
@@ -1235,7 +1716,7 @@ static PyObject* md_observe(py_phlex_module* mod, PyObject* args, PyObject* kwds
 
     auto make_product_selector = [&](size_t i) {
       auto pq = input_selectors[i];
-      std::string c = input_converter_name(cname, i);
+      std::string const& c = converter_names[i];
       std::string suff =
         "py_" + (pq.suffix ? std::string{static_cast<std::string_view>(*pq.suffix)} : "");
 
@@ -1248,7 +1729,10 @@ static PyObject* md_observe(py_phlex_module* mod, PyObject* args, PyObject* kwds
     };
 
     if (ccallf) {
-      jit_callback<void, N> cb{callable, ccallf, "void"};
+      jit_callback<void, N> cb{callable, ccallf, "void", input_types};
+      insert_observe_for_callback(cb);
+    } else if (batch_size) {
+      batch_callback<void, N> cb{callable, batch_size, "void", input_types};
       insert_observe_for_callback(cb);
     } else {
       py_callback<void, N> cb{callable};
@@ -1288,7 +1772,7 @@ PyTypeObject phlex::experimental::PhlexModule_Type = {
   // clang-format on
   .tp_basicsize = sizeof(py_phlex_module),
   .tp_itemsize = 0,
-  .tp_dealloc = nullptr,
+  .tp_dealloc = reinterpret_cast<destructor>(md_dealloc),
   .tp_vectorcall_offset = 0,
   .tp_getattr = nullptr,
   .tp_setattr = nullptr,
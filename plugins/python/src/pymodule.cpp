@@ -12,6 +12,7 @@
 
 #include "phlex/model/data_cell_index.hpp"
 #include "phlex/source.hpp"
+#include "spdlog/spdlog.h"
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
@@ -21,6 +22,7 @@ using namespace phlex;
 using phlex::detail::framework_graph;
 
 static bool initialize();
+static void warn_if_gil_enabled();
 
 // the expansion of registration macros within the same file would lead to
 // symbol duplication, hence the use of separate namespaces here
@@ -97,6 +99,8 @@ namespace pymodule_register_algorithms {
       }
       throw std::runtime_error(error_msg);
     }
+
+    warn_if_gil_enabled();
   }
 } // namespace pymodule_register_algorithms
 
@@ -114,6 +118,29 @@ static void import_numpy(bool control_interpreter)
   }
 }
 
+// A free-threaded interpreter re-enables the GIL when importing an extension module that
+// does not declare support for running without it, or when so requested (PYTHON_GIL=1).
+// Python algorithms are then serialized again, which deserves a warning.
+static void warn_if_gil_enabled()
+{
+#ifdef Py_GIL_DISABLED
+  static std::atomic<bool> warned{false};
+  if (warned) {
+    return;
+  }
+
+  PyObject* sys = PyImport_ImportModule("sys");
+  PyObject* enabled = sys ? PyObject_CallMethod(sys, "_is_gil_enabled", nullptr) : nullptr;
+  if (enabled == Py_True && !warned.exchange(true)) {
+    spdlog::warn("Python is free-threaded, but the GIL has been enabled; "
+                 "Python algorithms will not run concurrently");
+  }
+  Py_XDECREF(enabled);
+  Py_XDECREF(sys);
+  PyErr_Clear();
+#endif
+}
+
 static void add_cmake_prefix_paths_to_syspath(char const* cmake_prefix_path)
 {
   std::string prefix_path_str(cmake_prefix_path);
@@ -0,0 +1,70 @@
+#ifndef PLUGINS_PYTHON_SRC_VECTORCALL_HPP
+#define PLUGINS_PYTHON_SRC_VECTORCALL_HPP
+
+// =======================================================================================
+//
+// Direct calls of Python callables with a fixed number of arguments.
+//
+// Design rationale
+// ================
+//
+// Python callbacks take a known number of object arguments, so there is no need to collect
+// them in a vector and go through a variadic C call (see dyncall.hpp): the vectorcall
+// protocol (PEP 590) takes them from an array on the stack instead.
+//
+// Functions, methods, and builtins implement vectorcall. Instances of classes that define
+// __call__ do not: each call looks up __call__ and binds it to the instance. For those, the
+// function is resolved once and called with the instance as its first argument. Both
+// helpers require the GIL to be held.
+//
+// =======================================================================================
+
+#include "Python.h"
+
+#include <array>
+#include <concepts>
+
+namespace phlex::experimental {
+
+  // Returns the __call__ function of a callable instance that lacks a vectorcall
+  // implementation of its own, or nullptr if the callable is best called as-is. A returned
+  // function is a new reference.
+  inline PyObject* resolve_call(PyObject* callable)
+  {
+    if (PyVectorcall_Function(callable)) {
+      return nullptr;
+    }
+
+    auto* type = reinterpret_cast<PyObject*>(Py_TYPE(callable));
+    PyObject* call = PyObject_GetAttrString(type, "__call__");
+    if (!call) {
+      PyErr_Clear();
+      return nullptr;
+    }
+    if (!PyFunction_Check(call)) {
+      Py_DECREF(call);
+      return nullptr;
+    }
+    return call;
+  }
+
+  // Calls 'callable' with the given arguments, or, if 'call' is not null, calls 'call' (as
+  // obtained from resolve_call) with 'callable' prepended to them. Returns a new reference,
+  // or nullptr with a Python exception set.
+  template <std::same_as<PyObject*>... Args>
+  PyObject* vectorcall(PyObject* callable, PyObject* call, Args... args)
+  {
+    // the first slot may be used by the callee (PY_VECTORCALL_ARGUMENTS_OFFSET), the second
+    // one holds the instance if it is prepended
+    std::array<PyObject*, sizeof...(Args) + 2> argsv{nullptr, callable, args...};
+    if (call) {
+      return PyObject_Vectorcall(
+        call, argsv.data() + 1, (sizeof...(Args) + 1) | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+    }
+    return PyObject_Vectorcall(
+      callable, argsv.data() + 2, sizeof...(Args) | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+  }
+
+} // namespace phlex::experimental
+
+#endif // PLUGINS_PYTHON_SRC_VECTORCALL_HPP
@@ -73,12 +73,27 @@ namespace phlex::experimental {
   // Error reporting helper.
   bool msg_from_py_error(std::string& msg, bool check_error = false);
 
-  // RAII helper for GIL handling
+  // Python thread states are kept for the lifetime of the thread, rather than being created
+  // and destroyed by every (outermost) PyGILState_Ensure/Release pair on a TBB worker thread.
+  // The extra Ensure is never released; the thread state is reclaimed, if at all, with the
+  // interpreter.
+  inline void retain_thread_state()
+  {
+    thread_local bool retained = false;
+    if (!retained && !PyGILState_Check()) {
+      PyGILState_Ensure();
+      PyEval_SaveThread();
+      retained = true;
+    }
+  }
+
+  // RAII helper for GIL handling; in free-threaded builds, there is no GIL and this merely
+  // attaches the thread state, which is required to call into Python
   class PyGILRAII {
     PyGILState_STATE m_GILState;
 
   public:
-    PyGILRAII() : m_GILState(PyGILState_Ensure()) {}
+    PyGILRAII() : m_GILState((retain_thread_state(), PyGILState_Ensure())) {}
     ~PyGILRAII() { PyGILState_Release(m_GILState); }
     PyGILRAII(PyGILRAII const&) = delete;
     PyGILRAII& operator=(PyGILRAII const&) = delete;
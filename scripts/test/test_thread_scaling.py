@@ -0,0 +1,226 @@
+"""Tests for thread_scaling.py.
+
+Coverage strategy
+-----------------
+Unit tests cover the parsing of the resource-usage summary, the scaling
+metrics and the baseline comparison.
+
+Integration tests exercise main() end-to-end with a stand-in for the phlex
+executable that prints a resource-usage summary depending on ``-j``.
+"""
+
+from __future__ import annotations
+
+import csv
+import json
+import stat
+import sys
+from pathlib import Path
+
+import pytest
+
+# sys.path is set up by scripts/test/conftest.py.
+import thread_scaling as M  # noqa: E402
+
+_SUMMARY = (
+    "[2026-01-01 00:00:00.000] [info] CPU time: 3.50000s  Real time: 2.00000s  "
+    "CPU efficiency: 175.00%\n"
+    "[2026-01-01 00:00:00.000] [info] Max. RSS: 48.125 MB\n"
+)
+
+# Real time is 4s divided by the number of threads, up to 4 threads
+_FAKE_PHLEX = """\
+import sys
+threads = int(sys.argv[sys.argv.index("-j") + 1])
+if "fail" in sys.argv[-1]:
+    sys.exit(3)
+real = 4.0 / min(threads, 4)
+print(f"[info] CPU time: {4.0 + threads:.5f}s  Real time: {real:.5f}s  CPU efficiency: 1%")
+print(f"[info] Max. RSS: {40.0 + threads:.3f} MB")
+"""
+
+
+@pytest.fixture
+def fake_phlex(tmp_path: Path) -> Path:
+    """Executable stand-in for phlex."""
+    path = tmp_path / "phlex"
+    path.write_text(f"#!{sys.executable}\n{_FAKE_PHLEX}", encoding="utf-8")
+    path.chmod(path.stat().st_mode | stat.S_IEXEC)
+    return path
+
+
+# ---------------------------------------------------------------------------
+# parse_resource_usage
+# ---------------------------------------------------------------------------
+
+
+class TestParseResourceUsage:
+    """Tests for parse_resource_usage()."""
+
+    def test_summary(self) -> None:
+        """Both log lines are parsed."""
+        assert M.parse_resource_usage(_SUMMARY) == {
+            "real_time": 2.0,
+            "cpu_time": 3.5,
+            "max_rss_mb": 48.125,
+        }
+
+    def test_missing_summary(self) -> None:
+        """Output without the summary gives None."""
+        assert M.parse_resource_usage("[info] Number of worker threads: 4\n") is None
+        assert M.parse_resource_usage(_SUMMARY.splitlines()[0]) is None
+
+    def test_event_count(self) -> None:
+        """The number of processed data cells is included when reported."""
+        output = _SUMMARY + "[info] Processed 1000 event data cells in 1.5s (666.7 per second)\n"
+        usage = M.parse_resource_usage(output)
+        assert usage is not None
+        assert usage["events"] == 1000
+        assert "events" not in M.parse_resource_usage(_SUMMARY)
+
+    def test_last_summary_wins(self) -> None:
+        """The summary printed last is used."""
+        later = _SUMMARY.replace("2.00000s", "1.00000s").replace("48.125", "50.000")
+        usage = M.parse_resource_usage(_SUMMARY + later)
+        assert usage is not None
+        assert usage["real_time"] == 1.0
+        assert usage["max_rss_mb"] == 50.0
+
+
+# ---------------------------------------------------------------------------
+# compute_scaling
+# ---------------------------------------------------------------------------
+
+
+class TestComputeScaling:
+    """Tests for compute_scaling()."""
+
+    @staticmethod
+    def _usage(real_time: float) -> dict[str, float]:
+        return {"real_time": real_time, "cpu_time": 1.0, "max_rss_mb": 10.0}
+
+    def test_empty(self) -> None:
+        """No measurements give no entries."""
+        assert M.compute_scaling({}) == []
+
+    def test_relative_to_smallest_thread_count(self) -> None:
+        """Speedup and efficiency are relative to the smallest thread count."""
+        entries = M.compute_scaling(
+            {4: self._usage(1.0), 2: self._usage(1.5), 8: self._usage(1.0)}
+        )
+        assert [e["threads"] for e in entries] == [2, 4, 8]
+        assert [e["speedup"] for e in entries] == pytest.approx([1.0, 1.5, 1.5])
+        assert [e["efficiency"] for e in entries] == pytest.approx([1.0, 0.75, 0.375])
+
+    def test_events_per_second(self) -> None:
+        """The event rate is relative to the wall time."""
+        usage = {**self._usage(2.0), "events": 1000}
+        entries = M.compute_scaling({1: usage, 2: self._usage(1.0)})
+        assert entries[0]["events_per_second"] == pytest.approx(500.0)
+        assert "events_per_second" not in entries[1]
+
+    def test_zero_time(self) -> None:
+        """A zero wall time does not divide by zero."""
+        entries = M.compute_scaling({1: self._usage(1.0), 2: self._usage(0.0)})
+        assert entries[1]["speedup"] == 0.0
+
+
+# ---------------------------------------------------------------------------
+# find_regressions
+# ---------------------------------------------------------------------------
+
+
+def _report(**times: list[float]) -> dict:
+    """Report with the given wall times for thread counts 1, 2, ..."""
+    return {
+        "benchmarks": {
+            name: [{"threads": i + 1, "real_time": t} for i, t in enumerate(values)]
+            for name, values in times.items()
+        }
+    }
+
+
+class TestFindRegressions:
+    """Tests for find_regressions()."""
+
+    def test_within_threshold(self) -> None:
+        """Slowdowns up to the threshold are accepted."""
+        baseline = _report(a=[2.0, 1.0])
+        assert M.find_regressions(_report(a=[2.1, 0.5]), baseline, 0.1) == []
+
+    def test_over_threshold(self) -> None:
+        """Slowdowns over the threshold are reported per thread count."""
+        regressions = M.find_regressions(_report(a=[2.0, 1.5]), _report(a=[2.0, 1.0]), 0.1)
+        assert len(regressions) == 1
+        assert "a with 2 thread(s)" in regressions[0]
+        assert "+50.0%" in regressions[0]
+
+    def test_missing_from_baseline(self) -> None:
+        """Benchmarks and thread counts absent from the baseline are ignored."""
+        baseline = _report(a=[1.0])
+        assert M.find_regressions(_report(a=[1.0, 5.0], b=[5.0]), baseline, 0.1) == []
+
+
+# ---------------------------------------------------------------------------
+# main
+# ---------------------------------------------------------------------------
+
+
+class TestMain:
+    """End-to-end tests of main()."""
+
+    def test_reports(self, tmp_path: Path, fake_phlex: Path) -> None:
+        """The JSON and CSV reports hold one entry per thread count."""
+        output = tmp_path / "report.json"
+        csv_output = tmp_path / "report.csv"
+        status = M.main(
+            [
+                "--phlex",
+                str(fake_phlex),
+                "-j",
+                "1,2,8",
+                "-o",
+                str(output),
+                "--csv",
+                str(csv_output),
+                "bench-01.jsonnet",
+            ]
+        )
+        assert status == 0
+
+        entries = json.loads(output.read_text())["benchmarks"]["bench-01"]
+        assert [e["threads"] for e in entries] == [1, 2, 8]
+        assert [e["real_time"] for e in entries] == [4.0, 2.0, 1.0]
+        assert [e["cpu_time"] for e in entries] == [5.0, 6.0, 12.0]
+        assert [e["max_rss_mb"] for e in entries] == [41.0, 42.0, 48.0]
+        assert [e["efficiency"] for e in entries] == pytest.approx([1.0, 1.0, 0.5])
+
+        with csv_output.open() as f:
+            rows = list(csv.DictReader(f))
+        assert [r["threads"] for r in rows] == ["1", "2", "8"]
+        assert rows[0]["benchmark"] == "bench-01"
+
+    def test_baseline(self, tmp_path: Path, fake_phlex: Path) -> None:
+        """A regression against the baseline gives a non-zero status."""
+        baseline = tmp_path / "baseline.json"
+        baseline.write_text(json.dumps(_report(**{"bench-01": [4.0, 1.0]})))
+        args = ["--phlex", str(fake_phlex), "-j", "1,2", "-o", str(tmp_path / "r.json")]
+
+        assert M.main([*args, "--baseline", str(baseline), "bench-01.jsonnet"]) == 1
+        assert (
+            M.main([*args, "--baseline", str(baseline), "--threshold", "1.5", "bench-01.jsonnet"])
+            == 0
+        )
+
+    def test_failed_job(self, tmp_path: Path, fake_phlex: Path) -> None:
+        """A failing job gives a non-zero status."""
+        status = M.main(
+            ["--phlex", str(fake_phlex), "-j", "1", "-o", str(tmp_path / "r.json"), "fail.jsonnet"]
+        )
+        assert status == 1
+
+    @pytest.mark.parametrize("value", ["0", "", "one,two"])
+    def test_invalid_thread_counts(self, value: str) -> None:
+        """Invalid thread counts are rejected by the argument parser."""
+        with pytest.raises(SystemExit):
+            M.main(["-j", value, "bench.jsonnet"])
@@ -0,0 +1,312 @@
+#!/usr/bin/env python3
+r"""Measure how Phlex benchmark workflows scale with the number of threads.
+
+PURPOSE
+-------
+Each benchmark configuration is run with ``phlex -j N`` for a sweep of thread
+counts.  The wall time, CPU time and maximum resident set size reported by
+the framework at the end of each job (``phlex::detail::resource_usage``) are
+collected, from which the speedup and parallel efficiency relative to the
+smallest thread count are computed.
+
+OUTPUT FORMAT
+-------------
+The JSON report maps each benchmark to one entry per thread count::
+
+    {"benchmarks": {"benchmark-01": [{"threads": 1, "real_time": 2.1,
+                                      "cpu_time": 2.0, "max_rss_mb": 51.2,
+                                      "speedup": 1.0, "efficiency": 1.0}, ...]}}
+
+Benchmarks that report the number of data cells they processed (see the
+``event_rate`` module of ``test/benchmarks``) also get ``events`` and
+``events_per_second`` entries, the rate being relative to the wall time.
+
+The CSV report has one row per (benchmark, threads) pair with the same
+columns.
+
+BASELINE COMPARISON
+-------------------
+A previously written JSON report can be given as a baseline.  A measurement
+whose wall time exceeds that of the baseline, for the same benchmark and
+thread count, by more than the threshold fraction is reported as a
+regression, and the script exits with status 1.  Measurements absent from
+the baseline are ignored.
+
+USAGE
+-----
+    # Sweep 1, 2, 4 and 8 threads over all benchmarks
+    python3 scripts/thread_scaling.py --phlex build/bin/phlex test/benchmarks/*.jsonnet
+
+    # Choose the thread counts and also write a CSV report
+    python3 scripts/thread_scaling.py --phlex build/bin/phlex -j 1,4,16 --csv scaling.csv \
+        -o scaling.json test/benchmarks/benchmark-05.jsonnet
+
+    # Compare against a stored report, flagging slowdowns of more than 15%
+    python3 scripts/thread_scaling.py --phlex build/bin/phlex --baseline scaling.json \
+        --threshold 0.15 test/benchmarks/benchmark-05.jsonnet
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+import json
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+_TIMES = re.compile(r"CPU time: ([0-9.]+)s\s+Real time: ([0-9.]+)s")
+_RSS = re.compile(r"Max\. RSS: ([0-9.]+) MB")
+_EVENTS = re.compile(r"Processed ([0-9]+) \S+ data cells")
+
+CSV_FIELDS = [
+    "benchmark",
+    "threads",
+    "real_time",
+    "cpu_time",
+    "max_rss_mb",
+    "speedup",
+    "efficiency",
+    "events",
+    "events_per_second",
+]
+
+
+def parse_resource_usage(output: str) -> dict[str, float] | None:
+    """Extract the resource usage reported at the end of a Phlex job.
+
+    Args:
+        output: Combined standard output and error of the ``phlex`` process.
+
+    Returns:
+        A dict with ``real_time`` and ``cpu_time`` (seconds) and ``max_rss_mb``,
+        or ``None`` if the output does not contain the resource-usage summary.
+        If the summary appears more than once, the last one is used.  If the
+        job also reports the number of data cells it processed, that number is
+        included as ``events``.
+    """
+    times = _TIMES.findall(output)
+    rss = _RSS.findall(output)
+    if not times or not rss:
+        return None
+    cpu_time, real_time = times[-1]
+    usage = {
+        "real_time": float(real_time),
+        "cpu_time": float(cpu_time),
+        "max_rss_mb": float(rss[-1]),
+    }
+    if events := _EVENTS.findall(output):
+        usage["events"] = int(events[-1])
+    return usage
+
+
+def run_benchmark(phlex: Path, config: Path, threads: int) -> dict[str, float]:
+    """Run one benchmark configuration with the given number of threads.
+
+    Args:
+        phlex: Path to the ``phlex`` executable.
+        config: Path to the benchmark configuration.
+        threads: Value passed to ``phlex -j``.
+
+    Returns:
+        The parsed resource usage (see :func:`parse_resource_usage`).
+
+    Raises:
+        RuntimeError: If the job fails or does not report its resource usage.
+    """
+    command = [str(phlex), "-j", str(threads), "-c", str(config)]
+    result = subprocess.run(command, capture_output=True, text=True, check=False)
+    output = result.stdout + result.stderr
+    if result.returncode != 0:
+        raise RuntimeError(
+            f"'{' '.join(command)}' failed with status {result.returncode}:\n{output}"
+        )
+    usage = parse_resource_usage(output)
+    if usage is None:
+        raise RuntimeError(f"'{' '.join(command)}' did not report its resource usage")
+    return usage
+
+
+def compute_scaling(measurements: dict[int, dict[str, float]]) -> list[dict]:
+    """Compute speedup and parallel efficiency for one benchmark.
+
+    The reference is the measurement with the smallest thread count.  The
+    speedup is the ratio of its wall time to that of each measurement, and the
+    efficiency is the speedup divided by the ratio of the thread counts.
+
+    Args:
+        measurements: Mapping from thread count to parsed resource usage.
+
+    Returns:
+        One entry per thread count, in increasing order, with the resource
+        usage plus ``threads``, ``speedup`` and ``efficiency``, and
+        ``events_per_second`` if the number of events is known.
+    """
+    if not measurements:
+        return []
+    reference_threads = min(measurements)
+    reference_time = measurements[reference_threads]["real_time"]
+
+    entries = []
+    for threads in sorted(measurements):
+        usage = measurements[threads]
+        real_time = usage["real_time"]
+        speedup = reference_time / real_time if real_time > 0 else 0.0
+        entry = {
+            "threads": threads,
+            **usage,
+            "speedup": speedup,
+            "efficiency": speedup * reference_threads / threads,
+        }
+        if "events" in usage and real_time > 0:
+            entry["events_per_second"] = usage["events"] / real_time
+        entries.append(entry)
+    return entries
+
+
+def find_regressions(report: dict, baseline: dict, threshold: float) -> list[str]:
+    """Compare the wall times of a report with those of a baseline report.
+
+    Args:
+        report: Report in the format written by :func:`write_json`.
+        baseline: Earlier report in the same format.
+        threshold: Allowed relative increase of the wall time (e.g. 0.1 for 10%).
+
+    Returns:
+        A description of each regression, empty if there are none.
+    """
+    regressions = []
+    baseline_benchmarks = baseline.get("benchmarks", {})
+    for name, entries in sorted(report.get("benchmarks", {}).items()):
+        reference = {e["threads"]: e for e in baseline_benchmarks.get(name, [])}
+        for entry in entries:
+            base = reference.get(entry["threads"])
+            if base is None or base["real_time"] <= 0:
+                continue
+            change = entry["real_time"] / base["real_time"] - 1
+            if change > threshold:
+                regressions.append(
+                    f"{name} with {entry['threads']} thread(s): real time "
+                    f"{entry['real_time']:.3f}s vs. {base['real_time']:.3f}s "
+                    f"in baseline (+{change:.1%})"
+                )
+    return regressions
+
+
+def write_json(report: dict, path: Path) -> None:
+    """Write the report as JSON."""
+    path.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+
+
+def write_csv(report: dict, path: Path) -> None:
+    """Write the report as CSV, one row per benchmark and thread count."""
+    with path.open("w", newline="", encoding="utf-8") as f:
+        writer = csv.DictWriter(f, fieldnames=CSV_FIELDS)
+        writer.writeheader()
+        for name, entries in report["benchmarks"].items():
+            for entry in entries:
+                writer.writerow({"benchmark": name, **entry})
+
+
+def _thread_counts(value: str) -> list[int]:
+    """Parse a comma-separated list of positive thread counts."""
+    try:
+        counts = sorted({int(v) for v in value.split(",") if v.strip()})
+    except ValueError as exc:
+        raise argparse.ArgumentTypeError(f"invalid thread counts '{value}'") from exc
+    if not counts or counts[0] < 1:
+        raise argparse.ArgumentTypeError(f"invalid thread counts '{value}'")
+    return counts
+
+
+def build_arg_parser() -> argparse.ArgumentParser:
+    """Build and return the argument parser for this script."""
+    parser = argparse.ArgumentParser(
+        prog="thread_scaling.py",
+        description=(
+            "Run Phlex benchmark configurations across a sweep of thread counts "
+            "and report wall time, CPU time, max. RSS, speedup and parallel efficiency."
+        ),
+    )
+    parser.add_argument(
+        "configs", type=Path, nargs="+", metavar="CONFIG", help="Benchmark configuration."
+    )
+    parser.add_argument(
+        "--phlex", type=Path, default=Path("phlex"), help="Path to the phlex executable."
+    )
+    parser.add_argument(
+        "-j",
+        "--threads",
+        type=_thread_counts,
+        default=[1, 2, 4, 8],
+        metavar="N[,N...]",
+        help="Comma-separated thread counts (default: 1,2,4,8).",
+    )
+    parser.add_argument(
+        "-o",
+        "--output",
+        type=Path,
+        default=Path("thread_scaling.json"),
+        metavar="FILE",
+        help="Write the JSON report to FILE (default: thread_scaling.json).",
+    )
+    parser.add_argument("--csv", type=Path, metavar="FILE", help="Also write a CSV report.")
+    parser.add_argument(
+        "--baseline", type=Path, metavar="FILE", help="JSON report to compare against."
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.10,
+        help="Relative wall-time increase flagged as a regression (default: 0.10).",
+    )
+    return parser
+
+
+def main(argv: list[str] | None = None) -> int:
+    """Run the sweep, write the reports, and compare with the baseline.
+
+    Returns:
+        0 on success, 1 if a benchmark fails or a regression is found.
+    """
+    args = build_arg_parser().parse_args(argv)
+
+    report: dict = {"benchmarks": {}}
+    for config in args.configs:
+        name = config.name.removesuffix(".jsonnet")
+        measurements = {}
+        for threads in args.threads:
+            try:
+                measurements[threads] = run_benchmark(args.phlex, config, threads)
+            except RuntimeError as exc:
+                print(exc, file=sys.stderr)
+                return 1
+        report["benchmarks"][name] = compute_scaling(measurements)
+
+        for entry in report["benchmarks"][name]:
+            rate = entry.get("events_per_second")
+            print(
+                f"{name:<24} {entry['threads']:>3} thread(s): "
+                f"real {entry['real_time']:9.3f}s  cpu {entry['cpu_time']:9.3f}s  "
+                f"rss {entry['max_rss_mb']:9.1f} MB  speedup {entry['speedup']:5.2f}  "
+                f"efficiency {entry['efficiency']:6.1%}"
+                + (f"  {rate:12.1f} events/s" if rate is not None else "")
+            )
+
+    write_json(report, args.output)
+    if args.csv is not None:
+        write_csv(report, args.csv)
+
+    if args.baseline is None:
+        return 0
+
+    baseline = json.loads(args.baseline.read_text(encoding="utf-8"))
+    regressions = find_regressions(report, baseline, args.threshold)
+    for regression in regressions:
+        print(f"Regression: {regression}", file=sys.stderr)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,26 @@
+#include "test/allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+  std::atomic<std::size_t> allocation_count_{};
+}
+
+std::size_t phlex::test::allocation_count() noexcept
+{
+  return allocation_count_.load(std::memory_order_relaxed);
+}
+
+// The array and nothrow forms of operator new/delete forward to these by default.
+void* operator new(std::size_t size)
+{
+  allocation_count_.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
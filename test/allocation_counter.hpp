@@ -0,0 +1,14 @@
+#ifndef TEST_ALLOCATION_COUNTER_HPP
+#define TEST_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+// Linking the allocation_counter library replaces the global allocation and deallocation
+// functions of the program with ones that count each call to operator new.
+
+namespace phlex::test {
+  // Number of calls to the global allocation function since the program started.
+  std::size_t allocation_count() noexcept;
+}
+
+#endif // TEST_ALLOCATION_COUNTER_HPP
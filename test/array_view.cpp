@@ -0,0 +1,58 @@
+#include "phlex/model/array_view.hpp"
+#include "phlex/model/type_id.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace phlex::experimental;
+using namespace phlex::detail;
+
+TEST_CASE("Array view owning a vector", "[array_view]")
+{
+  array_view<int> const view{std::vector<int>{1, 2, 3}};
+  CHECK(view.size() == 3);
+  CHECK(view.ndim() == 1);
+  CHECK(view.shape() == std::vector<std::size_t>{3});
+  CHECK(std::vector<int>(view.begin(), view.end()) == std::vector<int>{1, 2, 3});
+  CHECK(view.at(2) == 3);
+  CHECK_THROWS_AS(view.at(3), std::out_of_range);
+
+  // copies share the buffer
+  auto const copy = view;
+  CHECK(copy.data() == view.data());
+}
+
+TEST_CASE("Array view of an externally owned buffer", "[array_view]")
+{
+  auto buffer = std::make_shared<std::vector<double>>(6);
+  std::iota(buffer->begin(), buffer->end(), 0.0);
+  std::weak_ptr<std::vector<double>> const observer = buffer;
+
+  array_view<double> view{buffer, buffer->data(), {2, 3}};
+  buffer.reset();
+
+  // the view keeps the buffer alive
+  REQUIRE_FALSE(observer.expired());
+  CHECK(view.size() == 6);
+  CHECK(view.ndim() == 2);
+  CHECK(view[4] == 4.0);
+  CHECK(view.span().size() == 6);
+
+  view = {};
+  CHECK(observer.expired());
+  CHECK(view.empty());
+  CHECK(view.owner() == nullptr);
+}
+
+TEST_CASE("Array views are lists of their element type", "[array_view]")
+{
+  auto const view_type = make_type_id<array_view<double>>();
+  auto const vector_type = make_type_id<std::vector<double>>();
+  CHECK(view_type.is_list());
+  CHECK(view_type == vector_type);
+  CHECK_FALSE(view_type.exact_compare(vector_type));
+}
@@ -1,8 +1,13 @@
 #include "phlex/source.hpp"
 
-PHLEX_REGISTER_PROVIDERS(s)
+#include <string>
+#include <vector>
+
+PHLEX_REGISTER_PROVIDERS(s, config)
 {
   using namespace phlex;
-  s.provide("provide_id", [](data_cell_index const& id) { return id; })
-    .output_product("input", "id", "event");
+  for (auto const& layer : config.get<std::vector<std::string>>("layers", {"event"})) {
+    s.provide("provide_" + layer + "_id", [](data_cell_index const& id) { return id; })
+      .output_product("input", "id", experimental::identifier{layer});
+  }
 }
@@ -0,0 +1,243 @@
+// Microbenchmarks of the Phlex core primitives on the per-event path.
+//
+// The benchmarks are run by CTest (label "benchmark"), which also writes the results to
+// core_primitives.json in the test directory.  To run them by hand:
+//
+//   core_primitives "[benchmark]" --reporter JSON::out=results.json --reporter console
+
+#include "phlex/core/detail/repeater_node.hpp"
+#include "phlex/core/index_router.hpp"
+#include "phlex/core/message.hpp"
+#include "phlex/core/multilayer_join_node.hpp"
+#include "phlex/model/data_cell_index.hpp"
+#include "phlex/model/handle.hpp"
+#include "phlex/model/identifier.hpp"
+#include "phlex/model/product_store.hpp"
+#include "phlex/model/products.hpp"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "oneapi/tbb/flow_graph.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace phlex;
+using namespace phlex::detail;
+using namespace phlex::experimental;
+using namespace phlex::experimental::literals;
+
+namespace {
+  // Number of data cells sent through the graph-based benchmarks per measured run
+  constexpr std::size_t n_events = 1000;
+
+  template <typename T>
+  product_specification spec(char const* creator, char const* suffix)
+  {
+    return {algorithm_name{creator}, identifier{suffix}, make_type_id<T>()};
+  }
+
+  std::vector<data_cell_index_ptr> make_events(data_cell_index_ptr const& parent)
+  {
+    std::vector<data_cell_index_ptr> result;
+    result.reserve(n_events);
+    for (std::size_t i = 0; i != n_events; ++i) {
+      result.push_back(parent->make_child("event", i));
+    }
+    return result;
+  }
+
+  // Counts the messages it receives during a measured run
+  template <typename T>
+  class counting_sink : public tbb::flow::function_node<T> {
+  public:
+    explicit counting_sink(tbb::flow::graph& g) :
+      tbb::flow::function_node<T>{g, tbb::flow::unlimited, [this](T const&) { ++count_; }}
+    {
+    }
+
+    // The messages received since the last call
+    std::size_t take() { return count_.exchange(0); }
+
+  private:
+    std::atomic<std::size_t> count_{};
+  };
+}
+
+TEST_CASE("Data model primitives", "[benchmark]")
+{
+  auto const run = data_cell_index::job()->make_child("run", 1);
+  auto const subrun = run->make_child("subrun", 2);
+  auto const event = subrun->make_child("event", 3);
+
+  BENCHMARK("data_cell_index::make_child") { return subrun->make_child("event", 4); };
+  BENCHMARK("data_cell_index::hash") { return event->hash(); };
+  BENCHMARK("data_cell_index::parent(layer)") { return event->parent("run"_id); };
+
+  identifier const event_layer{"event"};
+  identifier const same_layer{"event"};
+  identifier const other_layer{"subrun"};
+  BENCHMARK("identifier construction") { return identifier{"event"}; };
+  BENCHMARK("identifier equality") { return event_layer == same_layer; };
+  BENCHMARK("identifier ordering") { return event_layer < other_layer; };
+
+  std::vector const specs{spec<int>("source", "a"),
+                          spec<double>("source", "b"),
+                          spec<std::string>("source", "c"),
+                          spec<std::vector<float>>("source", "d")};
+  BENCHMARK("products::add (4 products)")
+  {
+    products result{specs.size()};
+    result.add(specs[0], 1);
+    result.add(specs[1], 2.);
+    result.add(specs[2], std::string{"three"});
+    result.add(specs[3], std::vector<float>(4));
+    return result;
+  };
+
+  products all;
+  all.add(specs[0], 1);
+  all.add(specs[1], 2.);
+  all.add(specs[2], std::string{"three"});
+  all.add(specs[3], std::vector<float>(4));
+  BENCHMARK("products::get (last of 4)") { return all.get<std::vector<float>>(specs[3]).size(); };
+
+  BENCHMARK("product_store creation") { return std::make_shared<product_store>(event); };
+  BENCHMARK("product_store creation with one product")
+  {
+    auto store = std::make_shared<product_store>(event);
+    store->add_product(specs[0], 42);
+    return store;
+  };
+
+  auto store = std::make_shared<product_store>(event);
+  store->add_product(specs[0], 42);
+  int const value = 42;
+  BENCHMARK("handle<T> construction") { return handle<int>{value, *event, specs[0]}; };
+  BENCHMARK("product_store::get_handle") { return *store->get_handle<int>(specs[0]); };
+}
+
+TEST_CASE("index_router::route", "[benchmark]")
+{
+  tbb::flow::graph g;
+  counting_sink<index_message> provider{g};
+
+  index_router router{g};
+  router.finalize(g,
+                  {layer_path{"/job/run"}, layer_path{"/job/run/event"}},
+                  {},
+                  {{"provider",
+                    {.input_product = {.creator = "input", .layer = "event", .suffix = "number"},
+                     .port = &provider}}},
+                  {},
+                  {});
+
+  auto const events = make_events(data_cell_index::job()->make_child("run", 1));
+  index_flushes const no_flushes;
+  auto route_events = [&] {
+    for (auto const& event : events) {
+      router.route(event, no_flushes);
+    }
+    g.wait_for_all();
+    return provider.take();
+  };
+  BENCHMARK("route 1000 events to a provider") { return route_events(); };
+  CHECK(route_events() == n_events);
+}
+
+TEST_CASE("repeater_node", "[benchmark]")
+{
+  tbb::flow::graph g;
+  internal::repeater_node repeater{g, "benchmark_repeater", "run"_id};
+  counting_sink<message> consumer{g};
+  make_edge(repeater, consumer);
+
+  auto const run = data_cell_index::job()->make_child("run", 1);
+  auto store = std::make_shared<product_store>(run);
+  store->add_product(spec<int>("source", "value"), 42);
+
+  // One run product, repeated for each of the run's events, then evicted by the flush
+  auto repeat_product = [&] {
+    repeater.data_port().try_put({.store = store, .id = 0});
+    for (std::size_t i = 0; i != n_events; ++i) {
+      repeater.index_port().try_put({.index = run, .msg_id = i + 1});
+    }
+    repeater.flush_port().try_put({.index = run, .count = static_cast<signed_size_t>(n_events)});
+    g.wait_for_all();
+    return consumer.take();
+  };
+  BENCHMARK("repeat a run product for 1000 events") { return repeat_product(); };
+  CHECK(repeat_product() == n_events);
+  CHECK(repeater.cache_is_empty());
+}
+
+TEST_CASE("multilayer_join_node", "[benchmark]")
+{
+  auto const run = data_cell_index::job()->make_child("run", 1);
+  auto const events = make_events(run);
+
+  std::vector<product_store_ptr> stores;
+  stores.reserve(n_events);
+  for (auto const& event : events) {
+    auto store = std::make_shared<product_store>(event, "source");
+    store->add_product(spec<int>("source", "value"), 1);
+    stores.push_back(std::move(store));
+  }
+
+  SECTION("Inputs from the same layer")
+  {
+    tbb::flow::graph g;
+    multilayer_join_node<2> join{g, "benchmark_join", {"event"_id, "event"_id}};
+    counting_sink<message_tuple<2>> sink{g};
+    make_edge(output_port<0>(join), sink);
+
+    auto& left = receiver_for<0ull, 2>(join, 0u);
+    auto& right = receiver_for<0ull, 2>(join, 1u);
+    auto join_events = [&] {
+      for (std::size_t i = 0; i != n_events; ++i) {
+        left.try_put({.store = stores[i], .id = i});
+        right.try_put({.store = stores[i], .id = i});
+      }
+      g.wait_for_all();
+      return sink.take();
+    };
+    BENCHMARK("join 1000 event pairs") { return join_events(); };
+    CHECK(join_events() == n_events);
+  }
+
+  SECTION("Inputs from the run and event layers")
+  {
+    tbb::flow::graph g;
+    multilayer_join_node<2> join{g, "benchmark_join", {"run"_id, "event"_id}};
+    counting_sink<message_tuple<2>> sink{g};
+    make_edge(output_port<0>(join), sink);
+
+    auto run_store = std::make_shared<product_store>(run, "source");
+    run_store->add_product(spec<int>("source", "run_value"), 1);
+
+    auto& run_port = receiver_for<0ull, 2>(join, 0u);
+    auto& event_port = receiver_for<0ull, 2>(join, 1u);
+    auto index_ports = join.index_ports();
+    REQUIRE(index_ports.size() == 2u);
+
+    // Messages as sent by the index router: the run's index for each event (cached by the
+    // run-layer repeater), and each event's own index (passed through)
+    auto join_events = [&] {
+      run_port.try_put({.store = run_store, .id = 0});
+      for (std::size_t i = 0; i != n_events; ++i) {
+        index_ports[0].index_port->try_put({.index = run, .msg_id = i + 1});
+        index_ports[1].index_port->try_put({.index = events[i], .msg_id = i + 1, .cache = false});
+        event_port.try_put({.store = stores[i], .id = i + 1});
+      }
+      index_ports[0].token_port->try_put(
+        {.index = run, .count = static_cast<signed_size_t>(n_events)});
+      g.wait_for_all();
+      return sink.take();
+    };
+    BENCHMARK("join 1000 events with their run") { return join_events(); };
+    CHECK(join_events() == n_events);
+  }
+}
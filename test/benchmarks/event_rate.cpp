@@ -0,0 +1,62 @@
+#include "phlex/model/data_cell_index.hpp"
+#include "phlex/module.hpp"
+
+#include "spdlog/spdlog.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace phlex;
+
+namespace {
+  // Counts the data cells it observes and, at the end of the job, reports the rate at which
+  // they were processed, measured from the first one.
+  class event_rate {
+  public:
+    explicit event_rate(std::string layer) : layer_{std::move(layer)} {}
+    event_rate(event_rate const&) = delete;
+    event_rate& operator=(event_rate const&) = delete;
+    event_rate(event_rate&&) = delete;
+    event_rate& operator=(event_rate&&) = delete;
+
+    ~event_rate()
+    {
+      auto const n = count_.load();
+      if (n == 0) {
+        return;
+      }
+      auto const seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - begin_).count();
+      spdlog::info("Processed {} {} data cells in {:.5f}s ({:.1f} per second)",
+                   n,
+                   layer_,
+                   seconds,
+                   static_cast<double>(n) / seconds);
+    }
+
+    void count(data_cell_index const&)
+    {
+      std::call_once(started_, [this] { begin_ = std::chrono::steady_clock::now(); });
+      ++count_;
+    }
+
+  private:
+    std::string layer_;
+    std::once_flag started_;
+    std::chrono::steady_clock::time_point begin_;
+    std::atomic<std::size_t> count_{};
+  };
+}
+
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  auto const input = config.get<product_selector>("input");
+  m.make<event_rate>(std::string{std::string_view(input.layer)})
+    .observe("event_rate", &event_rate::count, concurrency::unlimited)
+    .input_family(input);
+}
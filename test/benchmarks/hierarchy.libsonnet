@@ -0,0 +1,28 @@
+// The run -> subrun -> spill -> event hierarchy of the deep-hierarchy benchmarks, with a
+// provider of the index of each data cell in every layer ('input/id').
+//
+// The totals are numbers of data cells *per parent*; the defaults make 10 x 10 x 10 x 100 =
+// 100000 events, as many as the flat benchmarks.  A production-sized hierarchy is, e.g.,
+// 10 x 100 x 100 x 100.
+local runs = 10;
+local subruns = 10;
+local spills = 10;
+local events = 100;
+
+{
+  driver: {
+    cpp: 'generate_layers',
+    layers: {
+      run: { parent: 'job', total: runs },
+      subrun: { parent: 'run', total: subruns },
+      spill: { parent: 'subrun', total: spills },
+      event: { parent: 'spill', total: events },
+    },
+  },
+  sources: {
+    provider: {
+      cpp: 'benchmarks_provider',
+      layers: ['run', 'subrun', 'spill', 'event'],
+    },
+  },
+}
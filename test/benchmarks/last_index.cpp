@@ -1,6 +1,8 @@
 #include "phlex/model/data_cell_index.hpp"
 #include "phlex/module.hpp"
 
+#include <string>
+
 using namespace phlex;
 
 namespace {
@@ -10,6 +12,7 @@ namespace {
 PHLEX_REGISTER_ALGORITHMS(m, config)
 {
   m.transform("last_index", last_index, concurrency::unlimited)
-    .input_family(product_selector{.creator = "input", .layer = "event", .suffix = "id"})
+    .input_family(product_selector{
+      .creator = "input", .layer = config.get<std::string>("layer", "event"), .suffix = "id"})
     .output_product_suffixes(config.get<std::string>("produces", "a"));
 }
@@ -0,0 +1,17 @@
+#include "phlex/module.hpp"
+
+#include <atomic>
+#include <string>
+
+using namespace phlex;
+
+namespace {
+  void sum_numbers(std::atomic<int>& sum, int number) noexcept { sum += number; }
+}
+
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  m.fold("sum_numbers", sum_numbers, concurrency::unlimited, config.get<std::string>("partition"))
+    .input_family(config.get<product_selector>("input"))
+    .output_product_suffixes(config.get<std::string>("produces", "sum"));
+}
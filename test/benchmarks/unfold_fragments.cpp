@@ -0,0 +1,41 @@
+#include "phlex/model/data_cell_index.hpp"
+#include "phlex/module.hpp"
+
+#include <string>
+#include <utility>
+
+using namespace phlex;
+
+namespace {
+  // Splits a data cell into a given number of child cells, each holding its fragment number
+  class fragments {
+  public:
+    explicit fragments(unsigned int n) : n_{n} {}
+    unsigned int initial_value() const { return 0; }
+    bool predicate(unsigned int i) const { return i != n_; }
+    auto unfold(unsigned int i) const { return std::make_pair(i + 1, static_cast<int>(i)); }
+
+  private:
+    unsigned int n_;
+  };
+}
+
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  auto const label = config.get<std::string>("module_label");
+  auto const layer = config.get<std::string>("layer");
+  auto const fan_out = config.get<unsigned int>("fan_out");
+
+  m.transform(
+     "fan_out", [fan_out](data_cell_index const&) { return fan_out; }, concurrency::unlimited)
+    .input_family(product_selector{.creator = "input", .layer = layer, .suffix = "id"})
+    .output_product_suffixes("fan_out");
+
+  m.unfold<fragments>("unfold_fragments",
+                      &fragments::predicate,
+                      &fragments::unfold,
+                      config.get<std::string>("into"),
+                      concurrency::unlimited)
+    .input_family(product_selector{.creator = label, .layer = layer, .suffix = "fan_out"})
+    .output_product_suffixes(config.get<std::string>("produces", "fragment"));
+}
@@ -0,0 +1,23 @@
+#include "phlex/model/data_cell_index.hpp"
+#include "phlex/model/identifier.hpp"
+#include "phlex/module.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <string>
+
+using namespace phlex;
+
+// Joins a data cell's index with a number produced for one of its parent cells, which must be
+// the number of that parent cell.
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  m.observe(
+     "verify_parent",
+     [layer = experimental::identifier{config.get<std::string>("layer")}](
+       data_cell_index const& id, int number) {
+       assert(id.parent(layer)->number() == static_cast<std::size_t>(number));
+     },
+     concurrency::unlimited)
+    .input_family(config.get<product_selector>("index"), config.get<product_selector>("number"));
+}
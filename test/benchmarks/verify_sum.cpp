@@ -0,0 +1,22 @@
+#include "phlex/module.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace phlex;
+
+// Checks a sum against its expected value.  A wrong sum is thrown rather than asserted, so that
+// it fails the job in all build types.
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  m.observe(
+     "verify_sum",
+     [expected = config.get<int>("expected")](int sum) {
+       if (sum != expected) {
+         throw std::runtime_error("verify_sum: sum is " + std::to_string(sum) + " instead of " +
+                                  std::to_string(expected));
+       }
+     },
+     concurrency::unlimited)
+    .input_family(config.get<product_selector>("input"));
+}
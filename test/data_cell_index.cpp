@@ -1,7 +1,10 @@
 #include "phlex/model/data_cell_index.hpp"
+#include "phlex/model/layer_registry.hpp"
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <stdexcept>
+
 using namespace phlex;
 using namespace phlex::experimental::literals;
 
@@ -61,11 +64,59 @@ TEST_CASE("data_cell_index methods", "[data model]")
     CHECK(event->parent("subrun"_id) == subrun);
     CHECK(event->parent("run"_id) == run0);
     CHECK(event->parent("nonexistent"_id) == nullptr);
+    CHECK(event->parent("event"_id) == nullptr);
+
+    // The nearest ancestor is chosen when a layer name appears more than once in the path
+    auto nested_run = event->make_child("run", 2);
+    auto nested_event = nested_run->make_child("event", 3);
+    CHECK(nested_event->parent("run"_id) == nested_run);
+    CHECK(nested_event->parent("event"_id) == event);
+    CHECK(nested_event->parent("subrun"_id) == subrun);
+  }
+
+  SECTION("Equality")
+  {
+    // Indices created independently compare equal if their numbers agree at every depth
+    auto other_run0 = base->make_child("run", 0);
+    CHECK(*run0->make_child("subrun", 2) == *other_run0->make_child("subrun", 2));
+    CHECK_FALSE(*run0->make_child("subrun", 2) == *other_run0->make_child("subrun", 3));
+    CHECK_FALSE(*run0->make_child("subrun", 2) == *run1->make_child("subrun", 2));
+    CHECK_FALSE(*run0 == *run0->make_child("subrun", 0));
+    CHECK(*base == *data_cell_index::job());
   }
 
   SECTION("Layer path")
   {
     auto subrun = run0->make_child("subrun", 5);
     CHECK(subrun->layer_path() == "/job/run/subrun");
+    // The path is shared by all indices in the same layer
+    CHECK(&subrun->layer_path() == &run1->make_child("subrun", 6)->layer_path());
   }
 }
+
+TEST_CASE("Layer ids", "[data model]")
+{
+  auto& registry = detail::layer_registry::instance();
+  auto base = data_cell_index::job();
+  CHECK(base->layer_id() == 0u);
+
+  auto run0 = base->make_child("run", 0);
+  auto run1 = base->make_child("run", 1);
+  CHECK(run0->layer_id() == run1->layer_id());
+  CHECK(run0->layer_id() != base->layer_id());
+
+  // Layers with the same name but different paths are distinct
+  auto calib = base->make_child("calib", 0);
+  auto run_under_calib = calib->make_child("run", 0);
+  CHECK(run_under_calib->layer_id() != run0->layer_id());
+
+  auto subrun = run0->make_child("subrun", 5);
+  auto const& subrun_layer = registry.layer_for(phlex::experimental::layer_path("/job/run/subrun"));
+  CHECK(subrun_layer.id() == subrun->layer_id());
+  CHECK(subrun_layer.hash() == subrun->layer_hash());
+  CHECK(&registry.layer(subrun->layer_id()) == &subrun_layer);
+  CHECK(registry.layer_for(phlex::experimental::layer_path("run/subrun")).id() ==
+        subrun->layer_id());
+  CHECK_THROWS_AS(registry.layer(static_cast<detail::layer_id_t>(registry.size())),
+                  std::out_of_range);
+}
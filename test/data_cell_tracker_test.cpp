@@ -42,20 +42,20 @@ TEST_CASE("Test data-cell tracker", "[graph]")
   auto spill6_flush = flushes[0];
   CHECK(spill6_flush.index == spill6);
   REQUIRE(spill6_flush.counts->size() == 1); // Should only be "subspill" layer
-  CHECK(spill6_flush.counts->count(subspill2->layer_hash()) == 1); // subspill 2
+  CHECK(spill6_flush.counts->count(subspill2->layer_id()) == 1); // subspill 2
 
   auto run4_flush = flushes[1];
   CHECK(run4_flush.index == run4);
-  REQUIRE(run4_flush.counts->size() == 1);                    // Should only be "spill" layer
-  CHECK(run4_flush.counts->count(spill5->layer_hash()) == 2); // spills 5 and 6
+  REQUIRE(run4_flush.counts->size() == 1);                  // Should only be "spill" layer
+  CHECK(run4_flush.counts->count(spill5->layer_id()) == 2); // spills 5 and 6
 
   flushes = tracker.report_and_evict_ready_flushes(nullptr);
   REQUIRE(flushes.size() == 1); // only job should have a flush count
 
   auto job_flush = flushes[0];
   CHECK(job_flush.index == job_index);
-  REQUIRE(job_flush.counts->size() == 1);                  // Should only be "run" layer
-  CHECK(job_flush.counts->count(run4->layer_hash()) == 2); // runs 4 and 5
+  REQUIRE(job_flush.counts->size() == 1);                // Should only be "run" layer
+  CHECK(job_flush.counts->count(run4->layer_id()) == 2); // runs 4 and 5
 }
 
 TEST_CASE("Test data-cell tracker with multiple hierarchy branches", "[graph]")
@@ -76,9 +76,9 @@ TEST_CASE("Test data-cell tracker with multiple hierarchy branches", "[graph]")
   REQUIRE(flushes.size() == 1); // only job should have a flush count
   auto job_flush = flushes[0];
   CHECK(job_flush.index == job_index);
-  REQUIRE(job_flush.counts->size() == 2);                    // Should have "run" and "calib" layers
-  CHECK(job_flush.counts->count(run4->layer_hash()) == 2);   // run 4 and 5
-  CHECK(job_flush.counts->count(calib1->layer_hash()) == 1); // calib 1
+  REQUIRE(job_flush.counts->size() == 2);                  // Should have "run" and "calib" layers
+  CHECK(job_flush.counts->count(run4->layer_id()) == 2);   // run 4 and 5
+  CHECK(job_flush.counts->count(calib1->layer_id()) == 1); // calib 1
 }
 
 TEST_CASE("Test data-cell tracker with missing intermediate layers", "[graph]")
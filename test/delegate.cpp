@@ -0,0 +1,100 @@
+#include "phlex/metaprogramming/delegate.hpp"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+using namespace phlex::detail;
+
+namespace {
+  int plus_one(int i) { return i + 1; }
+  auto const add = [](int i, int j) { return i + j; };
+
+  class accumulator {
+  public:
+    int add(int i) { return total_ += i; }
+    int total() const { return total_; }
+
+  private:
+    int total_{};
+  };
+
+  std::shared_ptr<void_tag> const unbound;
+
+  // Invokes the algorithm the way the nodes do: through a const reference
+  template <typename F>
+  long call_n(F const& ft, int n)
+  {
+    long sum{};
+    for (int i = 0; i != n; ++i) {
+      sum += std::invoke(ft, i);
+    }
+    return sum;
+  }
+}
+
+TEST_CASE("Delegates keep the concrete callable type", "[delegate]")
+{
+  using closure_t = std::remove_cvref_t<decltype(add)>;
+  STATIC_REQUIRE(std::is_same_v<decltype(delegate(unbound, add)), closure_t>);
+  STATIC_REQUIRE(std::is_same_v<decltype(delegate(unbound, plus_one)), int (*)(int)>);
+
+  CHECK(delegate(unbound, add)(1, 2) == 3);
+  CHECK(delegate(unbound, plus_one)(1) == 2);
+}
+
+TEST_CASE("Delegates of mutable callables", "[delegate]")
+{
+  int calls{};
+  auto const count = [&calls, n = 0](int i) mutable {
+    ++calls;
+    return n += i;
+  };
+  using bound_t = decltype(delegate(unbound, count));
+  STATIC_REQUIRE(std::is_same_v<return_type<bound_t>, int>);
+  STATIC_REQUIRE(std::is_same_v<function_parameter_types<bound_t>, std::tuple<int>>);
+
+  auto const bound = delegate(unbound, count);
+  CHECK(bound(1) == 1);
+  CHECK(bound(2) == 3);
+  CHECK(calls == 2);
+}
+
+TEST_CASE("Delegates of member functions", "[delegate]")
+{
+  auto obj = std::make_shared<accumulator>();
+  auto const add_to = delegate(obj, &accumulator::add);
+  auto const total = delegate(obj, &accumulator::total);
+  STATIC_REQUIRE(std::is_same_v<function_parameter_types<decltype(add_to)>, std::tuple<int>>);
+  STATIC_REQUIRE(std::is_same_v<function_parameter_types<decltype(total)>, std::tuple<>>);
+
+  CHECK(add_to(2) == 2);
+  CHECK(add_to(3) == 5);
+  CHECK(total() == 5);
+
+  algorithm_bits bits{obj, &accumulator::total};
+  STATIC_REQUIRE(decltype(bits)::number_inputs == 0);
+  CHECK(bits.release_algorithm()() == 5);
+}
+
+TEST_CASE("Per-call cost of algorithm delegates", "[.][benchmark]")
+{
+  int const n = 1'000;
+  auto const tiny = [](int i) { return i + 1; };
+  auto obj = std::make_shared<accumulator>();
+
+  // std::function is what the delegates were before they kept the concrete type
+  std::function const erased_closure{tiny};
+  std::function const erased_member{delegate(obj, &accumulator::add)};
+  auto const closure = delegate(unbound, tiny);
+  auto const member = delegate(obj, &accumulator::add);
+
+  BENCHMARK("closure, std::function") { return call_n(erased_closure, n); };
+  BENCHMARK("closure, delegate") { return call_n(closure, n); };
+  BENCHMARK("member function, std::function") { return call_n(erased_member, n); };
+  BENCHMARK("member function, delegate") { return call_n(member, n); };
+}
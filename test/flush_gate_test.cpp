@@ -5,6 +5,7 @@
 //   - blocking on expected_flush_count > 1 (multiple unfolds into the same parent layer)
 //   - all_children_accounted() returning false before any flush message arrives
 //   - concurrent execution via tbb::parallel_for with concurrent_hash_map/concurrent_vector
+//   - data_cell_counts beyond its inline capacity, and at a scale of one million data cells
 //
 // The local flush_if_done() helper mirrors the core propagation logic from index_router,
 // allowing flush_gate to be tested without a TBB flow graph.  In the router, the
@@ -20,15 +21,21 @@
 #include "phlex/model/identifier.hpp"
 #include "phlex/utilities/signed_size.hpp"
 
+#include "catch2/benchmark/catch_benchmark.hpp"
 #include "catch2/catch_test_macros.hpp"
 #include "oneapi/tbb/concurrent_hash_map.h"
+#include "oneapi/tbb/concurrent_unordered_map.h"
 #include "oneapi/tbb/concurrent_vector.h"
 #include "oneapi/tbb/parallel_for.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <ranges>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -78,19 +85,42 @@ namespace {
       index = parent;
     }
   }
+
+  // Allocator that tallies the number of bytes it has been asked for.
+  template <typename T>
+  struct counting_allocator {
+    using value_type = T;
+
+    explicit counting_allocator(std::size_t* bytes) : bytes{bytes} {}
+    template <typename U>
+    counting_allocator(counting_allocator<U> const& other) : bytes{other.bytes}
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+      *bytes += n * sizeof(T);
+      return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) { std::allocator<T>{}.deallocate(p, n); }
+
+    bool operator==(counting_allocator const&) const = default;
+
+    std::size_t* bytes;
+  };
 }
 
 TEST_CASE("flush_gate: single-layer hierarchy (job -> runs)", "[flush_gate]")
 {
   auto job = data_cell_index::job();
   auto run0 = job->make_child("run", 0);
-  auto run_layer_hash = run0->layer_hash();
+  auto run_layer = run0->layer_id();
 
   // The unfold into run fires once, reporting 2 children.  Runs are lowest in this test
   // (no descendants), so the expected-count message alone is sufficient to mark the
   // job gate ready — no per-child accounting is performed.
   auto job_gate = make_gate(job, 0);
-  job_gate->update_expected_count(run_layer_hash, 2);
+  job_gate->update_expected_count(run_layer, 2);
 
   gates_t gates;
   gates.emplace(job->hash(), job_gate);
@@ -102,7 +132,7 @@ TEST_CASE("flush_gate: single-layer hierarchy (job -> runs)", "[flush_gate]")
   auto const& jt = flushed[0];
   CHECK(jt->index() == job);
   CHECK(jt->expected_total_count() == 2);
-  CHECK(jt->committed_count_for_layer(run_layer_hash) == 2);
+  CHECK(jt->committed_count_for_layer(run_layer) == 2);
   CHECK(gates.empty());
 }
 
@@ -116,13 +146,13 @@ TEST_CASE("flush_gate: large count behavior", "[flush_gate]")
   auto const count_above_int_max = static_cast<signed_size_t>(std::numeric_limits<int>::max()) + 1;
   auto gate = make_gate(job, 0);
 
-  gate->update_expected_count(large_run->layer_hash(),
+  gate->update_expected_count(large_run->layer_id(),
                               static_cast<std::size_t>(count_above_int_max));
   REQUIRE(gate->all_children_accounted());
 
   SECTION("Preserve counts above INT_MAX")
   {
-    CHECK(gate->committed_count_for_layer(large_run->layer_hash()) == count_above_int_max);
+    CHECK(gate->committed_count_for_layer(large_run->layer_id()) == count_above_int_max);
   }
   SECTION("Reject counts above signed_size_t range")
   {
@@ -138,10 +168,10 @@ TEST_CASE("flush_gate: large count behavior", "[flush_gate]")
       static_cast<std::size_t>(std::numeric_limits<signed_size_t>::max()) + 1;
     auto overflow_gate = make_gate(job, 0);
 
-    overflow_gate->update_expected_count(too_large_run->layer_hash(), count_above_signed_size_max);
+    overflow_gate->update_expected_count(too_large_run->layer_id(), count_above_signed_size_max);
     REQUIRE(overflow_gate->all_children_accounted());
 
-    CHECK_THROWS_AS(overflow_gate->committed_count_for_layer(too_large_run->layer_hash()),
+    CHECK_THROWS_AS(overflow_gate->committed_count_for_layer(too_large_run->layer_id()),
                     std::overflow_error);
   }
 }
@@ -153,10 +183,10 @@ TEST_CASE("flush_gate: two-layer hierarchy (job -> runs -> spills)", "[flush_gat
 
   auto job = data_cell_index::job();
   auto run0 =
-    job->make_child("run", 0); // representative child; layer_hash is the same for all runs
-  auto run_layer_hash = run0->layer_hash();
+    job->make_child("run", 0); // representative child; layer id is the same for all runs
+  auto run_layer = run0->layer_id();
   auto spill0 = run0->make_child("spill", 0);
-  auto spill_layer_hash = spill0->layer_hash();
+  auto spill_layer = spill0->layer_id();
 
   gates_t gates;
   flushed_t flushed;
@@ -165,7 +195,7 @@ TEST_CASE("flush_gate: two-layer hierarchy (job -> runs -> spills)", "[flush_gat
   // so the job gate awaits n_runs rollups.
   auto job_gate = make_gate(job, 0);
   job_gate->expect_child_rollups(n_runs);
-  job_gate->update_expected_count(run_layer_hash, n_runs);
+  job_gate->update_expected_count(run_layer, n_runs);
   gates.emplace(job->hash(), job_gate);
 
   // Pre-populate all run gates before running in parallel, so that flush_if_done
@@ -176,7 +206,7 @@ TEST_CASE("flush_gate: two-layer hierarchy (job -> runs -> spills)", "[flush_gat
   for (std::size_t const r : std::views::iota(0uz, n_runs)) {
     auto& run_index = runs.emplace_back(job->make_child("run", r));
     auto run_gate = make_gate(run_index, 0);
-    run_gate->update_expected_count(spill_layer_hash, n_spills);
+    run_gate->update_expected_count(spill_layer, n_spills);
     gates.emplace(run_index->hash(), run_gate);
   }
 
@@ -192,7 +222,7 @@ TEST_CASE("flush_gate: two-layer hierarchy (job -> runs -> spills)", "[flush_gat
   for (auto const& ft : flushed) {
     if (ft->index()->layer_name() == "run"_id) {
       CHECK(ft->expected_total_count() == n_spills);
-      CHECK(ft->committed_count_for_layer(spill_layer_hash) == n_spills);
+      CHECK(ft->committed_count_for_layer(spill_layer) == n_spills);
     } else {
       REQUIRE(ft->index() == job);
       job_flushed = ft;
@@ -202,9 +232,9 @@ TEST_CASE("flush_gate: two-layer hierarchy (job -> runs -> spills)", "[flush_gat
   REQUIRE(job_flushed);
   CHECK(job_flushed->expected_total_count() == n_runs);
   // Immediate children (runs) counted directly.
-  CHECK(job_flushed->committed_count_for_layer(run_layer_hash) == n_runs);
+  CHECK(job_flushed->committed_count_for_layer(run_layer) == n_runs);
   // Grandchildren (spills) propagated up from the run gates.
-  CHECK(job_flushed->committed_count_for_layer(spill_layer_hash) == n_runs * n_spills);
+  CHECK(job_flushed->committed_count_for_layer(spill_layer) == n_runs * n_spills);
 
   CHECK(gates.empty());
 }
@@ -213,7 +243,7 @@ TEST_CASE("flush_gate: multiple unfolds into the same parent layer", "[flush_gat
 {
   auto job = data_cell_index::job();
   auto run0 = job->make_child("run", 0);
-  auto run_layer_hash = run0->layer_hash();
+  auto run_layer = run0->layer_id();
 
   // Two separate unfolds each produce 2 runs — expected_flush_count = 2.  Runs are
   // lowest in this test, so once both expected-count messages have arrived the gate
@@ -222,22 +252,22 @@ TEST_CASE("flush_gate: multiple unfolds into the same parent layer", "[flush_gat
   auto job_gate = make_gate(job, 2);
 
   // First flush message: 2 children expected, but the second flush hasn't arrived yet.
-  job_gate->update_expected_count(run_layer_hash, 2);
+  job_gate->update_expected_count(run_layer, 2);
   CHECK_FALSE(job_gate->all_children_accounted());
 
   // Second flush message arrives — both unfolds have now reported.
-  job_gate->update_expected_count(run_layer_hash, 2);
+  job_gate->update_expected_count(run_layer, 2);
   CHECK(job_gate->all_children_accounted());
 
   CHECK(job_gate->expected_total_count() == 4);
-  CHECK(job_gate->committed_count_for_layer(run_layer_hash) == 4);
+  CHECK(job_gate->committed_count_for_layer(run_layer) == 4);
 }
 
 TEST_CASE("flush_gate: not done before any flush message arrives", "[flush_gate]")
 {
   auto job = data_cell_index::job();
   auto run0 = job->make_child("run", 0);
-  auto run_layer_hash = run0->layer_hash();
+  auto run_layer = run0->layer_id();
 
   auto gate = make_gate(job, 0);
 
@@ -246,7 +276,7 @@ TEST_CASE("flush_gate: not done before any flush message arrives", "[flush_gate]
 
   // After the expected-count message arrives for a lowest child layer, the gate
   // is immediately ready (no per-child accounting needed).
-  gate->update_expected_count(run_layer_hash, 1);
+  gate->update_expected_count(run_layer, 1);
   CHECK(gate->all_children_accounted());
   CHECK(gate->expected_total_count() == 1);
 }
@@ -257,25 +287,200 @@ TEST_CASE("flush_gate: roll_up_child accumulates across multiple children", "[fl
   auto run0 = job->make_child("run", 0);
   auto run1 = job->make_child("run", 1);
   auto spill0 = run0->make_child("spill", 0);
-  auto spill_layer_hash = spill0->layer_hash();
-  auto run_layer_hash = run0->layer_hash();
+  auto spill_layer = spill0->layer_id();
+  auto run_layer = run0->layer_id();
 
   // Runs are non-lowest in this scenario (they have spills as descendants).
   auto job_gate = make_gate(job, 0);
   job_gate->expect_child_rollups(2);
-  job_gate->update_expected_count(run_layer_hash, 2);
+  job_gate->update_expected_count(run_layer, 2);
 
   // Simulate run 0 rolling up with 3 spills.
   data_cell_counts run0_committed;
-  run0_committed.add_to(spill_layer_hash, 3);
+  run0_committed.add_to(spill_layer, 3);
   job_gate->roll_up_child(run0_committed);
 
   // Simulate run 1 rolling up with 5 spills.
   data_cell_counts run1_committed;
-  run1_committed.add_to(spill_layer_hash, 5);
+  run1_committed.add_to(spill_layer, 5);
   job_gate->roll_up_child(run1_committed);
 
   REQUIRE(job_gate->all_children_accounted());
-  CHECK(job_gate->committed_count_for_layer(spill_layer_hash) == 8);
-  CHECK(job_gate->committed_count_for_layer(run_layer_hash) == 2);
+  CHECK(job_gate->committed_count_for_layer(spill_layer) == 8);
+  CHECK(job_gate->committed_count_for_layer(run_layer) == 2);
+}
+
+TEST_CASE("data_cell_counts: layers beyond the inline capacity", "[flush_gate]")
+{
+  constexpr std::size_t n_layers = data_cell_counts::inline_capacity * 3;
+  constexpr std::size_t n_increments = 1000;
+
+  auto job = data_cell_index::job();
+  std::vector<layer_id_t> layers;
+  for (std::size_t const i : std::views::iota(0uz, n_layers)) {
+    layers.push_back(job->make_child("layer_" + std::to_string(i), 0)->layer_id());
+  }
+
+  // Each layer is incremented concurrently from many tasks, so that slot claiming and overflow
+  // allocation race against each other.
+  data_cell_counts counts;
+  tbb::parallel_for(0uz, n_layers * n_increments, [&](std::size_t i) {
+    counts.increment(layers[i % n_layers]);
+  });
+
+  CHECK(counts.size() == n_layers);
+  for (auto const layer : layers) {
+    CHECK(counts.count(layer) == n_increments);
+  }
+  CHECK(counts.count(job->layer_id()) == 0);
+
+  std::size_t n_seen{};
+  for (auto const& [layer, count] : counts) {
+    CHECK(std::ranges::contains(layers, layer));
+    CHECK(count == n_increments);
+    ++n_seen;
+  }
+  CHECK(n_seen == n_layers);
+}
+
+TEST_CASE("flush_gate: one million data cells", "[flush_gate][scale]")
+{
+  // job -> 1000 runs -> 1000 spills per run -> 1 event per spill.  Spills are non-lowest, so
+  // each of the one million spill gates rolls its committed counts up into its run gate.  The
+  // spill gates are created and flushed one after the other, as they would be in a real job.
+  constexpr std::size_t n_runs = 1000;
+  constexpr std::size_t n_spills = 1000;
+
+  auto job = data_cell_index::job();
+  auto run0 = job->make_child("run", 0);
+  auto spill0 = run0->make_child("spill", 0);
+  auto const run_layer = run0->layer_id();
+  auto const spill_layer = spill0->layer_id();
+  auto const event_layer = spill0->make_child("event", 0)->layer_id();
+
+  gates_t gates;
+  auto job_gate = make_gate(job, 0);
+  job_gate->expect_child_rollups(n_runs);
+  job_gate->update_expected_count(run_layer, n_runs);
+  gates.emplace(job->hash(), job_gate);
+
+  std::vector<data_cell_index_ptr> runs;
+  runs.reserve(n_runs);
+  for (std::size_t const r : std::views::iota(0uz, n_runs)) {
+    auto& run_index = runs.emplace_back(job->make_child("run", r));
+    auto run_gate = make_gate(run_index, 0);
+    run_gate->expect_child_rollups(n_spills);
+    run_gate->update_expected_count(spill_layer, n_spills);
+    gates.emplace(run_index->hash(), run_gate);
+  }
+
+  std::atomic<std::size_t> n_flushed{};
+  tbb::parallel_for(0uz, n_runs, [&](std::size_t r) {
+    for (std::size_t const s : std::views::iota(0uz, n_spills)) {
+      auto spill = runs[r]->make_child("spill", s);
+      auto spill_gate = make_gate(spill, 0);
+      spill_gate->update_expected_count(event_layer, 1);
+      gates.emplace(spill->hash(), spill_gate);
+
+      // Only the number of flushed gates is retained so that the gates can be released.
+      flushed_t flushed;
+      flush_if_done(spill, gates, flushed);
+      n_flushed += flushed.size();
+    }
+  });
+
+  CHECK(n_flushed == n_runs * n_spills + n_runs + 1);
+  CHECK(job_gate->committed_count_for_layer(run_layer) == n_runs);
+  CHECK(job_gate->committed_count_for_layer(spill_layer) == n_runs * n_spills);
+  CHECK(job_gate->committed_count_for_layer(event_layer) == n_runs * n_spills);
+  CHECK(gates.empty());
+}
+
+TEST_CASE("data_cell_counts: allocations for one million parent cells", "[flush_gate][scale]")
+{
+  // Mirrors the data_cell_tracker/flush_gate life cycle of a parent cell's counts (creation,
+  // per-child increments, and a roll-up into the grandparent's counts), tallying the bytes
+  // allocated by data_cell_counts and by the map-based representation it replaced.
+  constexpr std::size_t n_cells = 1'000'000;
+
+  auto job = data_cell_index::job();
+  auto const spill_layer = job->make_child("run", 0)->make_child("spill", 0)->layer_id();
+
+  std::size_t counts_bytes{};
+  {
+    counting_allocator<data_cell_counts> const allocator{&counts_bytes};
+    auto rolled_up = std::allocate_shared<data_cell_counts>(allocator);
+    for (std::size_t i = 0; i != n_cells; ++i) {
+      auto counts = std::allocate_shared<data_cell_counts>(allocator);
+      counts->increment(spill_layer);
+      counts->increment(spill_layer);
+      for (auto const& [layer, count] : *counts) {
+        rolled_up->add_to(layer, count);
+      }
+    }
+    CHECK(rolled_up->count(spill_layer) == 2 * n_cells);
+  }
+
+  std::size_t map_bytes{};
+  {
+    using value_t = std::pair<layer_id_t const, std::atomic<std::size_t>>;
+    using map_t = tbb::concurrent_unordered_map<layer_id_t,
+                                                std::atomic<std::size_t>,
+                                                std::hash<layer_id_t>,
+                                                std::equal_to<layer_id_t>,
+                                                counting_allocator<value_t>>;
+    counting_allocator<value_t> const allocator{&map_bytes};
+    auto rolled_up = std::allocate_shared<map_t>(allocator, allocator);
+    for (std::size_t i = 0; i != n_cells; ++i) {
+      auto counts = std::allocate_shared<map_t>(allocator, allocator);
+      ++(*counts)[spill_layer];
+      ++(*counts)[spill_layer];
+      for (auto const& [layer, count] : *counts) {
+        (*rolled_up)[layer] += count.load();
+      }
+    }
+    CHECK((*rolled_up)[spill_layer].load() == 2 * n_cells);
+  }
+
+  // With a single child layer (the common case), data_cell_counts needs no allocation beyond
+  // the object itself, whereas each map also allocates its nodes and buckets.
+  CHECK(counts_bytes * 2 < map_bytes);
+}
+
+TEST_CASE("data_cell_counts: one million parent cells", "[.][benchmark][flush_gate]")
+{
+  // Times the life cycle whose allocations are tallied by the test above.
+  constexpr std::size_t n_cells = 1'000'000;
+
+  auto job = data_cell_index::job();
+  auto const spill_layer = job->make_child("run", 0)->make_child("spill", 0)->layer_id();
+
+  BENCHMARK("array-backed data_cell_counts")
+  {
+    data_cell_counts rolled_up;
+    for (std::size_t i = 0; i != n_cells; ++i) {
+      auto counts = std::make_shared<data_cell_counts>();
+      counts->increment(spill_layer);
+      counts->increment(spill_layer);
+      for (auto const& [layer, count] : *counts) {
+        rolled_up.add_to(layer, count);
+      }
+    }
+    return rolled_up.count(spill_layer);
+  };
+
+  BENCHMARK("map-backed counts (previous implementation)")
+  {
+    using map_t = tbb::concurrent_unordered_map<layer_id_t, std::atomic<std::size_t>>;
+    map_t rolled_up;
+    for (std::size_t i = 0; i != n_cells; ++i) {
+      auto counts = std::make_shared<map_t>();
+      ++(*counts)[spill_layer];
+      ++(*counts)[spill_layer];
+      for (auto const& [layer, count] : *counts) {
+        rolled_up[layer] += count.load();
+      }
+    }
+    return rolled_up[spill_layer].load();
+  };
 }
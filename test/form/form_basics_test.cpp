@@ -23,6 +23,14 @@
 #include "root_storage/root_rfield_write_container.hpp"
 #include "root_storage/root_rntuple_write_container.hpp"
 #endif
+#ifdef USE_HDF5_STORAGE
+#include "hdf5_storage/hdf5_read_container.hpp"
+#include "hdf5_storage/hdf5_write_container.hpp"
+#endif
+#ifdef USE_COLUMNAR_STORAGE
+#include "columnar_storage/columnar_read_container.hpp"
+#include "columnar_storage/columnar_write_container.hpp"
+#endif
 #include <catch2/catch_test_macros.hpp>
 
 #include <memory>
@@ -58,14 +66,13 @@ TEST_CASE("technology::Id string conversions", "[form]")
   // Round-trip the implemented backends through from_string / to_string
   CHECK(from_string("ROOT_TTREE") == ROOT_TTREE);
   CHECK(from_string("ROOT_RNTUPLE") == ROOT_RNTUPLE);
+  CHECK(from_string("HDF5") == HDF5);
+  CHECK(from_string("COLUMNAR") == COLUMNAR);
 
   CHECK(to_string(ROOT_TTREE) == "ROOT_TTREE");
   CHECK(to_string(ROOT_RNTUPLE) == "ROOT_RNTUPLE");
-  CHECK(to_string(HDF5) == "HDF5"); // reserved: still names itself for diagnostics
-
-  // HDF5 is reserved but unimplemented: reject it at parse time rather than
-  // silently falling back to a different storage.
-  CHECK_THROWS_AS(from_string("HDF5"), std::runtime_error);
+  CHECK(to_string(COLUMNAR) == "COLUMNAR");
+  CHECK(to_string(HDF5) == "HDF5");
 
   // An unknown name throws; an unknown Id stringifies to the sentinel
   CHECK_THROWS_AS(from_string("NOT_A_TECH"), std::runtime_error);
@@ -82,6 +89,7 @@ TEST_CASE("technology::Id members and ordering", "[form]")
   CHECK(ROOT_RNTUPLE.major == Major::root);
   CHECK(ROOT_RNTUPLE.minor == 2);
   CHECK(HDF5.major == Major::hdf5);
+  CHECK(COLUMNAR.major == Major::columnar);
   CHECK(Id{}.major == Major::generic);
 
   // operator<=> compares BOTH parts: same major, different minor stay distinct
@@ -185,13 +193,6 @@ TEST_CASE("Factories fallback", "[form]")
   auto wc = createWriteContainer(form::technology::Id{}, "cont");
   CHECK(dynamic_cast<Storage_Write_Container*>(wc.get()) != nullptr);
 
-  // HDF5 is reserved but unimplemented: every factory must fail loudly on the
-  // hdf5 dispatch branch rather than silently return generic storage.
-  CHECK_THROWS_AS(createFile(form::technology::HDF5, "test.h5", 'o'), std::runtime_error);
-  CHECK_THROWS_AS(createReadContainer(form::technology::HDF5, "cont"), std::runtime_error);
-  CHECK_THROWS_AS(createWriteAssociation(form::technology::HDF5, "assoc"), std::runtime_error);
-  CHECK_THROWS_AS(createWriteContainer(form::technology::HDF5, "cont"), std::runtime_error);
-
   // A major FORM doesn't recognize at all must also fail loudly
   // Major has a fixed underlying type, so an out-of-range value is legal at runtime
   auto const unknown_major =
@@ -247,6 +248,42 @@ TEST_CASE("Factories RNTuple storage dispatch", "[form]")
 #endif
 }
 
+TEST_CASE("Factories HDF5 storage dispatch", "[form]")
+{
+#ifdef USE_HDF5_STORAGE
+  auto rc = createReadContainer(form::technology::HDF5, "cont");
+  CHECK(dynamic_cast<HDF5_Read_ContainerImp*>(rc.get()) != nullptr);
+
+  auto wa = createWriteAssociation(form::technology::HDF5, "assoc");
+  CHECK(dynamic_cast<Storage_Write_Association*>(wa.get()) != nullptr);
+
+  auto wc = createWriteContainer(form::technology::HDF5, "cont");
+  CHECK(dynamic_cast<HDF5_Write_ContainerImp*>(wc.get()) != nullptr);
+#else
+  // Without HDF5 support every factory must fail loudly on the hdf5 dispatch branch rather than
+  // silently return generic storage.
+  CHECK_THROWS_AS(createFile(form::technology::HDF5, "test.h5", 'o'), std::runtime_error);
+  CHECK_THROWS_AS(createReadContainer(form::technology::HDF5, "cont"), std::runtime_error);
+  CHECK_THROWS_AS(createWriteAssociation(form::technology::HDF5, "assoc"), std::runtime_error);
+  CHECK_THROWS_AS(createWriteContainer(form::technology::HDF5, "cont"), std::runtime_error);
+#endif
+}
+
+TEST_CASE("Factories columnar storage dispatch", "[form]")
+{
+#ifdef USE_COLUMNAR_STORAGE
+  auto rc = createReadContainer(form::technology::COLUMNAR, "cont");
+  CHECK(dynamic_cast<Columnar_Read_ContainerImp*>(rc.get()) != nullptr);
+
+  auto wc = createWriteContainer(form::technology::COLUMNAR, "cont");
+  CHECK(dynamic_cast<Columnar_Write_ContainerImp*>(wc.get()) != nullptr);
+#else
+  CHECK_THROWS_AS(createFile(form::technology::COLUMNAR, "test.form", 'o'), std::runtime_error);
+  CHECK_THROWS_AS(createReadContainer(form::technology::COLUMNAR, "cont"), std::runtime_error);
+  CHECK_THROWS_AS(createWriteContainer(form::technology::COLUMNAR, "cont"), std::runtime_error);
+#endif
+}
+
 TEST_CASE("StorageReader basic operations", "[form]")
 {
   auto storage = createStorageReader();
@@ -430,6 +467,19 @@ TEST_CASE("form_reader_interface::read throws for missing product config", "[for
   CHECK_THROWS_AS(reader.read("creator", "segment", product), std::runtime_error);
 }
 
+TEST_CASE("form_reader_interface::readBulk throws for missing product config", "[form]")
+{
+  using namespace form::experimental::config;
+
+  ItemConfig cfg;
+  cfg.addItem("prod", "dummy_reader_test.root", form::technology::Id{});
+  form::experimental::form_reader_interface reader{cfg, tech_setting_config{}};
+
+  int buffer[4]{};
+  CHECK_THROWS_AS(reader.readBulk("creator", "missing", "segment", 4, buffer, typeid(int)),
+                  std::runtime_error);
+}
+
 TEST_CASE("form_writer_interface handles missing product config without crashing", "[form]")
 {
   using namespace form::experimental::config;
@@ -455,6 +505,24 @@ TEST_CASE("form_source_type_registry product_from_data_fn throws on null data",
   CHECK_THROWS_AS(entry->product_from_data_fn(nullptr, "prod", "[]"), std::runtime_error);
 }
 
+TEST_CASE("FORM source registry: fundamental types may be read in bulk", "[form]")
+{
+  using namespace form::experimental;
+
+  auto const* scalar = find_form_product_type("double");
+  REQUIRE(scalar != nullptr);
+  CHECK(scalar->bulk_value_size == sizeof(double));
+  REQUIRE(scalar->product_from_value_fn != nullptr);
+  double const value = 2.5;
+  auto const product = scalar->product_from_value_fn(&value);
+  REQUIRE(product != nullptr);
+  CHECK(*static_cast<double const*>(product->address()) == value);
+
+  auto const* vector = find_form_product_type("std::vector<double>");
+  REQUIRE(vector != nullptr);
+  CHECK(vector->bulk_value_size == 0);
+}
+
 TEST_CASE("FORM source registry: unregistered type returns nullptr", "[form]")
 {
   // find_form_product_type_name returns nullptr for a type never registered.
@@ -488,6 +556,20 @@ TEST_CASE("FORM source registry: registration error paths", "[form]")
       std::runtime_error);
   }
 
+  SECTION("bulk value size without a bulk conversion function throws")
+  {
+    CHECK_THROWS_AS(
+      form::experimental::register_form_product_type(
+        "some_new_bulk_type_for_error_test",
+        make_type_id<float>(),
+        typeid(float),
+        [](void const*, std::string const&, std::string const&) -> phlex::detail::product_ptr {
+          return nullptr;
+        },
+        sizeof(float)),
+      std::runtime_error);
+  }
+
   SECTION("null conversion function throws")
   {
     CHECK_THROWS_AS(form::experimental::register_form_product_type(
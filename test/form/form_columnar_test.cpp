@@ -0,0 +1,379 @@
+//Tests for FORM's memory-mapped columnar storage
+
+#include "form/config.hpp"
+#include "persistence/persistence_reader.hpp"
+#include "persistence/persistence_writer.hpp"
+#include "storage/factories.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace form::detail::experimental;
+
+namespace {
+  auto const technology = form::technology::COLUMNAR;
+
+  template <typename T>
+  std::unique_ptr<T const> readRow(IStorage_Read_Container& container, int row)
+  {
+    void const* raw = nullptr;
+    if (!container.read(row, &raw, typeid(T))) {
+      return nullptr;
+    }
+    return std::unique_ptr<T const>(static_cast<T const*>(raw));
+  }
+
+  // Row i holds {i, i+1, ..., 2i - 1}, so rows have different lengths (row 0 is empty).
+  std::vector<double> vectorRow(int i)
+  {
+    std::vector<double> result(static_cast<std::size_t>(i));
+    std::iota(result.begin(), result.end(), static_cast<double>(i));
+    return result;
+  }
+
+  void writeColumns(std::string const& file_name, int rows, std::string const& page_size)
+  {
+    auto file = createFile(technology, file_name, 'o');
+    auto numbers = createWriteContainer(technology, "tree/numbers");
+    auto vectors = createWriteContainer(technology, "tree/vectors");
+    auto strings = createWriteContainer(technology, "tree/strings");
+    for (auto const& container : {numbers, vectors, strings}) {
+      container->setAttribute("page_size", page_size);
+      container->setFile(file);
+    }
+    numbers->setupWrite(typeid(int));
+    vectors->setupWrite(typeid(std::vector<double>));
+    strings->setupWrite(typeid(std::string));
+
+    for (int i = 0; i != rows; ++i) {
+      auto const vector = vectorRow(i);
+      auto const string = "[event:" + std::to_string(i) + "]";
+      CHECK(numbers->fill(&i) == static_cast<std::uint64_t>(i));
+      CHECK(vectors->fill(&vector) == static_cast<std::uint64_t>(i));
+      CHECK(strings->fill(&string) == static_cast<std::uint64_t>(i));
+    }
+  }
+}
+
+TEST_CASE("Columnar storage round-trips fixed and variable width columns", "[form]")
+{
+  std::string const file_name = "columnar_round_trip.form";
+  int const rows = 500;
+
+  // A tiny page size spreads each column over many pages.
+  auto const page_size = GENERATE(as<std::string>{}, "64", "1048576");
+  writeColumns(file_name, rows, page_size);
+
+  auto file = createFile(technology, file_name, 'i');
+  auto numbers = createReadContainer(technology, "tree/numbers");
+  auto vectors = createReadContainer(technology, "tree/vectors");
+  auto strings = createReadContainer(technology, "tree/strings");
+  for (auto const& container : {numbers, vectors, strings}) {
+    container->setFile(file);
+    CHECK(container->entries() == rows);
+  }
+  CHECK_NOTHROW(numbers->prime(typeid(int)));
+
+  for (int i = 0; i != rows; ++i) {
+    auto const number = readRow<int>(*numbers, i);
+    REQUIRE(number != nullptr);
+    CHECK(*number == i);
+
+    auto const vector = readRow<std::vector<double>>(*vectors, i);
+    REQUIRE(vector != nullptr);
+    CHECK(*vector == vectorRow(i));
+
+    auto const string = readRow<std::string>(*strings, i);
+    REQUIRE(string != nullptr);
+    CHECK(*string == "[event:" + std::to_string(i) + "]");
+  }
+
+  CHECK(readRow<int>(*numbers, rows) == nullptr);
+  CHECK(readRow<int>(*numbers, -1) == nullptr);
+}
+
+TEST_CASE("Columnar storage error handling", "[form]")
+{
+  std::string const file_name = "columnar_errors.form";
+  writeColumns(file_name, 3, "1048576");
+
+  SECTION("Unsupported types are rejected when writing")
+  {
+    struct LocalType {
+      int value;
+    };
+    auto file = createFile(technology, "columnar_unsupported.form", 'o');
+    auto container = createWriteContainer(technology, "tree/local");
+    container->setFile(file);
+    CHECK_THROWS_AS(container->setupWrite(typeid(LocalType)), std::runtime_error);
+    CHECK_THROWS_AS(container->setupWrite(typeid(std::vector<bool>)), std::runtime_error);
+  }
+
+  SECTION("Reading with the wrong type throws")
+  {
+    auto file = createFile(technology, file_name, 'i');
+    auto container = createReadContainer(technology, "tree/numbers");
+    container->setFile(file);
+    void const* raw = nullptr;
+    CHECK_THROWS_AS(container->read(0, &raw, typeid(double)), std::runtime_error);
+    CHECK_THROWS_AS(container->prime(typeid(long)), std::runtime_error);
+  }
+
+  SECTION("A missing column throws when used")
+  {
+    auto file = createFile(technology, file_name, 'i');
+    auto container = createReadContainer(technology, "tree/absent");
+    container->setFile(file);
+    CHECK_THROWS_AS(container->entries(), container_not_found);
+    CHECK_THROWS_AS(readRow<int>(*container, 0), container_not_found);
+  }
+
+  SECTION("Incomplete files are rejected")
+  {
+    std::filesystem::copy_file(file_name,
+                               "columnar_truncated.form",
+                               std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::resize_file("columnar_truncated.form",
+                                 std::filesystem::file_size(file_name) - 1);
+    CHECK_THROWS_AS(createFile(technology, "columnar_truncated.form", 'i'), std::runtime_error);
+    CHECK_THROWS_AS(createFile(technology, "columnar_missing.form", 'i'), std::runtime_error);
+  }
+
+  SECTION("Containers only attach to columnar files")
+  {
+    auto container = createReadContainer(technology, "tree/numbers");
+    CHECK_THROWS_AS(container->setFile(createFile(form::technology::Id{}, file_name, 'i')),
+                    std::runtime_error);
+  }
+}
+
+TEST_CASE("Columnar storage bulk reads of fundamental columns", "[form]")
+{
+  std::string const file_name = "columnar_bulk.form";
+  int const rows = 500;
+  // 16 ints per page, so most bulk reads span several pages
+  writeColumns(file_name, rows, "64");
+
+  auto file = createFile(technology, file_name, 'i');
+  auto numbers = createReadContainer(technology, "tree/numbers");
+  numbers->setFile(file);
+
+  std::vector<int> buffer(100, -1);
+  CHECK(numbers->readBulk(10, 100, buffer.data(), typeid(int)) == 100);
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 10);
+  CHECK(buffer == expected);
+
+  // Reads are clipped at the end of the column
+  CHECK(numbers->readBulk(rows - 10, 100, buffer.data(), typeid(int)) == 10);
+  CHECK(buffer.front() == rows - 10);
+  CHECK(buffer[9] == rows - 1);
+  CHECK(numbers->readBulk(rows, 100, buffer.data(), typeid(int)) == 0);
+
+  CHECK_THROWS_AS(numbers->readBulk(0, 1, buffer.data(), typeid(long)), std::runtime_error);
+  auto vectors = createReadContainer(technology, "tree/vectors");
+  vectors->setFile(file);
+  CHECK_THROWS_AS(vectors->readBulk(0, 1, buffer.data(), typeid(std::vector<double>)),
+                  std::runtime_error);
+}
+
+TEST_CASE("Columnar storage reads may be issued concurrently", "[form]")
+{
+  std::string const file_name = "columnar_concurrent.form";
+  int const rows = 1000;
+  writeColumns(file_name, rows, "256");
+
+  auto file = createFile(technology, file_name, 'i');
+  auto vectors = createReadContainer(technology, "tree/vectors");
+  vectors->setFile(file);
+
+  std::atomic<int> mismatches{};
+  {
+    std::vector<std::jthread> workers;
+    for (int t = 0; t != 8; ++t) {
+      workers.emplace_back([&vectors, &mismatches, t] {
+        for (int i = t; i < rows; i += 8) {
+          auto const vector = readRow<std::vector<double>>(*vectors, i);
+          if (vector == nullptr || *vector != vectorRow(i)) {
+            ++mismatches;
+          }
+        }
+      });
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("Persistence round-trip with columnar storage", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name = "columnar_persistence.form";
+  std::string const creator = "columnar_creator";
+
+  ItemConfig cfg;
+  cfg.addItem("hits", file_name, technology);
+  cfg.addItem("energy", file_name, technology);
+
+  {
+    auto writer = createPersistenceWriter();
+    writer->configure(cfg);
+    writer->configureTechSettings(tech_setting_config{});
+    writer->createContainers(creator,
+                             {{"hits", &typeid(std::vector<int>)}, {"energy", &typeid(double)}});
+    for (int i = 0; i != 10; ++i) {
+      std::vector<int> const hits(static_cast<std::size_t>(i), i);
+      double const energy = 1.5 * i;
+      writer->registerWrite(creator, "hits", &hits, typeid(std::vector<int>));
+      writer->registerWrite(creator, "energy", &energy, typeid(double));
+      writer->commitOutput(creator, "[event:" + std::to_string(i) + "]");
+    }
+  }
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(tech_setting_config{});
+  CHECK(reader->listIndices(creator, "hits").size() == 10);
+
+  // Read in a different order from the one written
+  for (int i = 9; i >= 0; --i) {
+    auto const id = "[event:" + std::to_string(i) + "]";
+    void const* raw = nullptr;
+    reader->read(creator, "hits", id, &raw, typeid(std::vector<int>));
+    std::unique_ptr<std::vector<int> const> const hits(static_cast<std::vector<int> const*>(raw));
+    REQUIRE(hits != nullptr);
+    CHECK(*hits == std::vector<int>(static_cast<std::size_t>(i), i));
+
+    reader->read(creator, "energy", id, &raw, typeid(double));
+    std::unique_ptr<double const> const energy(static_cast<double const*>(raw));
+    REQUIRE(energy != nullptr);
+    CHECK(*energy == 1.5 * i);
+  }
+}
+
+TEST_CASE("Persistence bulk reads with columnar storage", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name = "columnar_persistence_bulk.form";
+  std::string const creator = "columnar_creator";
+
+  ItemConfig cfg;
+  cfg.addItem("energy", file_name, technology);
+
+  {
+    auto writer = createPersistenceWriter();
+    writer->configure(cfg);
+    writer->configureTechSettings(tech_setting_config{});
+    writer->createContainers(creator, {{"energy", &typeid(double)}});
+    for (int i = 0; i != 10; ++i) {
+      double const energy = 1.5 * i;
+      writer->registerWrite(creator, "energy", &energy, typeid(double));
+      writer->commitOutput(creator, "[event:" + std::to_string(i) + "]");
+    }
+  }
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(tech_setting_config{});
+  std::vector<double> energies(8);
+  REQUIRE(reader->readBulk(creator, "energy", "[event:3]", 8, energies.data(), typeid(double)) ==
+          7);
+  for (int i = 0; i != 7; ++i) {
+    CHECK(energies[i] == 1.5 * (i + 3));
+  }
+}
+
+TEST_CASE("Index cells with columnar storage", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name = "columnar_index_cells.form";
+  std::string const creator = "columnar_creator";
+
+  ItemConfig cfg;
+  cfg.addItem("energy", file_name, technology);
+
+  {
+    auto writer = createPersistenceWriter();
+    writer->configure(cfg);
+    writer->configureTechSettings(tech_setting_config{});
+    writer->createContainers(creator, {{"energy", &typeid(double)}});
+    for (int run = 1; run != 3; ++run) {
+      for (int event = 0; event != 3; ++event) {
+        double const energy = 10.0 * run + event;
+        writer->registerWrite(creator, "energy", &energy, typeid(double));
+        writer->commitOutput(creator,
+                             "[run:" + std::to_string(run) + ", event:" + std::to_string(event) +
+                               "]");
+      }
+    }
+    double const energy = -1.0;
+    writer->registerWrite(creator, "energy", &energy, typeid(double));
+    writer->commitOutput(creator, "not-a-cell");
+  }
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(tech_setting_config{});
+
+  auto const cells = reader->listIndexCells(creator, "energy");
+  REQUIRE(cells.size() == 7);
+  for (std::size_t row = 0; row != 6; ++row) {
+    REQUIRE(cells[row].layers != nullptr);
+    CHECK(*cells[row].layers == std::vector<std::string>{"run", "event"});
+    // Cells with the same layers share them
+    CHECK(cells[row].layers == cells.front().layers);
+    CHECK(cells[row].numbers == std::vector<std::uint64_t>{row / 3 + 1, row % 3});
+  }
+  CHECK(cells.back().layers == nullptr);
+
+  // Structured ids are found through their cells, however they are spelled
+  void const* raw = nullptr;
+  reader->read(creator, "energy", "[EVENT=2; Run=2]", &raw, typeid(double));
+  std::unique_ptr<double const> const energy(static_cast<double const*>(raw));
+  REQUIRE(energy != nullptr);
+  CHECK(*energy == 22.0);
+  CHECK_THROWS_AS(reader->read(creator, "energy", "[run:3, event:0]", &raw, typeid(double)),
+                  std::runtime_error);
+}
+
+TEST_CASE("Columnar storage throughput", "[.][benchmark]")
+{
+  std::string const file_name = "columnar_benchmark.form";
+  int const rows = 100'000;
+  std::vector<double> const payload(100, 1.0);
+
+  BENCHMARK("write 100k rows of 100 doubles")
+  {
+    auto file = createFile(technology, file_name, 'o');
+    auto container = createWriteContainer(technology, "tree/payload");
+    container->setFile(file);
+    container->setupWrite(typeid(std::vector<double>));
+    for (int i = 0; i != rows; ++i) {
+      container->fill(&payload);
+    }
+  };
+
+  BENCHMARK("read 100k rows of 100 doubles")
+  {
+    auto file = createFile(technology, file_name, 'i');
+    auto container = createReadContainer(technology, "tree/payload");
+    container->setFile(file);
+    std::size_t total = 0;
+    for (int i = 0; i != rows; ++i) {
+      total += readRow<std::vector<double>>(*container, i)->size();
+    }
+    return total;
+  };
+}
@@ -0,0 +1,371 @@
+//Tests for FORM's HDF5 storage
+
+#include "form/config.hpp"
+#include "persistence/persistence_reader.hpp"
+#include "persistence/persistence_writer.hpp"
+#include "storage/factories.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace form::detail::experimental;
+
+namespace {
+  auto const technology = form::technology::HDF5;
+
+  template <typename T>
+  std::unique_ptr<T const> readRow(IStorage_Read_Container& container, int row)
+  {
+    void const* raw = nullptr;
+    if (!container.read(row, &raw, typeid(T))) {
+      return nullptr;
+    }
+    return std::unique_ptr<T const>(static_cast<T const*>(raw));
+  }
+
+  // Row i holds {i, i+1, ..., 2i - 1}, so rows have different lengths (row 0 is empty).
+  std::vector<double> vectorRow(int i)
+  {
+    std::vector<double> result(static_cast<std::size_t>(i));
+    std::iota(result.begin(), result.end(), static_cast<double>(i));
+    return result;
+  }
+
+  using attributes_t = std::vector<std::pair<std::string, std::string>>;
+
+  void writeContainers(std::string const& file_name, int rows, attributes_t const& attributes)
+  {
+    auto file = createFile(technology, file_name, 'o');
+    auto numbers = createWriteContainer(technology, "tree/numbers");
+    auto vectors = createWriteContainer(technology, "tree/vectors");
+    auto strings = createWriteContainer(technology, "tree/strings");
+    for (auto const& container : {numbers, vectors, strings}) {
+      for (auto const& [key, value] : attributes) {
+        container->setAttribute(key, value);
+      }
+      container->setFile(file);
+    }
+    numbers->setupWrite(typeid(int));
+    vectors->setupWrite(typeid(std::vector<double>));
+    strings->setupWrite(typeid(std::string));
+
+    for (int i = 0; i != rows; ++i) {
+      auto const vector = vectorRow(i);
+      auto const string = "[event:" + std::to_string(i) + "]";
+      CHECK(numbers->fill(&i) == static_cast<std::uint64_t>(i));
+      CHECK(vectors->fill(&vector) == static_cast<std::uint64_t>(i));
+      CHECK(strings->fill(&string) == static_cast<std::uint64_t>(i));
+    }
+  }
+}
+
+TEST_CASE("HDF5 storage round-trips fixed and variable width containers", "[form]")
+{
+  std::string const file_name = "hdf5_round_trip.h5";
+  int const rows = 500;
+
+  // Small chunks spread each dataset over many chunks, and blocks of reads over several chunks.
+  auto const attributes = GENERATE(attributes_t{},
+                                   attributes_t{{"chunk_rows", "7"}, {"chunk_elements", "64"}},
+                                   attributes_t{{"chunk_rows", "64"}, {"compression", "6"}});
+  writeContainers(file_name, rows, attributes);
+
+  auto file = createFile(technology, file_name, 'i');
+  auto numbers = createReadContainer(technology, "tree/numbers");
+  auto vectors = createReadContainer(technology, "tree/vectors");
+  auto strings = createReadContainer(technology, "tree/strings");
+  for (auto const& container : {numbers, vectors, strings}) {
+    container->setFile(file);
+    CHECK(container->entries() == rows);
+  }
+  strings->setAttribute("read_rows", "3");
+  CHECK_NOTHROW(numbers->prime(typeid(int)));
+
+  for (int i = 0; i != rows; ++i) {
+    auto const number = readRow<int>(*numbers, i);
+    REQUIRE(number != nullptr);
+    CHECK(*number == i);
+
+    auto const vector = readRow<std::vector<double>>(*vectors, i);
+    REQUIRE(vector != nullptr);
+    CHECK(*vector == vectorRow(i));
+
+    auto const string = readRow<std::string>(*strings, i);
+    REQUIRE(string != nullptr);
+    CHECK(*string == "[event:" + std::to_string(i) + "]");
+  }
+
+  // Reading backwards reloads a block for every chunk
+  for (int i = rows - 1; i >= 0; i -= 13) {
+    CHECK(*readRow<std::vector<double>>(*vectors, i) == vectorRow(i));
+  }
+
+  CHECK(readRow<int>(*numbers, rows) == nullptr);
+  CHECK(readRow<int>(*numbers, -1) == nullptr);
+}
+
+TEST_CASE("HDF5 storage writes buffered rows when flushed", "[form]")
+{
+  std::string const file_name = "hdf5_flush.h5";
+  auto file = createFile(technology, file_name, 'o');
+  auto numbers = createWriteContainer(technology, "tree/numbers");
+  numbers->setFile(file);
+  numbers->setupWrite(typeid(int));
+
+  // A second handle on the file sees what has been written so far
+  auto const written = [&file_name] {
+    auto container = createReadContainer(technology, "tree/numbers");
+    container->setFile(createFile(technology, file_name, 'i'));
+    return container;
+  };
+
+  for (int i = 0; i != 5; ++i) {
+    numbers->fill(&i);
+  }
+  // Committed rows stay buffered until a chunk is full
+  numbers->commit();
+  CHECK(written()->entries() == 0);
+  numbers->flush();
+  CHECK(written()->entries() == 5);
+
+  int const extra = 5;
+  numbers->fill(&extra);
+  numbers->commit();
+  CHECK(written()->entries() == 5);
+  numbers->flush();
+  auto const container = written();
+  CHECK(container->entries() == 6);
+  CHECK(*readRow<int>(*container, 5) == extra);
+}
+
+TEST_CASE("HDF5 storage error handling", "[form]")
+{
+  std::string const file_name = "hdf5_errors.h5";
+  writeContainers(file_name, 3, {});
+
+  SECTION("Unsupported types and settings are rejected when writing")
+  {
+    struct LocalType {
+      int value;
+    };
+    auto file = createFile(technology, "hdf5_unsupported.h5", 'o');
+    auto container = createWriteContainer(technology, "tree/local");
+    CHECK_THROWS_AS(container->setAttribute("chunk_rows", "0"), std::runtime_error);
+    CHECK_THROWS_AS(container->setAttribute("compression", "10"), std::runtime_error);
+    CHECK_THROWS_AS(container->setAttribute("page_size", "64"), std::runtime_error);
+    container->setFile(file);
+    CHECK_THROWS_AS(container->setupWrite(typeid(LocalType)), std::runtime_error);
+    CHECK_THROWS_AS(container->setupWrite(typeid(std::vector<bool>)), std::runtime_error);
+
+    // A container name can only be used once per file
+    auto first = createWriteContainer(technology, "tree/twice");
+    auto second = createWriteContainer(technology, "tree/twice");
+    first->setFile(file);
+    second->setFile(file);
+    first->setupWrite(typeid(int));
+    CHECK_THROWS_AS(second->setupWrite(typeid(int)), std::runtime_error);
+  }
+
+  SECTION("Reading with the wrong type throws")
+  {
+    auto file = createFile(technology, file_name, 'i');
+    auto container = createReadContainer(technology, "tree/numbers");
+    container->setFile(file);
+    void const* raw = nullptr;
+    CHECK_THROWS_AS(container->read(0, &raw, typeid(double)), std::runtime_error);
+    CHECK_THROWS_AS(container->prime(typeid(long)), std::runtime_error);
+  }
+
+  SECTION("A missing container throws when used")
+  {
+    auto file = createFile(technology, file_name, 'i');
+    for (auto const* name : {"tree/absent", "absent/numbers", "tree/numbers/absent"}) {
+      auto container = createReadContainer(technology, name);
+      container->setFile(file);
+      CHECK_THROWS_AS(container->entries(), std::runtime_error);
+      CHECK_THROWS_AS(readRow<int>(*container, 0), std::runtime_error);
+    }
+  }
+
+  SECTION("Files that are not HDF5 files are rejected")
+  {
+    CHECK_THROWS_AS(createFile(technology, "hdf5_missing.h5", 'i'), std::runtime_error);
+  }
+
+  SECTION("Containers only attach to HDF5 files")
+  {
+    auto container = createReadContainer(technology, "tree/numbers");
+    CHECK_THROWS_AS(container->setFile(createFile(form::technology::Id{}, file_name, 'i')),
+                    std::runtime_error);
+  }
+}
+
+TEST_CASE("HDF5 storage bulk reads of fundamental containers", "[form]")
+{
+  std::string const file_name = "hdf5_bulk.h5";
+  int const rows = 500;
+  writeContainers(file_name, rows, {{"chunk_rows", "7"}});
+
+  auto file = createFile(technology, file_name, 'i');
+  auto numbers = createReadContainer(technology, "tree/numbers");
+  numbers->setFile(file);
+
+  std::vector<int> buffer(100, -1);
+  CHECK(numbers->readBulk(10, 100, buffer.data(), typeid(int)) == 100);
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 10);
+  CHECK(buffer == expected);
+
+  // Reads are clipped at the end of the dataset
+  CHECK(numbers->readBulk(rows - 10, 100, buffer.data(), typeid(int)) == 10);
+  CHECK(buffer.front() == rows - 10);
+  CHECK(buffer[9] == rows - 1);
+  CHECK(numbers->readBulk(rows, 100, buffer.data(), typeid(int)) == 0);
+
+  CHECK_THROWS_AS(numbers->readBulk(0, 1, buffer.data(), typeid(long)), std::runtime_error);
+  auto vectors = createReadContainer(technology, "tree/vectors");
+  vectors->setFile(file);
+  CHECK_THROWS_AS(vectors->readBulk(0, 1, buffer.data(), typeid(std::vector<double>)),
+                  std::runtime_error);
+}
+
+TEST_CASE("HDF5 storage reads may be issued concurrently", "[form]")
+{
+  std::string const file_name = "hdf5_concurrent.h5";
+  int const rows = 1000;
+  writeContainers(file_name, rows, {{"chunk_rows", "32"}});
+
+  auto file = createFile(technology, file_name, 'i');
+  auto vectors = createReadContainer(technology, "tree/vectors");
+  vectors->setFile(file);
+
+  std::atomic<int> mismatches{};
+  {
+    std::vector<std::jthread> workers;
+    for (int t = 0; t != 8; ++t) {
+      workers.emplace_back([&vectors, &mismatches, t] {
+        for (int i = t; i < rows; i += 8) {
+          auto const vector = readRow<std::vector<double>>(*vectors, i);
+          if (vector == nullptr || *vector != vectorRow(i)) {
+            ++mismatches;
+          }
+        }
+      });
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("Persistence round-trip with HDF5 storage", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name = "hdf5_persistence.h5";
+  std::string const creator = "hdf5_creator";
+
+  ItemConfig cfg;
+  cfg.addItem("hits", file_name, technology);
+  cfg.addItem("energy", file_name, technology);
+
+  tech_setting_config settings;
+  settings.container_settings[technology][creator + "/hits"] = {{"chunk_rows", "4"},
+                                                                {"compression", "1"}};
+
+  // The writer is kept open: flushing must write the products, the index and its keys.
+  auto writer = createPersistenceWriter();
+  writer->configure(cfg);
+  writer->configureTechSettings(settings);
+  writer->createContainers(creator,
+                           {{"hits", &typeid(std::vector<int>)}, {"energy", &typeid(double)}});
+  for (int i = 0; i != 10; ++i) {
+    std::vector<int> const hits(static_cast<std::size_t>(i), i);
+    double const energy = 1.5 * i;
+    writer->registerWrite(creator, "hits", &hits, typeid(std::vector<int>));
+    writer->registerWrite(creator, "energy", &energy, typeid(double));
+    writer->commitOutput(creator, "[event:" + std::to_string(i) + "]");
+  }
+  writer->flushOutput();
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(tech_setting_config{});
+  CHECK(reader->listIndices(creator, "hits").size() == 10);
+
+  // Read in a different order from the one written
+  for (int i = 9; i >= 0; --i) {
+    auto const id = "[event:" + std::to_string(i) + "]";
+    void const* raw = nullptr;
+    reader->read(creator, "hits", id, &raw, typeid(std::vector<int>));
+    std::unique_ptr<std::vector<int> const> const hits(static_cast<std::vector<int> const*>(raw));
+    REQUIRE(hits != nullptr);
+    CHECK(*hits == std::vector<int>(static_cast<std::size_t>(i), i));
+
+    reader->read(creator, "energy", id, &raw, typeid(double));
+    std::unique_ptr<double const> const energy(static_cast<double const*>(raw));
+    REQUIRE(energy != nullptr);
+    CHECK(*energy == 1.5 * i);
+  }
+}
+
+TEST_CASE("HDF5 storage throughput compared with the other backends", "[.][benchmark]")
+{
+  using namespace form::experimental::config;
+
+  int const events = 20'000;
+  std::vector<double> const payload(100, 1.0);
+  std::string const creator = "benchmark";
+
+  std::vector<form::technology::Id> technologies{form::technology::HDF5};
+#ifdef USE_ROOT_STORAGE
+  technologies.push_back(form::technology::ROOT_TTREE);
+#endif
+#ifdef USE_RNTUPLE_STORAGE
+  technologies.push_back(form::technology::ROOT_RNTUPLE);
+#endif
+
+  for (auto const tech : technologies) {
+    auto const tech_name = form::technology::to_string(tech);
+    ItemConfig cfg;
+    cfg.addItem("payload", "hdf5_benchmark_" + tech_name + ".dat", tech);
+
+    BENCHMARK("write 20k events of 100 doubles: " + tech_name)
+    {
+      auto writer = createPersistenceWriter();
+      writer->configure(cfg);
+      writer->configureTechSettings(tech_setting_config{});
+      writer->createContainers(creator, {{"payload", &typeid(std::vector<double>)}});
+      for (int i = 0; i != events; ++i) {
+        writer->registerWrite(creator, "payload", &payload, typeid(std::vector<double>));
+        writer->commitOutput(creator, "[event:" + std::to_string(i) + "]");
+      }
+      writer->flushOutput();
+    };
+
+    BENCHMARK("read 20k events of 100 doubles: " + tech_name)
+    {
+      auto reader = createPersistenceReader();
+      reader->configure(cfg);
+      reader->configureTechSettings(tech_setting_config{});
+      std::size_t total = 0;
+      for (int i = 0; i != events; ++i) {
+        void const* raw = nullptr;
+        auto const id = "[event:" + std::to_string(i) + "]";
+        reader->read(creator, "payload", id, &raw, typeid(std::vector<double>));
+        std::unique_ptr<std::vector<double> const> const product(
+          static_cast<std::vector<double> const*>(raw));
+        total += product->size();
+      }
+      return total;
+    };
+  }
+}
@@ -0,0 +1,57 @@
+// Writes many small product stores through the FORM output module.  Comparing the
+// synchronous (queue_depth: 0) and asynchronous workflows shows how much of the event loop
+// is spent waiting on output; the parallel workflow writes one RNTuple from several threads.
+// The readback workflow checks what was written.
+local events = 20000;
+local driver = {
+  cpp: 'generate_layers',
+  layers: {
+    event: { total: events },
+  },
+};
+
+{
+  workflow(queue_depth, output_file, technology='ROOT_TTREE', write_concurrency=1):: {
+    driver: driver,
+    sources: {
+      provider: {
+        cpp: 'ij_source',
+      },
+    },
+    modules: {
+      add: {
+        cpp: 'module',
+      },
+      form_output: {
+        cpp: 'form_module',
+        output_file: output_file,
+        technology: technology,
+        queue_depth: queue_depth,
+        write_concurrency: write_concurrency,
+        products: ['sum', 'i', 'j'],
+      },
+    },
+  },
+
+  readback(input_file, technology='ROOT_TTREE'):: {
+    driver: driver,
+    sources: {
+      sums_from_form: {
+        cpp: 'form_source',
+        input_file: input_file,
+        technology: technology,
+        plugin: 'add',
+        algorithm: 'add',
+        creator: 'add',
+        products: ['sum'],
+      },
+    },
+    modules: {
+      verify: {
+        cpp: 'verify_sums',
+        input: { creator: 'add', layer: 'event', suffix: 'sum' },
+        expected: events,
+      },
+    },
+  },
+}
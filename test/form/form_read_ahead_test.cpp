@@ -0,0 +1,236 @@
+#include "form/read_ahead.hpp"
+
+#include "oneapi/tbb/task_arena.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using form::experimental::read_ahead;
+using phlex::detail::product_ptr;
+
+namespace {
+  // Data cells named after their layer and number, e.g. "e3" for event 3 and "r1" for run 1
+  std::vector<read_ahead::cell> cells(std::vector<std::string> const& names)
+  {
+    std::vector<read_ahead::cell> result;
+    for (auto const& name : names) {
+      result.push_back({name, name.front() == 'r' ? "run" : "event"});
+    }
+    return result;
+  }
+
+  int number_of(product_ptr const& product)
+  {
+    REQUIRE(product);
+    return static_cast<phlex::detail::product<int> const&>(*product).obj;
+  }
+
+  // Reads products holding the number of their data cell, and records the reads
+  class recording_reader {
+  public:
+    explicit recording_reader(std::vector<std::string> names) : m_names{std::move(names)} {}
+
+    read_ahead::list_function list() const
+    {
+      return [this] { return cells(m_names); };
+    }
+
+    read_ahead::read_function read()
+    {
+      return [this](std::string const& index) {
+        std::scoped_lock lock{m_mutex};
+        m_reads.push_back(index);
+        return make_product(index);
+      };
+    }
+
+    read_ahead::bulk_read_function read_bulk()
+    {
+      return [this](std::string const& first_index, std::size_t const count) {
+        std::scoped_lock lock{m_mutex};
+        m_bulk_sizes.push_back(count);
+        std::vector<product_ptr> result;
+        auto const first = std::ranges::find(m_names, first_index);
+        for (auto it = first; it != m_names.end() and result.size() != count; ++it) {
+          m_reads.push_back(*it);
+          result.push_back(make_product(*it));
+        }
+        return result;
+      };
+    }
+
+    // The order in which scheduled reads run is unspecified, so the records are sorted.
+    std::vector<std::string> reads()
+    {
+      std::scoped_lock lock{m_mutex};
+      auto result = m_reads;
+      std::ranges::sort(result);
+      return result;
+    }
+
+    std::vector<std::size_t> bulk_sizes()
+    {
+      std::scoped_lock lock{m_mutex};
+      auto result = m_bulk_sizes;
+      std::ranges::sort(result);
+      return result;
+    }
+
+  private:
+    static product_ptr make_product(std::string const& index)
+    {
+      return phlex::detail::product_for(std::stoi(index.substr(1)));
+    }
+
+    std::vector<std::string> const m_names;
+    std::mutex m_mutex;
+    std::vector<std::string> m_reads;
+    std::vector<std::size_t> m_bulk_sizes;
+  };
+
+  // With a single thread, scheduled reads only run when read_ahead::wait() is called.
+  template <typename F>
+  void run_single_threaded(F&& f)
+  {
+    tbb::task_arena arena{1};
+    arena.execute(std::forward<F>(f));
+  }
+}
+
+TEST_CASE("Read-ahead follows the file order of the product's layer", "[form]")
+{
+  run_single_threaded([] {
+    recording_reader reader{{"e0", "e1", "r1", "e2", "e3", "e4"}};
+    read_ahead prefetch{2, reader.list()};
+    prefetch.add_product("p", "event", reader.read());
+
+    CHECK_FALSE(prefetch.take("p", "e0"));
+    prefetch.wait();
+    // The window spans the next two data cells in the file, one of which is a run
+    CHECK(reader.reads() == std::vector<std::string>{"e1"});
+
+    CHECK(number_of(prefetch.take("p", "e1")) == 1);
+    prefetch.wait();
+    CHECK(reader.reads() == std::vector<std::string>{"e1", "e2"});
+
+    CHECK(number_of(prefetch.take("p", "e2")) == 2);
+    prefetch.wait();
+    CHECK(reader.reads() == std::vector<std::string>{"e1", "e2", "e3", "e4"});
+  });
+}
+
+TEST_CASE("Read-ahead keeps at most a window of reads outstanding", "[form]")
+{
+  run_single_threaded([] {
+    recording_reader reader{{"e0", "e1", "e2", "e3", "e4", "e5", "e6", "e7"}};
+    read_ahead prefetch{3, reader.list()};
+    prefetch.add_product("p", "event", reader.read());
+
+    CHECK_FALSE(prefetch.take("p", "e0"));
+    prefetch.wait();
+    CHECK(reader.reads() == std::vector<std::string>{"e1", "e2", "e3"});
+
+    // Nothing is taken, so nothing more is scheduled
+    CHECK_FALSE(prefetch.take("p", "e0"));
+    prefetch.wait();
+    CHECK(reader.reads().size() == 3);
+
+    // Taking one product makes room for one more read
+    CHECK(number_of(prefetch.take("p", "e1")) == 1);
+    prefetch.wait();
+    CHECK(reader.reads() == std::vector<std::string>{"e1", "e2", "e3", "e4"});
+  });
+}
+
+TEST_CASE("Read-ahead withdraws a read that has not started", "[form]")
+{
+  run_single_threaded([] {
+    recording_reader reader{{"e0", "e1", "e2", "e3", "e4", "e5"}};
+    read_ahead prefetch{3, reader.list()};
+    prefetch.add_product("p", "event", reader.read());
+
+    CHECK_FALSE(prefetch.take("p", "e0"));
+    // The read of e2 is scheduled but has not run: the caller reads the product itself.
+    CHECK_FALSE(prefetch.take("p", "e2"));
+    prefetch.wait();
+    CHECK(reader.reads() == std::vector<std::string>{"e1", "e3", "e4"});
+  });
+}
+
+TEST_CASE("Read-ahead waits for a read in flight instead of repeating it", "[form]")
+{
+  run_single_threaded([] {
+    recording_reader reader{{"e0", "e1"}};
+    read_ahead prefetch{1, reader.list()};
+
+    product_ptr taken;
+    std::jthread taker;
+    auto read = reader.read();
+    prefetch.add_product("p", "event", [&](std::string const& index) {
+      // Another provider asks for the product while it is being read.
+      taker = std::jthread{[&prefetch, &taken, index] { taken = prefetch.take("p", index); }};
+      return read(index);
+    });
+
+    CHECK_FALSE(prefetch.take("p", "e0"));
+    prefetch.wait();
+    taker.join();
+    CHECK(number_of(taken) == 1);
+    CHECK(reader.reads() == std::vector<std::string>{"e1"});
+  });
+}
+
+TEST_CASE("Read-ahead leaves a failed read to the provider", "[form]")
+{
+  run_single_threaded([] {
+    recording_reader reader{{"e0", "e1", "e2"}};
+    read_ahead prefetch{2, reader.list()};
+    auto read = reader.read();
+    prefetch.add_product("p", "event", [&](std::string const& index) {
+      if (index == "e1") {
+        throw std::runtime_error("unreadable");
+      }
+      return read(index);
+    });
+
+    CHECK_FALSE(prefetch.take("p", "e0"));
+    prefetch.wait();
+    CHECK_FALSE(prefetch.take("p", "e1"));
+    CHECK(number_of(prefetch.take("p", "e2")) == 2);
+  });
+}
+
+TEST_CASE("Read-ahead reads consecutive data cells in bulk", "[form]")
+{
+  run_single_threaded([] {
+    recording_reader reader{{"e0", "e1", "e2", "r1", "e3", "e4", "e5"}};
+    read_ahead prefetch{6, reader.list()};
+    prefetch.add_product("p", "event", reader.read(), reader.read_bulk());
+
+    SECTION("Runs of consecutive data cells")
+    {
+      CHECK_FALSE(prefetch.take("p", "e0"));
+      prefetch.wait();
+      // The run between e2 and e3 splits the reads
+      CHECK(reader.bulk_sizes() == std::vector<std::size_t>{2, 3});
+      for (int i = 1; i != 6; ++i) {
+        CHECK(number_of(prefetch.take("p", "e" + std::to_string(i))) == i);
+      }
+    }
+
+    SECTION("A withdrawn read splits a bulk read")
+    {
+      CHECK_FALSE(prefetch.take("p", "e0"));
+      CHECK_FALSE(prefetch.take("p", "e4"));
+      prefetch.wait();
+      CHECK(reader.bulk_sizes() == std::vector<std::size_t>{1, 1, 2});
+      CHECK(reader.reads() == std::vector<std::string>{"e1", "e2", "e3", "e5"});
+    }
+  });
+}
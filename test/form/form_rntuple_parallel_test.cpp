@@ -0,0 +1,133 @@
+//Tests for writing one RNTuple from several threads through per-thread fill contexts
+
+#include "form/config.hpp"
+#include "form/form_writer.hpp"
+#include "persistence/persistence_reader.hpp"
+#include "persistence/persistence_writer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace form::detail::experimental;
+
+namespace {
+  auto const technology = form::technology::ROOT_RNTUPLE;
+
+  std::string eventId(int thread, int event)
+  {
+    return "[thread:" + std::to_string(thread) + ", event:" + std::to_string(event) + "]";
+  }
+
+  form::experimental::config::tech_setting_config parallelSettings(std::string const& file_name)
+  {
+    form::experimental::config::tech_setting_config settings;
+    settings.file_settings[technology][file_name] = {{"parallel_fill", "true"}};
+    return settings;
+  }
+
+  // Writes 'events' product stores from each of 'threads' threads.  Each store holds a vector of
+  // 'payload' doubles identifying its thread and event.
+  void writeConcurrently(std::string const& file_name, int threads, int events, std::size_t payload)
+  {
+    form::experimental::config::ItemConfig cfg;
+    cfg.addItem("hits", file_name, technology);
+    cfg.addItem("thread", file_name, technology);
+    form::experimental::form_writer_interface writer{cfg, parallelSettings(file_name)};
+
+    std::vector<std::jthread> workers;
+    for (int t = 0; t != threads; ++t) {
+      workers.emplace_back([&writer, t, events, payload] {
+        for (int i = 0; i != events; ++i) {
+          std::vector<double> const hits(payload, t * 100000.0 + i);
+          std::vector<form::experimental::product_with_name> const products{
+            {"hits", &hits, &typeid(std::vector<double>)}, {"thread", &t, &typeid(int)}};
+          writer.write("parallel_creator", eventId(t, i), products);
+        }
+      });
+    }
+  }
+}
+
+TEST_CASE("RNTuple entries may be filled from several threads", "[form]")
+{
+  std::string const file_name = "rntuple_parallel_fill.root";
+  int const threads = 8;
+  int const events = 250;
+  writeConcurrently(file_name, threads, events, 10);
+
+  form::experimental::config::ItemConfig cfg;
+  cfg.addItem("hits", file_name, technology);
+  cfg.addItem("thread", file_name, technology);
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(form::experimental::config::tech_setting_config{});
+  CHECK(reader->listIndices("parallel_creator", "hits").size() ==
+        static_cast<std::size_t>(threads * events));
+
+  // Entries of different threads are interleaved cluster by cluster, but each product still
+  // shares its entry with its index.
+  for (int t = 0; t != threads; ++t) {
+    for (int i = 0; i != events; i += 7) {
+      void const* raw = nullptr;
+      reader->read("parallel_creator", "hits", eventId(t, i), &raw, typeid(std::vector<double>));
+      std::unique_ptr<std::vector<double> const> const hits(
+        static_cast<std::vector<double> const*>(raw));
+      REQUIRE(hits != nullptr);
+      CHECK(*hits == std::vector<double>(10, t * 100000.0 + i));
+
+      reader->read("parallel_creator", "thread", eventId(t, i), &raw, typeid(int));
+      std::unique_ptr<int const> const thread(static_cast<int const*>(raw));
+      REQUIRE(thread != nullptr);
+      CHECK(*thread == t);
+    }
+  }
+}
+
+TEST_CASE("Parallel RNTuple fills produce no row-addressed Tokens", "[form]")
+{
+  std::string const file_name = "rntuple_parallel_tokens.root";
+  form::experimental::config::ItemConfig cfg;
+  cfg.addItem("hits", file_name, technology);
+
+  auto writer = createPersistenceWriter();
+  writer->configure(cfg);
+  writer->configureTechSettings(parallelSettings(file_name));
+  auto const& containers =
+    writer->createContainers("token_creator", {{"hits", &typeid(std::vector<double>)}});
+
+  std::vector<double> const hits{1.0, 2.0};
+  // Rows are only assigned when a fill context flushes, so no Token can locate the product...
+  CHECK_THROWS_AS(writer->registerWrite("token_creator", "hits", &hits, typeid(hits)),
+                  std::runtime_error);
+  // ...but writing through the containers is fine: the product is found through the index.
+  CHECK(writer->write(containers.products.at("hits"), &hits) == kDeferredRowId);
+  writer->commitOutput(containers, "[event:1]");
+}
+
+TEST_CASE("Parallel RNTuple output throughput", "[.][benchmark]")
+{
+  // 67 MB per thread count: 8192 stores of 1024 doubles
+  int const stores = 8192;
+  std::size_t const payload = 1024;
+  double const megabytes = stores * payload * sizeof(double) / 1e6;
+
+  std::cout << "threads  MB/s\n";
+  auto const max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    auto const start = std::chrono::steady_clock::now();
+    writeConcurrently("rntuple_parallel_benchmark.root",
+                      static_cast<int>(threads),
+                      stores / static_cast<int>(threads),
+                      payload);
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << threads << "  " << megabytes / elapsed.count() << '\n';
+  }
+}
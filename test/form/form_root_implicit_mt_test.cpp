@@ -0,0 +1,118 @@
+//Tests for running ROOT's implicit multithreading within Phlex's limit on parallelism
+
+#include "form/config.hpp"
+#include "persistence/persistence_reader.hpp"
+#include "persistence/persistence_writer.hpp"
+#include "storage/factories.hpp"
+
+#include "TROOT.h"
+
+#include "oneapi/tbb/global_control.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace form::detail::experimental;
+
+namespace {
+  auto const technology = form::technology::ROOT_TTREE;
+
+  // Number of threads in this process, as listed by the kernel
+  std::size_t processThreads()
+  {
+    using std::filesystem::directory_iterator;
+    return static_cast<std::size_t>(
+      std::distance(directory_iterator{"/proc/self/task"}, directory_iterator{}));
+  }
+
+  form::experimental::config::tech_setting_config implicitMTSettings(std::string const& file_name)
+  {
+    form::experimental::config::tech_setting_config settings;
+    settings.file_settings[technology][file_name] = {{"implicit_mt", "true"}};
+    return settings;
+  }
+}
+
+// Implicit MT is process-wide and cannot be disabled once enabled, so the test cases only
+// compare its state before and after, and all request the same number of threads.
+TEST_CASE("Invalid implicit_mt values are rejected", "[form]")
+{
+  auto const enabled_before = ROOT::IsImplicitMTEnabled();
+  auto file = createFile(technology, "implicit_mt_invalid.root", 'o');
+  CHECK_THROWS_AS(file->setAttribute("implicit_mt", "many"), std::runtime_error);
+  CHECK_THROWS_AS(file->setAttribute("implicit_mt", "0"), std::runtime_error);
+  CHECK_THROWS_AS(file->setAttribute("implicit_mt", "4 threads"), std::runtime_error);
+  CHECK_NOTHROW(file->setAttribute("implicit_mt", "false"));
+  CHECK(ROOT::IsImplicitMTEnabled() == enabled_before);
+}
+
+TEST_CASE("Implicit MT cannot be resized once set up", "[form]")
+{
+  tbb::global_control const parallelism{tbb::global_control::max_allowed_parallelism, 2};
+  auto file = createFile(technology, "implicit_mt_resize.root", 'o');
+  CHECK_NOTHROW(file->setAttribute("implicit_mt", "true"));
+  CHECK_NOTHROW(file->setAttribute("implicit_mt", "2"));
+  CHECK_THROWS_AS(file->setAttribute("implicit_mt", "1"), std::runtime_error);
+}
+
+TEST_CASE("ROOT implicit MT stays within the configured parallelism", "[form]")
+{
+  using namespace form::experimental::config;
+
+  // Stands in for the limit Phlex sets from its -j option; the same as in the test above
+  std::size_t const limit = 2;
+  tbb::global_control const parallelism{tbb::global_control::max_allowed_parallelism, limit};
+  auto const threads_before = processThreads();
+
+  std::string const file_name = "implicit_mt.root";
+  std::string const creator = "implicit_mt_creator";
+  int const events = 200;
+  std::vector<double> const payload(10'000, 1.0);
+
+  ItemConfig cfg;
+  cfg.addItem("hits", file_name, technology);
+  cfg.addItem("energies", file_name, technology);
+
+  {
+    auto writer = createPersistenceWriter();
+    writer->configure(cfg);
+    writer->configureTechSettings(implicitMTSettings(file_name));
+    writer->createContainers(creator,
+                             {{"hits", &typeid(std::vector<double>)},
+                              {"energies", &typeid(std::vector<double>)}});
+    for (int i = 0; i != events; ++i) {
+      writer->registerWrite(creator, "hits", &payload, typeid(std::vector<double>));
+      writer->registerWrite(creator, "energies", &payload, typeid(std::vector<double>));
+      writer->commitOutput(creator, "[event:" + std::to_string(i) + "]");
+    }
+  }
+
+  REQUIRE(ROOT::IsImplicitMTEnabled());
+  CHECK(ROOT::GetThreadPoolSize() <= limit);
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(implicitMTSettings(file_name));
+  for (int i = 0; i != events; ++i) {
+    for (auto const* product : {"hits", "energies"}) {
+      void const* raw = nullptr;
+      reader->read(
+        creator, product, "[event:" + std::to_string(i) + "]", &raw, typeid(std::vector<double>));
+      std::unique_ptr<std::vector<double> const> const data(
+        static_cast<std::vector<double> const*>(raw));
+      REQUIRE(data != nullptr);
+      CHECK(*data == payload);
+    }
+  }
+
+  // The main thread takes one of the 'limit' slots; ROOT's arena draws its workers from the same
+  // capped TBB pool instead of starting a pool of its own.
+  CHECK(processThreads() <= threads_before + limit - 1);
+}
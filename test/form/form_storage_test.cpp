@@ -8,6 +8,7 @@
 #include "root_storage/root_tfile.hpp"
 #include "root_storage/root_ttree_write_container.hpp"
 #include "storage/storage_file.hpp"
+#include "storage/storage_index.hpp"
 #include "storage/storage_reader.hpp"
 #include "storage/storage_write_container.hpp"
 
@@ -15,12 +16,18 @@
 #include "TFile.h"
 #include "TTree.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <numbers>
 #include <numeric>
+#include <string>
+#include <thread>
 #include <vector>
 
 using namespace form::detail::experimental;
@@ -273,6 +280,47 @@ TEST_CASE("Root branch read: throws for a type with no ROOT dictionary", "[form]
   CHECK_THROWS_AS(container->read(0, &rawPtr, typeid(LocalType)), std::runtime_error);
 }
 
+TEST_CASE("Root read: bulk reads of a fundamental column", "[form]")
+{
+  // Enough rows to fill several TTree baskets
+  int const rows = 20'000;
+  {
+    auto file = createFile(technology, form::test::testFileName, 'o');
+    auto parent = createWriteAssociation(technology, form::test::testTreeName);
+    parent->setFile(file);
+    parent->setupWrite();
+    auto container = createWriteContainer(technology, form::test::makeTestBranchName<int>());
+    auto assoc = dynamic_pointer_cast<Storage_Associative_Write_Container>(container);
+    REQUIRE(assoc != nullptr);
+    assoc->setParent(parent);
+    container->setFile(file);
+    container->setupWrite(typeid(int));
+    for (int i = 0; i != rows; ++i) {
+      container->fill(&i);
+      container->commit();
+    }
+  }
+
+  auto file = createFile(technology, form::test::testFileName, 'i');
+  auto container = createReadContainer(technology, form::test::makeTestBranchName<int>());
+  container->setFile(file);
+
+  std::vector<int> buffer(15'000, -1);
+  REQUIRE(container->readBulk(1'000, 15'000, buffer.data(), typeid(int)) == 15'000);
+  std::vector<int> expected(15'000);
+  std::ranges::iota(expected, 1'000);
+  CHECK(buffer == expected);
+
+  // Reads are clipped at the end of the container
+  CHECK(container->readBulk(rows - 10, 100, buffer.data(), typeid(int)) == 10);
+  CHECK(buffer.front() == rows - 10);
+  CHECK(buffer[9] == rows - 1);
+  CHECK(container->readBulk(rows, 100, buffer.data(), typeid(int)) == 0);
+
+  CHECK_THROWS_AS(container->readBulk(0, 1, buffer.data(), typeid(std::vector<int>)),
+                  std::runtime_error);
+}
+
 TEST_CASE("Root TTree write container: fill and commit are not implemented", "[form]")
 {
   auto file = createFile(technology, "testTTreeWriteOps.root", 'o');
@@ -455,6 +503,59 @@ TEST_CASE("registerWrite returns a Token locating the written product", "[form]"
   CHECK(*got_second == second);
 }
 
+TEST_CASE("Writes through container handles match registerWrite", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name =
+    "container_handles_" + form::technology::to_string(technology) + ".root";
+  std::string const creator = "handle_creator";
+
+  ItemConfig cfg;
+  cfg.addItem("prod", file_name, technology);
+
+  std::vector<int> const first = {1, 2, 3};
+  std::vector<int> const second = {4, 5};
+  {
+    auto writer = createPersistenceWriter();
+    REQUIRE(writer != nullptr);
+    writer->configure(cfg);
+    writer->configureTechSettings(tech_setting_config{});
+
+    auto const& containers =
+      writer->createContainers(creator, {{"prod", &typeid(std::vector<int>)}});
+    REQUIRE(containers.products.size() == 1);
+    auto const& prod = containers.products.at("prod");
+    CHECK(prod.placement.containerName() == creator + "/prod");
+
+    // Creating the same containers again yields the same handles.
+    auto const& again = writer->createContainers(creator, {{"prod", &typeid(std::vector<int>)}});
+    CHECK(&again == &containers);
+    CHECK(again.products.at("prod").container == prod.container);
+
+    CHECK(writer->write(prod, &first) == 0u);
+    writer->commitOutput(containers, "[event:1]");
+
+    // The string-based interface writes through the same containers.
+    auto const token = writer->registerWrite(creator, "prod", &second, typeid(std::vector<int>));
+    CHECK(token.id() == 1u);
+    writer->commitOutput(creator, "[event:2]");
+  }
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(tech_setting_config{});
+
+  for (auto const& [id, expected] :
+       {std::pair{"[event:1]", first}, std::pair{"[event:2]", second}}) {
+    void const* raw = nullptr;
+    reader->read(creator, "prod", id, &raw, typeid(std::vector<int>));
+    std::unique_ptr<std::vector<int> const> const got(static_cast<std::vector<int> const*>(raw));
+    REQUIRE(got != nullptr);
+    CHECK(*got == expected);
+  }
+}
+
 TEST_CASE("registerWrite throws when the backend does not address rows", "[form]")
 {
   using namespace form::experimental::config;
@@ -601,6 +702,115 @@ TEST_CASE("StorageReader getIndex: empty container and tech-table branches", "[f
     Token{file_name, creator + "/index", technology}, "missing-id", container_attr_settings));
 }
 
+TEST_CASE("StorageReader getIndex: key container and string-index fallback", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::vector<std::string> const ids = {
+    "[run:1, event:5]", "[run:1, event:6]", "[run:2, event:5]"};
+  std::string const file_name =
+    "storage_reader_index_keys_" + form::technology::to_string(technology) + ".root";
+  std::string const creator = "index_keys_creator";
+
+  SECTION("file with a key container")
+  {
+    ItemConfig cfg;
+    cfg.addItem("prod", file_name, technology);
+    auto writer = createPersistenceWriter();
+    writer->configure(cfg);
+    writer->configureTechSettings(tech_setting_config{});
+    writer->createContainers(creator, {{"prod", &typeid(std::vector<int>)}});
+    for (auto const& id : ids) {
+      std::vector<int> const payload = {1};
+      writer->registerWrite(creator, "prod", &payload, typeid(std::vector<int>));
+      writer->commitOutput(creator, id);
+    }
+  }
+
+  SECTION("file written without a key container")
+  {
+    auto file = createFile(technology, file_name, 'o');
+    auto parent = createWriteAssociation(technology, creator);
+    parent->setFile(file);
+    parent->setupWrite();
+    auto index = createWriteContainer(technology, creator + "/index");
+    if (auto assoc = dynamic_pointer_cast<Storage_Associative_Write_Container>(index)) {
+      assoc->setParent(parent);
+    }
+    index->setFile(file);
+    index->setupWrite(typeid(std::string));
+    for (auto const& id : ids) {
+      index->fill(&id);
+      index->commit();
+    }
+  }
+
+  StorageReader reader;
+  Token const index_token{file_name, creator + "/index", technology};
+  tech_setting_config const settings{};
+
+  CHECK(indexKey("[run:1, event:5]") == indexKey("[ Event=5; RUN=1 ]"));
+  CHECK(indexKey("[run:1, event:5]") != indexKey("[run:5, event:1]"));
+
+  CHECK(reader.getIndex(index_token, "[run:2, event:5]", settings) == 2);
+  // Structured ids match regardless of spacing, separators, case and component order
+  CHECK(reader.getIndex(index_token, "[EVENT=6;run=1]", settings) == 1);
+  CHECK_THROWS_AS(reader.getIndex(index_token, "[run:3, event:5]", settings), std::runtime_error);
+  CHECK(reader.listIndices(index_token, settings) == ids);
+
+  // With or without a cell container, the cells are those of the ids
+  auto const cells = reader.listIndexCells(index_token, settings);
+  REQUIRE(cells.size() == ids.size());
+  for (std::size_t row = 0; row != ids.size(); ++row) {
+    REQUIRE(cells[row].layers != nullptr);
+    CHECK(*cells[row].layers == std::vector<std::string>{"run", "event"});
+  }
+  CHECK(cells[2].numbers == std::vector<std::uint64_t>{2, 5});
+}
+
+TEST_CASE("StorageReader getIndex: key collision with an id not in the file", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::vector<std::string> const ids = {"[run:1, event:5]", "[run:1, event:6]"};
+  // The key of the second row is that of an id the file does not hold, as if the two collided.
+  std::string const absent_id = "[run:9, event:9]";
+  std::vector<std::uint64_t> const keys = {indexKey(ids[0]), indexKey(absent_id)};
+  std::string const file_name =
+    "storage_reader_key_collision_" + form::technology::to_string(technology) + ".root";
+  std::string const creator = "key_collision_creator";
+
+  {
+    auto file = createFile(technology, file_name, 'o');
+    auto parent = createWriteAssociation(technology, creator);
+    parent->setFile(file);
+    parent->setupWrite();
+    auto index = createWriteContainer(technology, creator + "/index");
+    auto key = createWriteContainer(technology, indexKeyContainerName(creator + "/index"));
+    for (auto const& container : {index, key}) {
+      if (auto assoc = dynamic_pointer_cast<Storage_Associative_Write_Container>(container)) {
+        assoc->setParent(parent);
+      }
+      container->setFile(file);
+    }
+    index->setupWrite(typeid(std::string));
+    key->setupWrite(typeid(std::uint64_t));
+    for (std::size_t row = 0; row != ids.size(); ++row) {
+      index->fill(&ids[row]);
+      key->fill(&keys[row]);
+      index->commit();
+    }
+  }
+
+  StorageReader reader;
+  Token const index_token{file_name, creator + "/index", technology};
+  tech_setting_config const settings{};
+
+  CHECK(reader.getIndex(index_token, ids[0], settings) == 0);
+  // The key matches row 1, but that row holds another id
+  CHECK_THROWS_AS(reader.getIndex(index_token, absent_id, settings), std::runtime_error);
+}
+
 TEST_CASE("StorageReader prime/listIndices/readContainer: attribute and error branches", "[form]")
 {
   using namespace form::experimental::config;
@@ -733,3 +943,100 @@ TEST_CASE("Root branch entries: success and error paths", "[form]")
     CHECK(container->entries() == 1);
   }
 }
+
+namespace {
+  // Writes `rows` entries of a one-element std::vector<int> product holding the row number,
+  // with index ids "[event:<row>]".
+  form::experimental::config::ItemConfig writeNumberedRows(std::string const& file_name,
+                                                           std::string const& creator,
+                                                           int const rows)
+  {
+    using namespace form::experimental::config;
+
+    ItemConfig cfg;
+    cfg.addItem("prod", file_name, technology);
+
+    auto writer = createPersistenceWriter();
+    writer->configure(cfg);
+    writer->configureTechSettings(tech_setting_config{});
+    writer->createContainers(creator, {{"prod", &typeid(std::vector<int>)}});
+    for (int row = 0; row != rows; ++row) {
+      std::vector<int> const payload{row};
+      writer->registerWrite(creator, "prod", &payload, typeid(std::vector<int>));
+      writer->commitOutput(creator, "[event:" + std::to_string(row) + "]");
+    }
+    return cfg;
+  }
+
+  // Reads every row with `threads` threads, each taking an interleaved share of the rows.
+  // Returns the number of rows whose payload did not match the row number.
+  int readNumberedRows(IPersistenceReader& reader,
+                       std::string const& creator,
+                       int const rows,
+                       unsigned const threads)
+  {
+    std::atomic<int> mismatches{};
+    {
+      std::vector<std::jthread> workers;
+      workers.reserve(threads);
+      for (unsigned t = 0; t != threads; ++t) {
+        workers.emplace_back([&, t] {
+          for (int row = static_cast<int>(t); row < rows; row += static_cast<int>(threads)) {
+            auto const id = "[event:" + std::to_string(row) + "]";
+            void const* raw = nullptr;
+            reader.read(creator, "prod", id, &raw, typeid(std::vector<int>));
+            std::unique_ptr<std::vector<int> const> const payload(
+              static_cast<std::vector<int> const*>(raw));
+            if (!payload || *payload != std::vector<int>{row}) {
+              ++mismatches;
+            }
+          }
+        });
+      }
+    }
+    return mismatches;
+  }
+}
+
+TEST_CASE("Persistence reads may be issued concurrently", "[form]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name =
+    "concurrent_reads_" + form::technology::to_string(technology) + ".root";
+  std::string const creator = "concurrent_creator";
+  int const rows = 1000;
+  auto const cfg = writeNumberedRows(file_name, creator, rows);
+
+  auto reader = createPersistenceReader();
+  reader->configure(cfg);
+  reader->configureTechSettings(tech_setting_config{});
+  reader->prime(creator, "prod", typeid(std::vector<int>));
+
+  CHECK(readNumberedRows(*reader, creator, rows, 8) == 0);
+}
+
+TEST_CASE("Read throughput scaling", "[.][benchmark]")
+{
+  using namespace form::experimental::config;
+
+  std::string const file_name =
+    "read_scaling_" + form::technology::to_string(technology) + ".root";
+  std::string const creator = "scaling_creator";
+  int const rows = 100'000;
+  auto const cfg = writeNumberedRows(file_name, creator, rows);
+
+  for (unsigned threads = 1; threads <= std::max(1u, std::thread::hardware_concurrency());
+       threads *= 2) {
+    // A fresh reader per thread count, so that each measurement includes opening the slots
+    // needed by that many threads.
+    BENCHMARK("Read " + std::to_string(rows) + " rows with " + std::to_string(threads) +
+              " threads")
+    {
+      auto reader = createPersistenceReader();
+      reader->configure(cfg);
+      reader->configureTechSettings(tech_setting_config{});
+      return readNumberedRows(*reader, creator, rows, threads);
+    };
+  }
+}
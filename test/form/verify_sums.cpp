@@ -0,0 +1,34 @@
+#include "phlex/module.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+using namespace phlex;
+
+// Checks the 'sum' products read back from a FORM file: each must be zero, and there must be
+// one per event.  Failures are thrown rather than asserted so that they fail the job in all
+// build types.
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  m.fold(
+     "count_sums",
+     [](std::atomic<unsigned int>& count, int sum) {
+       if (sum != 0) {
+         throw std::runtime_error("verify_sums: read back a sum of " + std::to_string(sum));
+       }
+       ++count;
+     },
+     concurrency::unlimited)
+    .input_family(config.get<product_selector>("input"))
+    .output_product_suffixes("count");
+
+  m.observe("verify_count",
+            [expected = config.get<unsigned int>("expected")](unsigned int count) {
+              if (count != expected) {
+                throw std::runtime_error("verify_sums: read back " + std::to_string(count) +
+                                         " sums instead of " + std::to_string(expected));
+              }
+            })
+    .input_family(product_selector{.creator = "count_sums", .layer = "job", .suffix = "count"});
+}
@@ -161,6 +161,7 @@ int main(int argc, char** argv)
     checksum_file << std::setprecision(10) << "EVT " << nevent << " " << check << "\n";
     std::cout << "PHLEX: Write Event done " << nevent << '\n';
   }
+  form.flush();
 
   checksum_file.close();
   std::cout << "PHLEX: Write done. Checksums saved to " << checksum_filename << '\n';
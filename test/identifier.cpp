@@ -5,7 +5,10 @@
 
 #include <algorithm>
 #include <array>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <boost/json.hpp>
 #include <fmt/format.h>
@@ -92,3 +95,33 @@ TEST_CASE("Identifier formatting", "[identifier]")
   CHECK(formatted == "test_id");
   CHECK(fmt::format("prefix_{}_suffix", id) == "prefix_test_id_suffix");
 }
+
+TEST_CASE("Identifiers are interned", "[identifier]")
+{
+  std::string const text{"interned"};
+  identifier from_view{std::string_view(text)};
+  identifier from_string{std::string(text)};
+  identifier from_literal = "interned"_id;
+
+  // All identifiers with the same content share the same storage
+  CHECK(&from_view.trans_get_string() == &from_string.trans_get_string());
+  CHECK(&from_view.trans_get_string() == &from_literal.trans_get_string());
+  CHECK(&identifier{}.trans_get_string() == &""_id.trans_get_string());
+  CHECK(identifier{}.empty());
+
+  // Concurrent interning of the same strings yields a single entry per string
+  constexpr std::size_t n_threads = 8;
+  std::array<std::string const*, n_threads> entries{};
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t i = 0; i != n_threads; ++i) {
+      threads.emplace_back([&entries, i] {
+        for (int j = 0; j != 1000; ++j) {
+          [[maybe_unused]] identifier const id{std::string_view(fmt::format("concurrent-{}", j))};
+        }
+        entries[i] = &identifier{"concurrent-999"}.trans_get_string();
+      });
+    }
+  }
+  CHECK(std::ranges::all_of(entries, [&](auto const* entry) { return entry == entries[0]; }));
+}
@@ -1,5 +1,6 @@
 #include "phlex/core/framework_graph.hpp"
 #include "plugins/layer_generator.hpp"
+#include "test/allocation_counter.hpp"
 
 #include <iostream>
 
@@ -25,7 +26,12 @@ try {
   g.transform("pass_on", pass_on, concurrency::unlimited)
     .input_family(product_selector{.creator = "input", .layer = "event", .suffix = "number"})
     .output_product_suffixes("different");
+
+  auto const allocations_before = test::allocation_count();
   g.execute();
+  auto const allocations = test::allocation_count() - allocations_before;
+  std::cout << "Heap allocations per event: " << static_cast<double>(allocations) / max_events
+            << '\n';
 } catch (std::exception const& e) {
   std::cerr << "Exception caught in main: " << e.what() << '\n';
   return 1;
@@ -16,6 +16,7 @@
 #include <ranges>
 #include <set>
 #include <string>
+#include <vector>
 
 using namespace phlex;
 
@@ -35,6 +36,29 @@ namespace {
     std::set<std::string>* products_;
   };
 
+  // Keeps every store it is handed, as an asynchronous output would until it has written them
+  class store_keeper {
+  public:
+    store_keeper(std::vector<experimental::product_store_const_ptr>& stores,
+                 unsigned& end_of_job_calls) :
+      stores_{&stores}, end_of_job_calls_{&end_of_job_calls}
+    {
+    }
+
+    void keep(experimental::product_store_const_ptr const& store)
+    {
+      // Only called for the job's stores
+      REQUIRE(store);
+      stores_->push_back(store);
+    }
+
+    void finish() { ++*end_of_job_calls_; }
+
+  private:
+    std::vector<experimental::product_store_const_ptr>* stores_;
+    unsigned* end_of_job_calls_;
+  };
+
   constexpr std::string brahms() { return "Brahms"; }
 
   detail::product_ptr give_me_a_name(data_cell_index const&)
@@ -109,3 +133,38 @@ TEST_CASE("Output data products", "[graph]")
                                                      "provide_name/",
                                                      "square_number/squared_number"});
 }
+
+TEST_CASE("Output that retains product stores", "[graph]")
+{
+  auto gen = experimental::layer_generator::make();
+  gen->add_layer("spill", {.parent_layer = "job", .count = 2u});
+
+  auto g = phlex::detail::framework_graph::without_driver();
+  g.add_driver(gen);
+
+  g.provide("provide_number", [](data_cell_index const&) -> int { return 17; })
+    .output_product("input", "number_from_provider", "spill");
+
+  // The provider only runs for a consumer of its product.
+  g.observe("read_number", [](int const number) { CHECK(number == 17); }, concurrency::serial)
+    .input_family(
+      product_selector{.creator = "input", .layer = "spill", .suffix = "number_from_provider"});
+
+  std::vector<experimental::product_store_const_ptr> stores;
+  unsigned end_of_job_calls{};
+  g.make<store_keeper>(stores, end_of_job_calls)
+    .output("keep", &store_keeper::keep, concurrency::serial)
+    .end_of_job(&store_keeper::finish);
+
+  g.execute();
+
+  // The output is told once that the job has ended, after it has received every store.
+  CHECK(end_of_job_calls == 1u);
+  CHECK(g.execution_count("keep") == 2u);
+
+  // The stores, and the products they own, outlive the graph's messages.
+  REQUIRE(stores.size() == 2u);
+  for (auto const& store : stores) {
+    CHECK(store->get_product<int>("input/number_from_provider") == 17);
+  }
+}
@@ -1,5 +1,7 @@
 #include "phlex/model/data_cell_index.hpp"
 #include "phlex/model/handle.hpp"
+#include "phlex/model/product_store.hpp"
+#include "test/allocation_counter.hpp"
 
 #include "catch2/catch_test_macros.hpp"
 
@@ -136,3 +138,39 @@ TEST_CASE("Retrieve stage from handle", "[data model]")
   handle const h{number, *data_cell_index::job(), spec, "last"};
   CHECK(h.stage() == "last");
 }
+
+TEST_CASE("Creating a handle does not allocate", "[data model]")
+{
+  auto store = experimental::product_store::base();
+  store->add_product(spec_t{"creator/number"}, 3);
+  store->add_product(spec_t{"creator/composer"}, Composer{"Elgar"});
+  spec_t const number_spec{"creator/number"};
+  spec_t const composer_spec{"creator/composer"};
+
+  constexpr int n_handles = 100;
+  int sum{};
+  std::size_t name_lengths{};
+  auto const allocations_before = test::allocation_count();
+  for (int i = 0; i != n_handles; ++i) {
+    auto const number = store->get_handle<int>(number_spec);
+    auto const composer = store->get_handle<Composer>(composer_spec);
+    sum += *number;
+    name_lengths += composer->name.size() + composer.suffix().size() + number.stage().size();
+  }
+  auto const allocations = test::allocation_count() - allocations_before;
+
+  CHECK(allocations == 0);
+  CHECK(sum == 3 * n_handles);
+  CHECK(name_lengths == (5 + 8 + 7) * n_handles);
+}
+
+TEST_CASE("Handle refers to the stored product specification", "[data model]")
+{
+  auto store = experimental::product_store::base();
+  store->add_product(spec_t{"creator/number"}, 3);
+
+  // The specification used for the lookup does not outlive the handle
+  auto const h = store->get_handle<int>(spec_t{"creator/number"});
+  CHECK(h.creator().algorithm == "creator");
+  CHECK(h.suffix() == "number");
+}
@@ -0,0 +1,124 @@
+"""Batched algorithms, which are called for several data cells at once.
+
+A batched algorithm declares the types of the values of a single cell, but
+receives numpy arrays holding the values of all cells in the batch, and
+returns a sequence with one result per cell. Numpy-vectorized code thus
+amortizes the interpreter overhead over the batch.
+"""
+
+import threading
+
+import numpy as np
+
+
+def add(i: int, j: int) -> int:
+    """Add the inputs of each cell in the batch.
+
+    Args:
+        i (ndarray): First inputs.
+        j (ndarray): Second inputs.
+
+    Returns:
+        ndarray: Sums of the inputs, one per cell.
+    """
+    return i + j
+
+
+def add_doubles(d1: "double", d2: "double") -> "double":  # type: ignore # noqa: F821
+    """Add the inputs of each cell in the batch."""
+    return d1 + d2
+
+
+def is_unit(total: "double") -> bool:  # type: ignore # noqa: F821
+    """Flag the sums of a batch of cells that equal one, as numpy booleans."""
+    return np.isclose(total, 1.0)
+
+
+def check_true(flag: bool) -> None:
+    """Check the flag of a single cell."""
+    assert flag is True
+
+
+class CheckUnit:
+    """Check that the sums of a batch of cells all equal one.
+
+    Also checks, once all cells have been seen, that calls were in fact combined
+    into batches of more than one cell.
+    """
+
+    __name__ = "check_unit"
+
+    def __init__(self, cells: int):
+        """Initialize with the number of cells of the job."""
+        self._cells = cells
+        self._seen = 0
+        self._max_batch = 0
+        self._lock = threading.Lock()
+
+    def __call__(self, total: "double") -> None:  # type: ignore # noqa: F821
+        """Check the sums of a batch of cells."""
+        assert isinstance(total, np.ndarray)
+        assert np.allclose(total, 1.0)
+        with self._lock:
+            self._seen += len(total)
+            self._max_batch = max(self._max_batch, len(total))
+            if self._seen == self._cells:
+                assert 1 < self._max_batch, "no calls were batched"
+
+
+def sum_list(lst: "list[double]") -> "double":  # type: ignore # noqa: F821
+    """Not batchable, as its input is a collection."""
+    return sum(lst)
+
+
+def PHLEX_REGISTER_ALGORITHMS(m, config):
+    """Register batched transforms and a batched observer.
+
+    Args:
+        m (internal): Phlex registrar representation.
+        config (internal): Phlex configuration representation.
+
+    Returns:
+        None
+    """
+    batch = config["batch"]
+
+    try:
+        m.transform(
+            sum_list,
+            batch=batch,
+            input_family=[{"creator": "input", "layer": "event", "suffix": "vd"}],
+            output_product_suffixes=["sum_vd"],
+        )
+    except TypeError as e:
+        assert "batched algorithm" in str(e)
+    else:
+        raise AssertionError("m.transform() should reject batching of collections")
+
+    m.transform(add, batch=batch, input_family=config["input"], output_product_suffixes=["sum"])
+
+    m.transform(
+        add_doubles,
+        batch=batch,
+        input_family=[
+            {"creator": "input", "layer": "event", "suffix": "d1"},
+            {"creator": "input", "layer": "event", "suffix": "d2"},
+        ],
+        output_product_suffixes=["dsum"],
+    )
+    m.observe(
+        CheckUnit(config["cells"]),
+        batch=batch,
+        input_family=[{"creator": "add_doubles", "layer": "event", "suffix": "dsum"}],
+    )
+
+    # the results of a batch of booleans are numpy booleans
+    m.transform(
+        is_unit,
+        batch=batch,
+        input_family=[{"creator": "add_doubles", "layer": "event", "suffix": "dsum"}],
+        output_product_suffixes=["unit"],
+    )
+    m.observe(
+        check_true, input_family=[{"creator": "is_unit", "layer": "event", "suffix": "unit"}]
+    )
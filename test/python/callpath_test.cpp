@@ -0,0 +1,126 @@
+// Compares the two ways of calling Python callbacks from C++: the generic dynamic call of
+// PyObject_CallFunctionObjArgs (dyncall.hpp) and the direct vectorcall (vectorcall.hpp).
+//
+// The benchmarks are hidden; run them with: py_callpath "[benchmark]"
+
+#include "dyncall.hpp"
+#include "vectorcall.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+using namespace phlex::experimental;
+
+namespace {
+  char const* const definitions = R"(
+def add(i, j):
+    return i + j
+
+class Adder:
+    def __init__(self, offset):
+        self.offset = offset
+
+    def __call__(self, i, j):
+        return i + j + self.offset
+
+adder = Adder(0)
+)";
+
+  // The interpreter is started once and kept for the remainder of the process
+  PyObject* globals()
+  {
+    static PyObject* const dict = [] {
+      Py_Initialize();
+      PyObject* main = PyImport_AddModule("__main__");
+      PyObject* dict = PyModule_GetDict(main);
+      PyObject* result = PyRun_String(definitions, Py_file_input, dict, dict);
+      if (!result) {
+        PyErr_Print();
+        throw std::runtime_error("failed to define test callables");
+      }
+      Py_DECREF(result);
+      return dict;
+    }();
+    return dict;
+  }
+
+  PyObject* callable(char const* name) { return PyDict_GetItemString(globals(), name); }
+
+  long as_long(PyObject* result)
+  {
+    REQUIRE(result != nullptr);
+    long const value = PyLong_AsLong(result);
+    Py_DECREF(result);
+    return value;
+  }
+
+  // The path taken before the vectorcall one: arguments packed for a variadic C call
+  PyObject* call_dyncall(PyObject* callable, PyObject* i, PyObject* j)
+  {
+    dcargs_t argsv;
+    argsv.reserve(4);
+    argsv.emplace_back(callable);
+    argsv.emplace_back(i);
+    argsv.emplace_back(j);
+    argsv.emplace_back(nullptr);
+
+    dcarg result{nullptr};
+    dyncall(reinterpret_cast<void*>(PyObject_CallFunctionObjArgs), result, argsv, 1);
+    return result.get<PyObject*>();
+  }
+}
+
+TEST_CASE("Python call paths give the same results", "[python]")
+{
+  PyObject* i = PyLong_FromLong(3);
+  PyObject* j = PyLong_FromLong(4);
+
+  PyObject* add = callable("add");
+  CHECK(resolve_call(add) == nullptr);
+  CHECK(as_long(call_dyncall(add, i, j)) == 7);
+  CHECK(as_long(vectorcall(add, nullptr, i, j)) == 7);
+
+  PyObject* adder = callable("adder");
+  PyObject* call = resolve_call(adder);
+  REQUIRE(call != nullptr);
+  CHECK(as_long(call_dyncall(adder, i, j)) == 7);
+  CHECK(as_long(vectorcall(adder, nullptr, i, j)) == 7);
+  CHECK(as_long(vectorcall(adder, call, i, j)) == 7);
+
+  // Errors are reported the same way
+  PyObject* none = Py_None;
+  CHECK(vectorcall(add, nullptr, i, none) == nullptr);
+  REQUIRE(PyErr_ExceptionMatches(PyExc_TypeError));
+  PyErr_Clear();
+  CHECK(vectorcall(adder, call, i, none) == nullptr);
+  REQUIRE(PyErr_ExceptionMatches(PyExc_TypeError));
+  PyErr_Clear();
+
+  Py_DECREF(call);
+  Py_DECREF(j);
+  Py_DECREF(i);
+}
+
+TEST_CASE("Python call path overhead", "[.][benchmark]")
+{
+  PyObject* i = PyLong_FromLong(3);
+  PyObject* j = PyLong_FromLong(4);
+  PyObject* add = callable("add");
+  PyObject* adder = callable("adder");
+  PyObject* call = resolve_call(adder);
+
+  BENCHMARK("function, dyncall") { return as_long(call_dyncall(add, i, j)); };
+  BENCHMARK("function, vectorcall") { return as_long(vectorcall(add, nullptr, i, j)); };
+  BENCHMARK("instance, dyncall") { return as_long(call_dyncall(adder, i, j)); };
+  BENCHMARK("instance, vectorcall") { return as_long(vectorcall(adder, nullptr, i, j)); };
+  BENCHMARK("instance, vectorcall with resolved __call__")
+  {
+    return as_long(vectorcall(adder, call, i, j));
+  };
+
+  Py_DECREF(call);
+  Py_DECREF(j);
+  Py_DECREF(i);
+}
@@ -3,11 +3,18 @@
 Smallest possible tests with a mixture of Python and Numba: Python
 providers to produce data, Numba algorithms to transform them, and Python
 observers for verification.
+
+If the configuration provides a `work` count, a compute-bound Numba kernel
+is registered instead, to measure how Numba algorithms, which run without
+the GIL, scale with the number of threads (`phlex -j N`).
 """
 
 import numba
 import numpy as np
 from adder import add
+from numba import types
+
+from phlex import ArrayPointer
 
 # arg0 suff, arg1 suff, type, result
 specs = (
@@ -20,6 +27,69 @@ specs = (
 )
 
 
+def sum_array(data, size):
+    """Add the elements of an array passed as a C pointer and its size.
+
+    Args:
+        data (ArrayPointer): Pointer to the first element.
+        size (intp): Number of elements.
+
+    Returns:
+        float64: Sum of the elements.
+    """
+    arr = numba.carray(data, size)
+    total = 0.0
+    for x in arr:
+        total += x
+    return total
+
+
+def make_kernel(work):
+    """Create a compute-bound kernel iterating `work` times on its input.
+
+    Args:
+        work (int): Number of iterations per call.
+
+    Returns:
+        Callable: Kernel taking and returning a float64.
+    """
+
+    def kernel(x):
+        acc = x
+        for k in range(work):
+            acc = (acc * acc + k) % 1.0
+        return acc
+
+    return kernel
+
+
+def register_scaling(m, work):
+    """Register the compute-bound kernel for the scaling benchmark.
+
+    Args:
+        m (internal): Phlex registrar representation.
+        work (int): Number of kernel iterations per event.
+
+    Returns:
+        None
+    """
+    # no concurrency is given, so the default of unlimited applies to Numba cfuncs
+    f_k = numba.cfunc("float64(float64)", nopython=True)(make_kernel(work))
+    m.transform(
+        f_k,
+        name="kernel",
+        input_family=[{"creator": "input", "layer": "event", "suffix": "d1"}],
+        output_product_suffixes=["kernel"],
+    )
+
+    f_o = numba.cfunc("void(float64)", nopython=True)(lambda y: None)
+    m.observe(
+        f_o,
+        name="obs_kernel",
+        input_family=[{"creator": "kernel", "layer": "event", "suffix": "kernel"}],
+    )
+
+
 def PHLEX_REGISTER_ALGORITHMS(m, config):
     """Register Numba-jited `add` algorithm variants as a transformation.
 
@@ -36,6 +106,14 @@ def PHLEX_REGISTER_ALGORITHMS(m, config):
     Returns:
         None
     """
+    try:
+        work = config["work"]
+    except KeyError:
+        work = None
+
+    if work is not None:
+        register_scaling(m, work)
+        return
 
     def new_o(x):
         def o(y):
@@ -65,3 +143,34 @@ def PHLEX_REGISTER_ALGORITHMS(m, config):
             input_family=[{"creator": "add_" + tn, "layer": "event", "suffix": "sum_" + tn}],
             concurrency=4,
         )
+
+    # arrays are passed to a cfunc as a pointer and a size
+    f_s = numba.cfunc(types.float64(ArrayPointer(types.float64), types.intp), nopython=True)(
+        sum_array
+    )
+    m.transform(
+        f_s,
+        name="sum_array",
+        input_family=[{"creator": "input", "layer": "event", "suffix": "vd"}],
+        output_product_suffixes=["sum_vd"],
+    )
+
+    try:
+        m.transform(
+            f_s,
+            name="sum_array_batched",
+            batch=16,
+            input_family=[{"creator": "input", "layer": "event", "suffix": "vd"}],
+            output_product_suffixes=["sum_vd_batched"],
+        )
+    except TypeError as e:
+        assert "can not be batched" in str(e)
+    else:
+        raise AssertionError("m.transform() should reject batching of Numba cfuncs")
+
+    f_v = numba.cfunc("void(float64)", nopython=True)(new_o(1.0))
+    m.observe(
+        f_v,
+        name="obs_sum_array",
+        input_family=[{"creator": "sum_array", "layer": "event", "suffix": "sum_vd"}],
+    )
@@ -0,0 +1,80 @@
+"""Python-produced arrays consumed by C++ algorithms.
+
+Arrays returned by Python algorithms are handed to C++ without copying and
+keep their shape, so multi-dimensional arrays arrive as such.
+"""
+
+import numpy as np
+import numpy.typing as npt
+
+
+def make_matrix(i: int) -> npt.NDArray[np.float64]:
+    """Create a C-contiguous 2x3 array holding 0, 1, ..., 5 in row-major order.
+
+    Args:
+        i (int): Input value (unused, but required for scheduling).
+
+    Returns:
+        ndarray: The 2x3 array.
+    """
+    return np.arange(6, dtype=np.float64).reshape(2, 3)
+
+
+def make_strided(i: int) -> npt.NDArray[np.float64]:
+    """Create a non-contiguous 2x3 array holding 0, 1, ..., 5 in row-major order.
+
+    Such an array can not be viewed as-is and is converted to a contiguous copy.
+
+    Args:
+        i (int): Input value (unused, but required for scheduling).
+
+    Returns:
+        ndarray: The 2x3 array, a strided view of a larger one.
+    """
+    return (np.arange(12, dtype=np.float64) / 2).reshape(2, 6)[:, ::2]
+
+
+class MakeKept:
+    """Create arrays as make_matrix does, keeping a reference to each one.
+
+    The arrays remain the algorithm's own: handing them over must not make them
+    read-only.
+    """
+
+    def __init__(self):
+        """Start without arrays."""
+        self.kept = []
+
+    def __call__(self, i: int) -> npt.NDArray[np.float64]:
+        """Check the arrays handed over before, and create a new one.
+
+        Args:
+            i (int): Input value (unused, but required for scheduling).
+
+        Returns:
+            ndarray: The 2x3 array.
+        """
+        assert all(a.flags.writeable for a in self.kept)
+        result = np.arange(6, dtype=np.float64).reshape(2, 3)
+        self.kept.append(result)
+        return result
+
+
+def PHLEX_REGISTER_ALGORITHMS(m, config):
+    """Register array producers for consumption by a C++ observer.
+
+    Args:
+        m (internal): Phlex registrar representation.
+        config (internal): Phlex configuration representation.
+
+    Returns:
+        None
+    """
+    m.transform(make_matrix, input_family=config["input"], output_product_suffixes=["matrix"])
+    m.transform(make_strided, input_family=config["input"], output_product_suffixes=["strided"])
+    m.transform(
+        MakeKept(),
+        name="make_kept",
+        input_family=config["input"],
+        output_product_suffixes=["kept"],
+    )
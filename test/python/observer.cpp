@@ -0,0 +1,31 @@
+#include "phlex/model/array_view.hpp"
+#include "phlex/module.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace phlex;
+
+// C++ consumer of arrays produced by Python algorithms
+PHLEX_REGISTER_ALGORITHMS(m, config)
+{
+  auto const dims = config.get<std::vector<int>>("shape");
+  std::vector<std::size_t> const shape(dims.begin(), dims.end());
+
+  m.observe(
+     "verify_array",
+     [shape](experimental::array_view<double> const& array) {
+       if (array.shape() != shape) {
+         throw std::runtime_error("array shape was not preserved");
+       }
+       // the producer fills the array with 0, 1, 2, ... in row-major order
+       for (std::size_t i = 0; i != array.size(); ++i) {
+         if (array[i] != static_cast<double>(i)) {
+           throw std::runtime_error("unexpected array contents");
+         }
+       }
+     },
+     concurrency::unlimited)
+    .input_family(config.get<product_selector>("input"));
+}
@@ -0,0 +1,55 @@
+"""A compute-bound pure-Python transform for thread-scaling measurements.
+
+With a regular interpreter, the GIL serializes Python algorithms whatever
+their declared concurrency. With a free-threaded one (e.g. 3.13t), the same
+transform should scale with the number of threads (`phlex -j N`).
+"""
+
+
+def make_kernel(work):
+    """Create a compute-bound kernel iterating `work` times on its input.
+
+    Args:
+        work (int): Number of iterations per call.
+
+    Returns:
+        Callable: Kernel taking and returning a double.
+    """
+
+    def kernel(x: "double") -> "double":  # type: ignore # noqa: F821
+        acc = x
+        for k in range(work):
+            acc = (acc * acc + k) % 1.0
+        return acc
+
+    return kernel
+
+
+def check(y: "double") -> None:  # type: ignore # noqa: F821
+    """Check that the kernel result is in range."""
+    assert 0.0 <= y < 1.0
+
+
+def PHLEX_REGISTER_ALGORITHMS(m, config):
+    """Register the kernel with the configured concurrency, and its check.
+
+    Args:
+        m (internal): Phlex registrar representation.
+        config (internal): Phlex configuration representation.
+
+    Returns:
+        None
+    """
+    concurrency = config["concurrency"]
+    m.transform(
+        make_kernel(config["work"]),
+        name="kernel",
+        concurrency=concurrency,
+        input_family=[{"creator": "input", "layer": "event", "suffix": "d1"}],
+        output_product_suffixes=["kernel"],
+    )
+    m.observe(
+        check,
+        concurrency=concurrency,
+        input_family=[{"creator": "kernel", "layer": "event", "suffix": "kernel"}],
+    )
@@ -0,0 +1,83 @@
+"""Algorithms sharing the conversion of their input.
+
+Several algorithms of this module consume the same C++ array product. It is
+converted to a numpy array only once per data cell, with the result handed to
+all consumers.  Each consumer counts the objects it receives for the first time,
+i.e. the conversions performed, and the counts of a data cell must add up to one.
+"""
+
+import threading
+
+import numpy as np
+import numpy.typing as npt
+
+# Every received object, by id; keeping them alive means that the ids are not reused, so an
+# unseen id stands for one more conversion.
+_received: dict[int, object] = {}
+_lock = threading.Lock()
+
+
+def _receive(vd: object) -> "int32_t":  # type: ignore # noqa: F821
+    """Count the conversion that produced the object, if it was not received before."""
+    with _lock:
+        if id(vd) in _received:
+            return np.int32(0)
+        _received[id(vd)] = vd
+        return np.int32(1)
+
+
+def first(vd: npt.NDArray[np.float64]) -> "int32_t":  # type: ignore # noqa: F821
+    """Receive the array as the first consumer."""
+    return _receive(vd)
+
+
+def second(vd: npt.NDArray[np.float64]) -> "int32_t":  # type: ignore # noqa: F821
+    """Receive the array as the second consumer."""
+    return _receive(vd)
+
+
+def third(vd: "list[double]") -> "int32_t":  # type: ignore # noqa: F821
+    """Receive the array as the third consumer, which declares a list."""
+    return _receive(vd)
+
+
+def count_conversions(
+    a: "int32_t",  # type: ignore # noqa: F821
+    b: "int32_t",  # type: ignore # noqa: F821
+    c: "int32_t",  # type: ignore # noqa: F821
+) -> None:
+    """Check that the input of the three consumers was converted once.
+
+    Args:
+        a (int32_t): Conversions counted by the first consumer.
+        b (int32_t): Conversions counted by the second consumer.
+        c (int32_t): Conversions counted by the third consumer.
+
+    Raises:
+        AssertionError: if the input was converted more than once.
+    """
+    assert a + b + c == 1
+
+
+def PHLEX_REGISTER_ALGORITHMS(m, config):
+    """Register three consumers of the same input and the check of their results.
+
+    Args:
+        m (internal): Phlex registrar representation.
+        config (internal): Phlex configuration representation.
+
+    Returns:
+        None
+    """
+    for consumer in (first, second, third):
+        m.transform(
+            consumer, input_family=config["input"], output_product_suffixes=[consumer.__name__]
+        )
+
+    m.observe(
+        count_conversions,
+        input_family=[
+            {"creator": consumer.__name__, "layer": "event", "suffix": consumer.__name__}
+            for consumer in (first, second, third)
+        ],
+    )
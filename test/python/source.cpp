@@ -1,6 +1,8 @@
 #include "phlex/source.hpp"
+#include "phlex/model/array_view.hpp"
 #include "phlex/model/data_cell_index.hpp"
 #include <cstdint>
+#include <vector>
 
 using namespace phlex;
 
@@ -71,4 +73,11 @@ PHLEX_REGISTER_PROVIDERS(s)
     .output_product("input", "b1", "event");
   s.provide("provide_b2", [](data_cell_index const& id) -> bool { return (id.number() % 2) != 0; })
     .output_product("input", "b2", "event");
+
+  s.provide("provide_vd",
+            [](data_cell_index const& id) {
+              auto const d = static_cast<double>(id.number() % 100u) / 100.0;
+              return experimental::array_view<double>{std::vector<double>{d, 1.0 - d}};
+            })
+    .output_product("input", "vd", "event");
 }
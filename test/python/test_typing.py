@@ -8,7 +8,7 @@ from typing import Dict, List
 import numpy as np
 import numpy.typing as npt
 from phlex._typing import _C2C
-from pytest import raises
+from pytest import importorskip, raises
 
 from phlex import normalize_type
 
@@ -103,3 +103,12 @@ class TestTYPING:
                 return "some type"
 
         assert normalize_type(SomeType()) == "some type"
+
+    def test_numba_pointers(self):
+        """Numba pointers are only accepted if they are declared to point to arrays."""
+        numba_types = importorskip("numba.core.types")
+        from phlex import ArrayPointer
+
+        assert normalize_type(ArrayPointer(numba_types.float64)) == "ndarray[double]"
+        assert normalize_type(ArrayPointer(numba_types.int32)) == "ndarray[int32_t]"
+        raises(TypeError, normalize_type, numba_types.CPointer(numba_types.float64))